@@ -2,12 +2,19 @@
 
 #include <filesystem>
 
+#include "../src/file_view.hpp"
+
 namespace fs = std::filesystem; // Namespace alias for filesystem
 
+// Every worker calls the same module instance concurrently: state written by process_file lives in
+// a per-worker shard (see Sharded), so no locks or atomics are needed, and merge() folds the shards
 class CodeFetchModule {                                       // Abstract base class for statistics modules
 public:
     virtual ~CodeFetchModule() = default;                     // Virtual destructor with default implementation
-    virtual void process_file(const fs::path& file_path) = 0; // Pure virtual method for file processing
+    virtual FileAccess access() const { return FileAccess::Metadata; }  // What the pipeline prefetches for it
+    virtual void prepare(size_t /*workers*/) {}               // Before the workers start: one shard per worker
+    virtual void process_file(const FileView& file, size_t worker) = 0;  // worker: the caller's shard index
+    virtual void merge() {}                                   // After the workers joined, in worker order
     virtual void print_stats() const = 0;                     // Pure virtual method for stats printing
 };
 
@@ -0,0 +1,99 @@
+#include "debt_markers.hpp"
+#include "file_extension_to_language_map.hpp"
+#include "../src/output_formatter.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+    size_t sum(const MarkerCounts& counts) {
+        return std::accumulate(counts.begin(), counts.end(), size_t{0});
+    }
+
+    void add(MarkerCounts& to, const MarkerCounts& counts) {
+        for (size_t i = 0; i < MAX_MARKERS; ++i) to[i] += counts[i];
+    }
+}
+
+DebtMarkersModule::DebtMarkersModule(const MarkerSet& markers, size_t languages_count, size_t directories_count)
+    : markers(markers), languages_count(languages_count), directories_count(directories_count) {}
+
+// Tags with at least one hit, e.g. "12 TODO, 3 FIXME"
+std::string DebtMarkersModule::summary(const MarkerCounts& counts) const {
+    std::string text;
+    for (size_t i = 0; i < markers.size(); ++i) {
+        if (!counts[i]) continue;
+        if (!text.empty()) text += ", ";
+        text += OutputFormatter::format_large_number(counts[i]) + " " + std::string(markers.tag(i));
+    }
+    return text;
+}
+
+// Add the markers found while the file's lines were classified to the worker's shards
+void DebtMarkersModule::process_file(const FileView& file, size_t worker) {
+    const MarkerCounts& counts = file.lines().markers;
+    if (!sum(counts)) return;
+    std::vector<MarkerCounts>& shard = shards[worker];
+    if (shard.empty()) shard.resize(LanguageMap::capacity());  // Every ID intern() can return
+    LanguageId language = file.language();
+    if (language == LanguageMap::OTHER) {                      // Same fallback as the language statistics
+        const LanguageInfo* info = LanguageMap::find(file.name());
+        if (info) language = info->language;
+    }
+    add(shard[language], counts);
+    add(directory_shards[worker][file.file.dir], counts);
+}
+
+// Sum the shards in worker order, then rank directories by their number of markers
+void DebtMarkersModule::merge() {
+    language_counts.assign(LanguageMap::capacity(), MarkerCounts{});
+    total = {};
+    std::unordered_map<const DirHandle*, MarkerCounts> merged;
+    for (size_t worker = 0; worker < shards.size(); ++worker) {
+        const std::vector<MarkerCounts>& shard = shards[worker];
+        for (size_t id = 0; id < shard.size(); ++id) {
+            add(language_counts[id], shard[id]);
+            add(total, shard[id]);
+        }
+        for (const auto& [dir, counts] : directory_shards[worker]) add(merged[dir], counts);
+    }
+    directory_counts.clear();
+    for (const auto& [dir, counts] : merged) directory_counts.emplace_back(dir->path().string(), counts);
+    std::sort(directory_counts.begin(), directory_counts.end(), [](const auto& a, const auto& b) {
+        size_t left = sum(a.second), right = sum(b.second);
+        return left != right ? left > right : a.first < b.first;
+    });
+}
+
+void DebtMarkersModule::print_stats() const {
+    std::vector<std::pair<std::string, std::string>> items;
+    for (size_t i = 0; i < markers.size(); ++i) {
+        items.emplace_back(std::string(markers.tag(i)), OutputFormatter::format_large_number(total[i]));
+    }
+    OutputFormatter::print_section("Debt Markers", "⚑", items);
+    if (!sum(total)) return;
+
+    std::vector<size_t> ids;  // Languages with any marker, most first
+    for (size_t id = 0; id < language_counts.size(); ++id) {
+        if (sum(language_counts[id])) ids.push_back(id);
+    }
+    std::sort(ids.begin(), ids.end(), [this](size_t a, size_t b) {  // Ties by name, as directories
+        size_t left = sum(language_counts[a]), right = sum(language_counts[b]);
+        return left != right ? left > right
+            : LanguageMap::name_of(static_cast<LanguageId>(a)) < LanguageMap::name_of(static_cast<LanguageId>(b));
+    });
+    if (ids.size() > languages_count) ids.resize(languages_count);
+
+    items.clear();
+    for (size_t id : ids) {
+        std::string name(LanguageMap::name_of(static_cast<LanguageId>(id)));
+        items.emplace_back(OutputFormatter::truncate(name, 10), summary(language_counts[id]));
+    }
+    OutputFormatter::print_section("Markers by Language", "⚑", items);
+
+    items.clear();
+    for (size_t i = 0; i < directory_counts.size() && i < directories_count; ++i) {
+        items.emplace_back(directory_counts[i].first, summary(directory_counts[i].second));
+    }
+    OutputFormatter::print_section("Markers by Directory", "⚑", items);
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "codefetch_module_interface.hpp"
+#include "../src/marker_set.hpp"
+#include "../src/sharded.hpp"
+
+class DebtMarkersModule : public CodeFetchModule {  // TODO, FIXME, HACK... per language and directory
+private:
+    const MarkerSet& markers;                   // Tags, in the order of MarkerCounts
+    Sharded<std::vector<MarkerCounts>> shards;  // Per worker: per LanguageId, sized on first use
+    Sharded<std::unordered_map<const DirHandle*, MarkerCounts>> directory_shards;  // Per worker: by parent directory
+    std::vector<MarkerCounts> language_counts;  // Merged per LanguageId, valid after merge()
+    std::vector<std::pair<std::string, MarkerCounts>> directory_counts;  // Merged, most markers first
+    MarkerCounts total{};
+    size_t languages_count;                     // Languages listed, most markers first
+    size_t directories_count;                   // Directories listed, most markers first
+
+    std::string summary(const MarkerCounts& counts) const;
+
+public:
+    DebtMarkersModule(const MarkerSet& markers, size_t languages_count, size_t directories_count);
+    FileAccess access() const override { return FileAccess::Lines; }  // Counted in the line counting pass
+    void prepare(size_t workers) override {
+        shards.resize(workers);
+        directory_shards.resize(workers);
+    }
+    void process_file(const FileView& file, size_t worker) override;
+    void merge() override;
+    void print_stats() const override;
+};
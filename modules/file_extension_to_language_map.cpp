@@ -1,1486 +1,1512 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+#include <deque>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+
 #include "file_extension_to_language_map.hpp"
 
+namespace {
+    struct Source {                     // One row as written below
+        std::string_view key;           // Lowercase ".ext", or an exact file name without a leading dot
+        std::string_view name;
+        std::string_view description;
+        std::string_view category{};    // Left out by some rows
+    };
 
-const std::unordered_map<std::string, LanguageInfo> extension_to_language  = {
+    constexpr Source sources[] = {
     // C AND C++ FAMILY
-    {".c", {"C", "System-level programming language designed for efficiency and hardware access", "General-Purpose"}},
-    {".cpp", {"C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"}},
-    {".cxx", {"C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"}},
-    {".cc", {"C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"}},
-    {".c++", {"C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"}},
-    {".cp", {"C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"}},
-    {".h", {"C/C++ Header", "Header file containing declarations for C/C++ code", "General-Purpose"}},
-    {".hpp", {"C++ Header", "Header file containing declarations for C++ code", "General-Purpose"}},
-    {".hxx", {"C++ Header", "Header file containing declarations for C++ code", "General-Purpose"}},
-    {".hh", {"C++ Header", "Header file containing declarations for C++ code", "General-Purpose"}},
-    {".h++", {"C++ Header", "Header file containing declarations for C++ code", "General-Purpose"}},
-    {".hp", {"C++ Header", "Header file containing declarations for C++ code", "General-Purpose"}},
-    {".tcc", {"C++ Template Implementation", "C++ template implementation file", "General-Purpose"}},
-    {".inl", {"C++ Inline", "Inline implementation file for C++", "General-Purpose"}},
-    {".inc", {"C/C++ Include", "Include file for C/C++", "General-Purpose"}},
-    {".i", {"C Preprocessed", "Preprocessed C source code", "General-Purpose"}},
-    {".ii", {"C++ Preprocessed", "Preprocessed C++ source code", "General-Purpose"}},
-    {".pch", {"Precompiled Header", "Precompiled header file for C/C++", "General-Purpose"}},
-    {".tpp", {"C++ Template", "Template implementation file for C++", "General-Purpose"}},
-    {".cu", {"CUDA C++", "NVIDIA's extension of C++ for GPU parallel processing", "Domain-Specific"}},
-    {".cuh", {"CUDA C++ Header", "Header file for NVIDIA CUDA C++ GPU code", "Domain-Specific"}},
-    {".c11", {"C11", "C language standard from 2011", "General-Purpose"}},
-    {".c18", {"C18", "C language standard from 2018", "General-Purpose"}},
-    {".icc", {"Intel C++", "Intel-specific C++ code", "General-Purpose"}},
-    {".ipp", {"Intel C++ Header", "Intel-specific C++ header", "General-Purpose"}},
+    {".c", "C", "System-level programming language designed for efficiency and hardware access", "General-Purpose"},
+    {".cpp", "C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"},
+    {".cxx", "C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"},
+    {".cc", "C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"},
+    {".c++", "C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"},
+    {".cp", "C++", "High-performance object-oriented language extending C with classes and templates", "General-Purpose"},
+    {".h", "C/C++ Header", "Header file containing declarations for C/C++ code", "General-Purpose"},
+    {".hpp", "C++ Header", "Header file containing declarations for C++ code", "General-Purpose"},
+    {".hxx", "C++ Header", "Header file containing declarations for C++ code", "General-Purpose"},
+    {".hh", "C++ Header", "Header file containing declarations for C++ code", "General-Purpose"},
+    {".h++", "C++ Header", "Header file containing declarations for C++ code", "General-Purpose"},
+    {".hp", "C++ Header", "Header file containing declarations for C++ code", "General-Purpose"},
+    {".tcc", "C++ Template Implementation", "C++ template implementation file", "General-Purpose"},
+    {".inl", "C++ Inline", "Inline implementation file for C++", "General-Purpose"},
+    {".inc", "C/C++ Include", "Include file for C/C++", "General-Purpose"},
+    {".i", "C Preprocessed", "Preprocessed C source code", "General-Purpose"},
+    {".ii", "C++ Preprocessed", "Preprocessed C++ source code", "General-Purpose"},
+    {".pch", "Precompiled Header", "Precompiled header file for C/C++", "General-Purpose"},
+    {".tpp", "C++ Template", "Template implementation file for C++", "General-Purpose"},
+    {".cu", "CUDA C++", "NVIDIA's extension of C++ for GPU parallel processing", "Domain-Specific"},
+    {".cuh", "CUDA C++ Header", "Header file for NVIDIA CUDA C++ GPU code", "Domain-Specific"},
+    {".c11", "C11", "C language standard from 2011", "General-Purpose"},
+    {".c18", "C18", "C language standard from 2018", "General-Purpose"},
+    {".icc", "Intel C++", "Intel-specific C++ code", "General-Purpose"},
+    {".ipp", "Intel C++ Header", "Intel-specific C++ header", "General-Purpose"},
 
     // C# AND .NET ECOSYSTEM
-    {".cs", {"C#", "Modern object-oriented language for the .NET platform", "General-Purpose"}},
-    {".csproj", {"C# Project", "XML-based project file for C#/.NET applications", "Configuration"}},
-    {".sln", {"Solution", "Visual Studio solution file", "Configuration"}},
-    {".vb", {"Visual Basic", "High-level language for RAD development in the .NET framework", "General-Purpose"}},
-    {".vbproj", {"Visual Basic Project", "XML-based project file for Visual Basic/.NET applications", "Configuration"}},
-    {".fs", {"F#", "Functional-first language for the .NET platform with strong type inference", "General-Purpose"}},
-    {".fsproj", {"F# Project", "XML-based project file for F#/.NET applications", "Configuration"}},
-    {".fsx", {"F# Script", "Script file for the F# functional programming language", "Scripting"}},
-    {".fsi", {"F# Signature", "Interface file for F# modules", "General-Purpose"}},
-    {".fsscript", {"F# Script", "Script file for the F# programming language", "Scripting"}},
-    {".fsl", {"F# Lexer", "F# lexical analyzer specification", "Domain-Specific"}},
-    {".fsy", {"F# Parser", "F# parser specification", "Domain-Specific"}},
-    {".xaml", {"XAML", "Declarative XML-based language for creating UI in .NET applications", "Markup"}},
-    {".xamlx", {"XAML Workflow", "XAML file for Windows Workflow Foundation", "Markup"}},
-    {".aspx", {"ASP.NET", "Server-side web technology for dynamic web page development on .NET", "Markup"}},
-    {".ascx", {"ASP.NET User Control", "Reusable UI component for ASP.NET web applications", "Markup"}},
-    {".asax", {"ASP.NET Global Application", "Event handler file for ASP.NET application lifecycle events", "Scripting"}},
-    {".ashx", {"ASP.NET Handler", "Custom HTTP handler for ASP.NET applications", "Scripting"}},
-    {".asmx", {"ASP.NET Web Service", "ASP.NET web service file", "Scripting"}},
-    {".axd", {"ASP.NET Handler", "HTTP handler for ASP.NET applications", "Scripting"}},
-    {".cshtml", {"Razor", "C#-based template syntax for ASP.NET MVC views", "Markup"}},
-    {".vbhtml", {"Visual Basic HTML", "VB.NET-based template syntax for ASP.NET MVC views", "Markup"}},
-    {".sitemap", {"ASP.NET Sitemap", "XML sitemap for ASP.NET applications", "Configuration"}},
-    {".master", {"ASP.NET Master Page", "Master page template for ASP.NET", "Markup"}},
-    {".resx", {".NET Resources", "Resource file for .NET applications", "Configuration"}},
-    {".resources", {".NET Resources Binary", "Compiled .NET resource file", "Configuration"}},
-    {".designer.cs", {"C# Designer", "Auto-generated C# designer code", "General-Purpose"}},
-    {".designer.vb", {"VB Designer", "Auto-generated VB designer code", "General-Purpose"}},
-    {".il", {"IL", "Intermediate Language for .NET", "General-Purpose"}},
-    {".dll.config", {".NET DLL Config", "Configuration for .NET assemblies", "Configuration"}},
-    {".exe.config", {".NET Executable Config", "Configuration for .NET executables", "Configuration"}},
-    {".web.config", {"ASP.NET Configuration", "Configuration file for ASP.NET applications", "Configuration"}},
-    {".app.config", {".NET Application Config", "Configuration file for .NET applications", "Configuration"}},
+    {".cs", "C#", "Modern object-oriented language for the .NET platform", "General-Purpose"},
+    {".csproj", "C# Project", "XML-based project file for C#/.NET applications", "Configuration"},
+    {".sln", "Solution", "Visual Studio solution file", "Configuration"},
+    {".vb", "Visual Basic", "High-level language for RAD development in the .NET framework", "General-Purpose"},
+    {".vbproj", "Visual Basic Project", "XML-based project file for Visual Basic/.NET applications", "Configuration"},
+    {".fs", "F#", "Functional-first language for the .NET platform with strong type inference", "General-Purpose"},
+    {".fsproj", "F# Project", "XML-based project file for F#/.NET applications", "Configuration"},
+    {".fsx", "F# Script", "Script file for the F# functional programming language", "Scripting"},
+    {".fsi", "F# Signature", "Interface file for F# modules", "General-Purpose"},
+    {".fsscript", "F# Script", "Script file for the F# programming language", "Scripting"},
+    {".fsl", "F# Lexer", "F# lexical analyzer specification", "Domain-Specific"},
+    {".fsy", "F# Parser", "F# parser specification", "Domain-Specific"},
+    {".xaml", "XAML", "Declarative XML-based language for creating UI in .NET applications", "Markup"},
+    {".xamlx", "XAML Workflow", "XAML file for Windows Workflow Foundation", "Markup"},
+    {".aspx", "ASP.NET", "Server-side web technology for dynamic web page development on .NET", "Markup"},
+    {".ascx", "ASP.NET User Control", "Reusable UI component for ASP.NET web applications", "Markup"},
+    {".asax", "ASP.NET Global Application", "Event handler file for ASP.NET application lifecycle events", "Scripting"},
+    {".ashx", "ASP.NET Handler", "Custom HTTP handler for ASP.NET applications", "Scripting"},
+    {".asmx", "ASP.NET Web Service", "ASP.NET web service file", "Scripting"},
+    {".axd", "ASP.NET Handler", "HTTP handler for ASP.NET applications", "Scripting"},
+    {".cshtml", "Razor", "C#-based template syntax for ASP.NET MVC views", "Markup"},
+    {".vbhtml", "Visual Basic HTML", "VB.NET-based template syntax for ASP.NET MVC views", "Markup"},
+    {".sitemap", "ASP.NET Sitemap", "XML sitemap for ASP.NET applications", "Configuration"},
+    {".master", "ASP.NET Master Page", "Master page template for ASP.NET", "Markup"},
+    {".resx", ".NET Resources", "Resource file for .NET applications", "Configuration"},
+    {".resources", ".NET Resources Binary", "Compiled .NET resource file", "Configuration"},
+    {".designer.cs", "C# Designer", "Auto-generated C# designer code", "General-Purpose"},
+    {".designer.vb", "VB Designer", "Auto-generated VB designer code", "General-Purpose"},
+    {".il", "IL", "Intermediate Language for .NET", "General-Purpose"},
+    {".dll.config", ".NET DLL Config", "Configuration for .NET assemblies", "Configuration"},
+    {".exe.config", ".NET Executable Config", "Configuration for .NET executables", "Configuration"},
+    {".web.config", "ASP.NET Configuration", "Configuration file for ASP.NET applications", "Configuration"},
+    {".app.config", ".NET Application Config", "Configuration file for .NET applications", "Configuration"},
 
     // PYTHON AND RELATED
-    {".py", {"Python", "High-level, general-purpose programming language with dynamic typing", "General-Purpose"}},
-    {".pyi", {"Python Interface", "Python interface file for type hints", "General-Purpose"}},
-    {".pyc", {"Python Compiled", "Compiled Python bytecode file", "General-Purpose"}},
-    {".pyd", {"Python DLL", "Python dynamic link library", "General-Purpose"}},
-    {".pyo", {"Python Optimized", "Optimized Python bytecode file", "General-Purpose"}},
-    {".pyw", {"Python Windows", "Python file for Windows that doesn't show console", "General-Purpose"}},
-    {".pyx", {"Cython", "Python with C-like extensions for performance optimization", "General-Purpose"}},
-    {".pxd", {"Cython", "Declaration file for Cython modules", "General-Purpose"}},
-    {".pxi", {"Cython", "Include file for Cython code", "General-Purpose"}},
-    {".so", {"Shared Object", "Shared library file (including Python extensions)", "General-Purpose"}},
-    {".egg", {"Python Egg", "Python distribution format", "Configuration"}},
-    {".egg-info", {"Python Egg Info", "Metadata for Python packages", "Configuration"}},
-    {".whl", {"Python Wheel", "Built package format for Python", "Configuration"}},
-    {".ipynb", {"Jupyter Notebook", "Interactive document for data analysis and visualization with Python", "Markup"}},
-    {".ipynb_checkpoints", {"Jupyter Checkpoints", "Checkpoint files for Jupyter notebooks", "Configuration"}},
-    {".requirements.txt", {"Python Requirements", "Package dependencies for Python projects", "Configuration"}},
-    {".pipfile", {"Pipfile", "Python dependency specification file", "Configuration"}},
-    {".pipfile.lock", {"Pipfile Lock", "Locked dependencies for Python projects", "Configuration"}},
-    {".pyproject.toml", {"Python Project", "Project configuration for Python packages", "Configuration"}},
-    {".pythonrc", {"Python Runtime Config", "Python runtime configuration", "Configuration"}},
-    {".python-version", {"Python Version", "Python version specification for pyenv", "Configuration"}},
-    {".pyvenv.cfg", {"Python venv Config", "Configuration for Python virtual environments", "Configuration"}},
-    {".pypirc", {"PyPI Config", "Configuration file for Python Package Index", "Configuration"}},
-    {".pytest_cache", {"Pytest Cache", "Cache directory for pytest", "Configuration"}},
-    {".ruff_cache", {"Ruff Cache", "Cache directory for Ruff linter", "Configuration"}},
-    {".coverage", {"Coverage", "Python test coverage data file", "Configuration"}},
-    {".tox", {"Tox", "Python testing automation directory", "Configuration"}},
-    {".nox", {"Nox", "Python testing automation directory", "Configuration"}},
+    {".py", "Python", "High-level, general-purpose programming language with dynamic typing", "General-Purpose"},
+    {".pyi", "Python Interface", "Python interface file for type hints", "General-Purpose"},
+    {".pyc", "Python Compiled", "Compiled Python bytecode file", "General-Purpose"},
+    {".pyd", "Python DLL", "Python dynamic link library", "General-Purpose"},
+    {".pyo", "Python Optimized", "Optimized Python bytecode file", "General-Purpose"},
+    {".pyw", "Python Windows", "Python file for Windows that doesn't show console", "General-Purpose"},
+    {".pyx", "Cython", "Python with C-like extensions for performance optimization", "General-Purpose"},
+    {".pxd", "Cython", "Declaration file for Cython modules", "General-Purpose"},
+    {".pxi", "Cython", "Include file for Cython code", "General-Purpose"},
+    {".so", "Shared Object", "Shared library file (including Python extensions)", "General-Purpose"},
+    {".egg", "Python Egg", "Python distribution format", "Configuration"},
+    {".egg-info", "Python Egg Info", "Metadata for Python packages", "Configuration"},
+    {".whl", "Python Wheel", "Built package format for Python", "Configuration"},
+    {".ipynb", "Jupyter Notebook", "Interactive document for data analysis and visualization with Python", "Markup"},
+    {".ipynb_checkpoints", "Jupyter Checkpoints", "Checkpoint files for Jupyter notebooks", "Configuration"},
+    {".requirements.txt", "Python Requirements", "Package dependencies for Python projects", "Configuration"},
+    {".pipfile", "Pipfile", "Python dependency specification file", "Configuration"},
+    {".pipfile.lock", "Pipfile Lock", "Locked dependencies for Python projects", "Configuration"},
+    {".pyproject.toml", "Python Project", "Project configuration for Python packages", "Configuration"},
+    {".pythonrc", "Python Runtime Config", "Python runtime configuration", "Configuration"},
+    {".python-version", "Python Version", "Python version specification for pyenv", "Configuration"},
+    {".pyvenv.cfg", "Python venv Config", "Configuration for Python virtual environments", "Configuration"},
+    {".pypirc", "PyPI Config", "Configuration file for Python Package Index", "Configuration"},
+    {".pytest_cache", "Pytest Cache", "Cache directory for pytest", "Configuration"},
+    {".ruff_cache", "Ruff Cache", "Cache directory for Ruff linter", "Configuration"},
+    {".coverage", "Coverage", "Python test coverage data file", "Configuration"},
+    {".tox", "Tox", "Python testing automation directory", "Configuration"},
+    {".nox", "Nox", "Python testing automation directory", "Configuration"},
 
     // JAVA AND JVM LANGUAGES
-    {".java", {"Java", "Object-oriented language running on the JVM with strong typing and memory management", "General-Purpose"}},
-    {".class", {"Java Class", "Compiled Java bytecode file", "General-Purpose"}},
-    {".jar", {"Java Archive", "Packaged Java application or library", "General-Purpose"}},
-    {".war", {"Web Archive", "Java web application archive", "General-Purpose"}},
-    {".ear", {"Enterprise Archive", "Java enterprise application archive", "General-Purpose"}},
-    {".jmod", {"Java Module", "Java module file introduced in Java 9", "General-Purpose"}},
-    {".jnlp", {"Java Web Start", "Java Network Launch Protocol file", "Configuration"}},
-    {".jsp", {"Java Server Pages", "Technology for creating dynamic web content with Java", "Markup"}},
-    {".jspf", {"JSP Fragment", "Fragment of JSP code for inclusion", "Markup"}},
-    {".jspx", {"JSP XML", "XML-based JSP file", "Markup"}},
-    {".tag", {"JSP Tag File", "Reusable JSP tag", "Markup"}},
-    {".tagx", {"JSP Tag XML", "XML-based JSP tag file", "Markup"}},
-    {".tld", {"Tag Library Descriptor", "XML file defining JSP tag library", "Configuration"}},
-    {".faces", {"JavaServer Faces", "JavaServer Faces component", "Markup"}},
-    {".xhtml", {"XHTML", "XML-based HTML with JSF support", "Markup"}},
-    {".properties", {"Properties", "Java property file with key-value pairs", "Configuration"}},
-    {".groovy", {"Groovy", "Dynamic language for the JVM adding scripting capabilities to Java", "General-Purpose"}},
-    {".gvy", {"Groovy", "Dynamic language for the JVM adding scripting capabilities to Java", "General-Purpose"}},
-    {".gy", {"Groovy", "Dynamic language for the JVM adding scripting capabilities to Java", "General-Purpose"}},
-    {".gsh", {"Groovy Shell", "Script for the Groovy shell environment", "Scripting"}},
-    {".gradle", {"Gradle", "Build automation system using Groovy DSL", "Scripting"}},
-    {".gradlew", {"Gradle Wrapper", "Gradle wrapper script", "Scripting"}},
-    {".kt", {"Kotlin", "Modern JVM language with null safety and functional capabilities", "General-Purpose"}},
-    {".kts", {"Kotlin Script", "Script file for the Kotlin programming language", "Scripting"}},
-    {".ktm", {"Kotlin Module", "Module definition file for Kotlin", "Configuration"}},
-    {".scala", {"Scala", "JVM language blending object-oriented and functional programming", "General-Purpose"}},
-    {".sc", {"Scala Script", "Script file for the Scala programming language", "Scripting"}},
-    {".sbt", {"SBT", "Scala-based build tool for Scala and Java projects", "Scripting"}},
-    {".clj", {"Clojure", "Functional Lisp dialect running on the JVM", "General-Purpose"}},
-    {".cljs", {"ClojureScript", "Clojure compiled to JavaScript for web development", "General-Purpose"}},
-    {".cljc", {"Clojure Common", "Clojure code that targets multiple platforms", "General-Purpose"}},
-    {".edn", {"Extensible Data Notation", "Clojure/EDN data format", "Configuration"}},
-    {".joule", {"Joule", "JVM-based language for IoT development", "Domain-Specific"}},
-    {".mirah", {"Mirah", "JVM language with Ruby-like syntax and static typing", "General-Purpose"}},
-    {".ceylon", {"Ceylon", "JVM language focusing on readability and predictability", "General-Purpose"}},
-    {".javacc", {"JavaCC", "Java Compiler Compiler grammar file", "Domain-Specific"}},
-    {".jjt", {"JJTree", "JavaCC tree builder file", "Domain-Specific"}},
-    {".jjtree", {"JJTree", "JavaCC tree builder file", "Domain-Specific"}},
-    {".jj", {"JavaCC", "JavaCC grammar file", "Domain-Specific"}},
-    {".mvn", {"Maven", "Maven build tool directory", "Configuration"}},
-    {".pom", {"Maven POM", "Project Object Model for Maven", "Configuration"}},
-    {".pom.xml", {"Maven POM", "Project Object Model for Maven", "Configuration"}},
-    {".iml", {"IntelliJ Module", "IntelliJ IDEA module file", "Configuration"}},
-    {".aidl", {"Android Interface Definition", "Android Interface Definition Language file", "Domain-Specific"}},
+    {".java", "Java", "Object-oriented language running on the JVM with strong typing and memory management", "General-Purpose"},
+    {".class", "Java Class", "Compiled Java bytecode file", "General-Purpose"},
+    {".jar", "Java Archive", "Packaged Java application or library", "General-Purpose"},
+    {".war", "Web Archive", "Java web application archive", "General-Purpose"},
+    {".ear", "Enterprise Archive", "Java enterprise application archive", "General-Purpose"},
+    {".jmod", "Java Module", "Java module file introduced in Java 9", "General-Purpose"},
+    {".jnlp", "Java Web Start", "Java Network Launch Protocol file", "Configuration"},
+    {".jsp", "Java Server Pages", "Technology for creating dynamic web content with Java", "Markup"},
+    {".jspf", "JSP Fragment", "Fragment of JSP code for inclusion", "Markup"},
+    {".jspx", "JSP XML", "XML-based JSP file", "Markup"},
+    {".tag", "JSP Tag File", "Reusable JSP tag", "Markup"},
+    {".tagx", "JSP Tag XML", "XML-based JSP tag file", "Markup"},
+    {".tld", "Tag Library Descriptor", "XML file defining JSP tag library", "Configuration"},
+    {".faces", "JavaServer Faces", "JavaServer Faces component", "Markup"},
+    {".xhtml", "XHTML", "XML-based HTML with JSF support", "Markup"},
+    {".properties", "Properties", "Java property file with key-value pairs", "Configuration"},
+    {".groovy", "Groovy", "Dynamic language for the JVM adding scripting capabilities to Java", "General-Purpose"},
+    {".gvy", "Groovy", "Dynamic language for the JVM adding scripting capabilities to Java", "General-Purpose"},
+    {".gy", "Groovy", "Dynamic language for the JVM adding scripting capabilities to Java", "General-Purpose"},
+    {".gsh", "Groovy Shell", "Script for the Groovy shell environment", "Scripting"},
+    {".gradle", "Gradle", "Build automation system using Groovy DSL", "Scripting"},
+    {".gradlew", "Gradle Wrapper", "Gradle wrapper script", "Scripting"},
+    {".kt", "Kotlin", "Modern JVM language with null safety and functional capabilities", "General-Purpose"},
+    {".kts", "Kotlin Script", "Script file for the Kotlin programming language", "Scripting"},
+    {".ktm", "Kotlin Module", "Module definition file for Kotlin", "Configuration"},
+    {".scala", "Scala", "JVM language blending object-oriented and functional programming", "General-Purpose"},
+    {".sc", "Scala Script", "Script file for the Scala programming language", "Scripting"},
+    {".sbt", "SBT", "Scala-based build tool for Scala and Java projects", "Scripting"},
+    {".clj", "Clojure", "Functional Lisp dialect running on the JVM", "General-Purpose"},
+    {".cljs", "ClojureScript", "Clojure compiled to JavaScript for web development", "General-Purpose"},
+    {".cljc", "Clojure Common", "Clojure code that targets multiple platforms", "General-Purpose"},
+    {".edn", "Extensible Data Notation", "Clojure/EDN data format", "Configuration"},
+    {".joule", "Joule", "JVM-based language for IoT development", "Domain-Specific"},
+    {".mirah", "Mirah", "JVM language with Ruby-like syntax and static typing", "General-Purpose"},
+    {".ceylon", "Ceylon", "JVM language focusing on readability and predictability", "General-Purpose"},
+    {".javacc", "JavaCC", "Java Compiler Compiler grammar file", "Domain-Specific"},
+    {".jjt", "JJTree", "JavaCC tree builder file", "Domain-Specific"},
+    {".jjtree", "JJTree", "JavaCC tree builder file", "Domain-Specific"},
+    {".jj", "JavaCC", "JavaCC grammar file", "Domain-Specific"},
+    {".mvn", "Maven", "Maven build tool directory", "Configuration"},
+    {".pom", "Maven POM", "Project Object Model for Maven", "Configuration"},
+    {".pom.xml", "Maven POM", "Project Object Model for Maven", "Configuration"},
+    {".iml", "IntelliJ Module", "IntelliJ IDEA module file", "Configuration"},
+    {".aidl", "Android Interface Definition", "Android Interface Definition Language file", "Domain-Specific"},
 
     // JAVASCRIPT AND WEB FRONTEND
-    {".js", {"JavaScript", "Dynamic scripting language for web browsers and Node.js environments", "General-Purpose"}},
-    {".jsx", {"JavaScript JSX", "JavaScript extension for React with XML-like syntax for UI components", "General-Purpose"}},
-    {".mjs", {"JavaScript Module", "JavaScript file using ECMAScript modules", "General-Purpose"}},
-    {".cjs", {"JavaScript CommonJS", "JavaScript file using CommonJS modules", "General-Purpose"}},
-    {".es", {"ECMAScript", "ECMAScript module file", "General-Purpose"}},
-    {".es6", {"ECMAScript 6", "ECMAScript 2015 module file", "General-Purpose"}},
-    {".jsm", {"JavaScript Module", "JavaScript module for Firefox extensions", "General-Purpose"}},
-    {".jscad", {"JavaScript CAD", "JavaScript for 3D CAD modeling", "Domain-Specific"}},
-    {".jsfl", {"JavaScript Flash", "JavaScript for Flash authoring tools", "Domain-Specific"}},
-    {".jslib", {"JavaScript Library", "JavaScript library file", "General-Purpose"}},
-    {".jsfl", {"JavaScript Flash", "JavaScript for Adobe Flash", "Domain-Specific"}},
-    {".pac", {"Proxy Auto-Config", "JavaScript for proxy configuration", "Scripting"}},
-    {".ts", {"TypeScript", "JavaScript superset adding static typing and class-based OOP", "General-Purpose"}},
-    {".tsx", {"TypeScript JSX", "TypeScript with JSX support for React component development", "General-Purpose"}},
-    {".d.ts", {"TypeScript Definition", "Type definition file for TypeScript libraries", "Configuration"}},
-    {".cts", {"TypeScript CommonJS", "TypeScript file using CommonJS modules", "General-Purpose"}},
-    {".mts", {"TypeScript Module", "TypeScript file using ECMAScript modules", "General-Purpose"}},
-    {".vue", {"Vue", "Single-file component for the Vue.js framework", "Markup"}},
-    {".svelte", {"Svelte", "Component file for the Svelte compiler-based UI framework", "Markup"}},
-    {".astro", {"Astro", "Component for the Astro web framework", "Markup"}},
-    {".coffee", {"CoffeeScript", "Language that transpiles to JavaScript with simplified syntax", "General-Purpose"}},
-    {".litcoffee", {"Literate CoffeeScript", "CoffeeScript written in a Markdown-like format", "Markup"}},
-    {".ls", {"LiveScript", "Language that transpiles to JavaScript with functional programming features", "General-Purpose"}},
-    {".elm", {"Elm", "Functional language for web applications with strong type safety", "General-Purpose"}},
-    {".imba", {"Imba", "Programming language for web development with built-in UI", "General-Purpose"}},
-    {".sjs", {"StratifiedJS", "JavaScript extension for asynchronous programming", "General-Purpose"}},
-    {".hx", {"Haxe", "Cross-platform language that compiles to JavaScript and other targets", "General-Purpose"}},
-    {".dart", {"Dart", "Client-optimized language for fast apps on multiple platforms", "General-Purpose"}},
-    {".gs", {"GScript", "JavaScript dialect used in Google Apps Script", "Scripting"}},
-    {".gss", {"Google Style Sheets", "CSS extension used by Google", "Markup"}},
-    {".jake", {"Jake", "JavaScript build tool file", "Scripting"}},
-    {".jscad", {"JavaScript CAD", "JavaScript for programmatic 3D CAD", "Domain-Specific"}},
+    {".js", "JavaScript", "Dynamic scripting language for web browsers and Node.js environments", "General-Purpose"},
+    {".jsx", "JavaScript JSX", "JavaScript extension for React with XML-like syntax for UI components", "General-Purpose"},
+    {".mjs", "JavaScript Module", "JavaScript file using ECMAScript modules", "General-Purpose"},
+    {".cjs", "JavaScript CommonJS", "JavaScript file using CommonJS modules", "General-Purpose"},
+    {".es", "ECMAScript", "ECMAScript module file", "General-Purpose"},
+    {".es6", "ECMAScript 6", "ECMAScript 2015 module file", "General-Purpose"},
+    {".jsm", "JavaScript Module", "JavaScript module for Firefox extensions", "General-Purpose"},
+    {".jscad", "JavaScript CAD", "JavaScript for 3D CAD modeling", "Domain-Specific"},
+    {".jsfl", "JavaScript Flash", "JavaScript for Flash authoring tools", "Domain-Specific"},
+    {".jslib", "JavaScript Library", "JavaScript library file", "General-Purpose"},
+    {".pac", "Proxy Auto-Config", "JavaScript for proxy configuration", "Scripting"},
+    {".ts", "TypeScript", "JavaScript superset adding static typing and class-based OOP", "General-Purpose"},
+    {".tsx", "TypeScript JSX", "TypeScript with JSX support for React component development", "General-Purpose"},
+    {".d.ts", "TypeScript Definition", "Type definition file for TypeScript libraries", "Configuration"},
+    {".cts", "TypeScript CommonJS", "TypeScript file using CommonJS modules", "General-Purpose"},
+    {".mts", "TypeScript Module", "TypeScript file using ECMAScript modules", "General-Purpose"},
+    {".vue", "Vue", "Single-file component for the Vue.js framework", "Markup"},
+    {".svelte", "Svelte", "Component file for the Svelte compiler-based UI framework", "Markup"},
+    {".astro", "Astro", "Component for the Astro web framework", "Markup"},
+    {".coffee", "CoffeeScript", "Language that transpiles to JavaScript with simplified syntax", "General-Purpose"},
+    {".litcoffee", "Literate CoffeeScript", "CoffeeScript written in a Markdown-like format", "Markup"},
+    {".ls", "LiveScript", "Language that transpiles to JavaScript with functional programming features", "General-Purpose"},
+    {".elm", "Elm", "Functional language for web applications with strong type safety", "General-Purpose"},
+    {".imba", "Imba", "Programming language for web development with built-in UI", "General-Purpose"},
+    {".sjs", "StratifiedJS", "JavaScript extension for asynchronous programming", "General-Purpose"},
+    {".hx", "Haxe", "Cross-platform language that compiles to JavaScript and other targets", "General-Purpose"},
+    {".dart", "Dart", "Client-optimized language for fast apps on multiple platforms", "General-Purpose"},
+    {".gs", "GScript", "JavaScript dialect used in Google Apps Script", "Scripting"},
+    {".gss", "Google Style Sheets", "CSS extension used by Google", "Markup"},
+    {".jake", "Jake", "JavaScript build tool file", "Scripting"},
 
     // WEB PACKAGES AND TOOLS
-    {".npm", {"NPM", "Node Package Manager directory", "Configuration"}},
-    {".npmrc", {"NPM Config", "NPM configuration file", "Configuration"}},
-    {".package.json", {"NPM Package", "NPM package definition", "Configuration"}},
-    {".package-lock.json", {"NPM Lock", "NPM dependency lock file", "Configuration"}},
-    {".yarn", {"Yarn", "Yarn package manager directory", "Configuration"}},
-    {".yarnrc", {"Yarn Config", "Yarn configuration file", "Configuration"}},
-    {".yarn.lock", {"Yarn Lock", "Yarn dependency lock file", "Configuration"}},
-    {".nvmrc", {"Node Version", "Node Version Manager specification", "Configuration"}},
-    {".node-version", {"Node Version", "Node.js version specification", "Configuration"}},
-    {".nvm", {"Node Version Manager", "NVM directory", "Configuration"}},
-    {".bower.json", {"Bower", "Bower package definition", "Configuration"}},
-    {".bowerrc", {"Bower Config", "Bower configuration file", "Configuration"}},
-    {".eslintrc", {"ESLint Config", "ESLint configuration file", "Configuration"}},
-    {".eslintignore", {"ESLint Ignore", "ESLint ignore file", "Configuration"}},
-    {".eslintcache", {"ESLint Cache", "ESLint cache file", "Configuration"}},
-    {".prettierrc", {"Prettier Config", "Prettier configuration file", "Configuration"}},
-    {".prettierignore", {"Prettier Ignore", "Prettier ignore file", "Configuration"}},
-    {".babelrc", {"Babel Config", "Babel configuration file", "Configuration"}},
-    {".babel.config.js", {"Babel Config", "Babel configuration file", "Configuration"}},
-    {".browserlistrc", {"Browserlist", "Browser compatibility configuration", "Configuration"}},
-    {".webpack.config.js", {"Webpack Config", "Webpack configuration file", "Configuration"}},
-    {".rollup.config.js", {"Rollup Config", "Rollup configuration file", "Configuration"}},
-    {".vite.config.js", {"Vite Config", "Vite configuration file", "Configuration"}},
-    {".postcss.config.js", {"PostCSS Config", "PostCSS configuration file", "Configuration"}},
-    {".stylelintrc", {"Stylelint Config", "Stylelint configuration file", "Configuration"}},
-    {".storybook", {"Storybook", "Storybook component explorer directory", "Configuration"}},
-    {".typedoc.json", {"TypeDoc Config", "TypeDoc documentation generator config", "Configuration"}},
-    {".turbo", {"Turborepo", "Turborepo build system directory", "Configuration"}},
+    {".npm", "NPM", "Node Package Manager directory", "Configuration"},
+    {".npmrc", "NPM Config", "NPM configuration file", "Configuration"},
+    {".package.json", "NPM Package", "NPM package definition", "Configuration"},
+    {".package-lock.json", "NPM Lock", "NPM dependency lock file", "Configuration"},
+    {".yarn", "Yarn", "Yarn package manager directory", "Configuration"},
+    {".yarnrc", "Yarn Config", "Yarn configuration file", "Configuration"},
+    {".yarn.lock", "Yarn Lock", "Yarn dependency lock file", "Configuration"},
+    {".nvmrc", "Node Version", "Node Version Manager specification", "Configuration"},
+    {".node-version", "Node Version", "Node.js version specification", "Configuration"},
+    {".nvm", "Node Version Manager", "NVM directory", "Configuration"},
+    {".bower.json", "Bower", "Bower package definition", "Configuration"},
+    {".bowerrc", "Bower Config", "Bower configuration file", "Configuration"},
+    {".eslintrc", "ESLint Config", "ESLint configuration file", "Configuration"},
+    {".eslintignore", "ESLint Ignore", "ESLint ignore file", "Configuration"},
+    {".eslintcache", "ESLint Cache", "ESLint cache file", "Configuration"},
+    {".prettierrc", "Prettier Config", "Prettier configuration file", "Configuration"},
+    {".prettierignore", "Prettier Ignore", "Prettier ignore file", "Configuration"},
+    {".babelrc", "Babel Config", "Babel configuration file", "Configuration"},
+    {".babel.config.js", "Babel Config", "Babel configuration file", "Configuration"},
+    {".browserlistrc", "Browserlist", "Browser compatibility configuration", "Configuration"},
+    {".webpack.config.js", "Webpack Config", "Webpack configuration file", "Configuration"},
+    {".rollup.config.js", "Rollup Config", "Rollup configuration file", "Configuration"},
+    {".vite.config.js", "Vite Config", "Vite configuration file", "Configuration"},
+    {".postcss.config.js", "PostCSS Config", "PostCSS configuration file", "Configuration"},
+    {".stylelintrc", "Stylelint Config", "Stylelint configuration file", "Configuration"},
+    {".storybook", "Storybook", "Storybook component explorer directory", "Configuration"},
+    {".typedoc.json", "TypeDoc Config", "TypeDoc documentation generator config", "Configuration"},
+    {".turbo", "Turborepo", "Turborepo build system directory", "Configuration"},
 
     // HTML, CSS AND WEB MARKUP
-    {".html", {"HTML", "Standard markup language for creating web pages", "Markup"}},
-    {".htm", {"HTML", "Standard markup language for creating web pages", "Markup"}},
-    {".xhtml", {"XHTML", "XML-based HTML with stricter syntax rules", "Markup"}},
-    {".shtml", {"HTML (Server-side includes)", "HTML with server-side include directives", "Markup"}},
-    {".dhtml", {"Dynamic HTML", "HTML with dynamic behavior using JavaScript and CSS", "Markup"}},
-    {".hta", {"HTML Application", "HTML application for Internet Explorer", "Markup"}},
-    {".hbs", {"Handlebars", "HTML template with Handlebars syntax", "Markup"}},
-    {".htc", {"HTML Component", "HTML component file", "Markup"}},
-    {".mht", {"MHTML", "MIME HTML archive format", "Markup"}},
-    {".mhtml", {"MHTML", "MIME HTML archive format", "Markup"}},
-    {".ehtml", {"Embedded HTML", "HTML with embedded code", "Markup"}},
-    {".css", {"CSS", "Style sheet language for describing the presentation of HTML documents", "Markup"}},
-    {".scss", {"SCSS", "CSS preprocessor with variables, nesting, and mixins (Sass syntax)", "Markup"}},
-    {".sass", {"Sass", "CSS preprocessor with indented syntax for cleaner stylesheets", "Markup"}},
-    {".less", {"Less", "CSS preprocessor extending CSS with dynamic behavior", "Markup"}},
-    {".styl", {"Stylus", "CSS preprocessor with minimal syntax and powerful features", "Markup"}},
-    {".pcss", {"PostCSS", "CSS with PostCSS processing", "Markup"}},
-    {".postcss", {"PostCSS", "CSS with PostCSS processing", "Markup"}},
-    {".cssnext", {"CSS Next", "Future CSS syntax with polyfills", "Markup"}},
-    {".css.map", {"CSS Map", "Source map for CSS", "Configuration"}},
-    {".svg", {"SVG", "XML-based vector image format for web graphics", "Markup"}},
-    {".svgz", {"SVG Compressed", "Compressed SVG file", "Markup"}},
-    {".woff", {"Web Font", "Web Open Font Format file", "Markup"}},
-    {".woff2", {"Web Font", "Web Open Font Format 2 file", "Markup"}},
-    {".eot", {"Embedded OpenType", "Embedded OpenType font file", "Markup"}},
-    {".ttf", {"TrueType Font", "TrueType font file", "Markup"}},
-    {".otf", {"OpenType Font", "OpenType font file", "Markup"}},
-    {".webmanifest", {"Web Manifest", "Web application manifest file", "Configuration"}},
-    {".favicon.ico", {"Favicon", "Website icon file", "Markup"}},
-    {".webp", {"WebP Image", "WebP image format file", "Markup"}},
+    {".html", "HTML", "Standard markup language for creating web pages", "Markup"},
+    {".htm", "HTML", "Standard markup language for creating web pages", "Markup"},
+    {".shtml", "HTML (Server-side includes)", "HTML with server-side include directives", "Markup"},
+    {".dhtml", "Dynamic HTML", "HTML with dynamic behavior using JavaScript and CSS", "Markup"},
+    {".hta", "HTML Application", "HTML application for Internet Explorer", "Markup"},
+    {".hbs", "Handlebars", "HTML template with Handlebars syntax", "Markup"},
+    {".htc", "HTML Component", "HTML component file", "Markup"},
+    {".mht", "MHTML", "MIME HTML archive format", "Markup"},
+    {".mhtml", "MHTML", "MIME HTML archive format", "Markup"},
+    {".ehtml", "Embedded HTML", "HTML with embedded code", "Markup"},
+    {".css", "CSS", "Style sheet language for describing the presentation of HTML documents", "Markup"},
+    {".scss", "SCSS", "CSS preprocessor with variables, nesting, and mixins (Sass syntax)", "Markup"},
+    {".sass", "Sass", "CSS preprocessor with indented syntax for cleaner stylesheets", "Markup"},
+    {".less", "Less", "CSS preprocessor extending CSS with dynamic behavior", "Markup"},
+    {".styl", "Stylus", "CSS preprocessor with minimal syntax and powerful features", "Markup"},
+    {".pcss", "PostCSS", "CSS with PostCSS processing", "Markup"},
+    {".postcss", "PostCSS", "CSS with PostCSS processing", "Markup"},
+    {".cssnext", "CSS Next", "Future CSS syntax with polyfills", "Markup"},
+    {".css.map", "CSS Map", "Source map for CSS", "Configuration"},
+    {".svg", "SVG", "XML-based vector image format for web graphics", "Markup"},
+    {".svgz", "SVG Compressed", "Compressed SVG file", "Markup"},
+    {".woff", "Web Font", "Web Open Font Format file", "Markup"},
+    {".woff2", "Web Font", "Web Open Font Format 2 file", "Markup"},
+    {".eot", "Embedded OpenType", "Embedded OpenType font file", "Markup"},
+    {".ttf", "TrueType Font", "TrueType font file", "Markup"},
+    {".otf", "OpenType Font", "OpenType font file", "Markup"},
+    {".webmanifest", "Web Manifest", "Web application manifest file", "Configuration"},
+    {".favicon.ico", "Favicon", "Website icon file", "Markup"},
+    {".webp", "WebP Image", "WebP image format file", "Markup"},
 
     // WEB TEMPLATE ENGINES
-    {".twig", {"Twig", "Template engine for PHP with syntax inspired by Jinja and Django", "Markup"}},
-    {".jinja", {"Jinja", "Template engine for Python with inheritance and macros", "Markup"}},
-    {".jinja2", {"Jinja2", "Template engine for Python with inheritance and macros", "Markup"}},
-    {".j2", {"Jinja2", "Template engine for Python with inheritance and macros", "Markup"}},
-    {".haml", {"Haml", "HTML abstraction markup language for cleaner templates", "Markup"}},
-    {".pug", {"Pug", "Template engine for Node.js with indentation-based syntax", "Markup"}},
-    {".jade", {"Jade", "Predecessor to Pug template language", "Markup"}},
-    {".slim", {"Slim", "Template language for Ruby with minimal syntax", "Markup"}},
-    {".liquid", {"Liquid", "Template language for Ruby used in Shopify and Jekyll", "Markup"}},
-    {".mustache", {"Mustache", "Logic-less template system for web applications", "Markup"}},
-    {".handlebars", {"Handlebars", "Extension of Mustache templates with helpers and blocks", "Markup"}},
-    {".hbs", {"Handlebars", "Extension of Mustache templates with helpers and blocks", "Markup"}},
-    {".ejs", {"EJS", "Embedded JavaScript templates for Node.js", "Markup"}},
-    {".soy", {"Soy Template", "Google's template language for client and server rendering", "Markup"}},
-    {".ftl", {"FreeMarker", "Java-based template engine for generating text output", "Markup"}},
-    {".njk", {"Nunjucks", "JavaScript templating engine based on Jinja", "Markup"}},
-    {".blade.php", {"Blade", "Template engine for the Laravel PHP framework", "Markup"}},
-    {".cfm", {"ColdFusion", "Tag-based template language for the ColdFusion platform", "Markup"}},
-    {".cfml", {"ColdFusion", "ColdFusion Markup Language file", "Markup"}},
-    {".cfc", {"ColdFusion Component", "ColdFusion component file", "Markup"}},
-    {".tmpl", {"Go Template", "Template language used in Go's standard library", "Markup"}},
-    {".gotmpl", {"Go Template", "Template language used in Go's standard library", "Markup"}},
-    {".tpl", {"Smarty Template", "Template engine for PHP applications", "Markup"}},
-    {".rhtml", {"Ruby HTML", "Classic Ruby template format embedding Ruby in HTML", "Markup"}},
-    {".erb", {"ERB", "Embedded Ruby template system used in Rails", "Markup"}},
-    {".eex", {"Elixir EEx", "Embedded Elixir templates for web applications", "Markup"}},
-    {".heex", {"Elixir HEEx", "HTML-aware embedded Elixir templates for Phoenix Framework", "Markup"}},
-    {".leex", {"Elixir LiveEEx", "Live embedded Elixir templates", "Markup"}},
-    {".dust", {"Dust.js", "Asynchronous templating for Node.js and browsers", "Markup"}},
-    {".eco", {"Eco", "Embedded CoffeeScript templates", "Markup"}},
-    {".dot", {"doT", "Fast JavaScript template engine", "Markup"}},
-    {".ect", {"ECT", "Embedded CoffeeScript templates", "Markup"}},
-    {".kid", {"Kid", "XML-based templating language", "Markup"}},
-    {".kit", {"Kit", "Template language for HTML preprocessing", "Markup"}},
-    {".latte", {"Latte", "Template engine for PHP with context-aware escaping", "Markup"}},
-    {".plates", {"Plates", "Native PHP template system", "Markup"}},
-    {".tpl.php", {"PHP Template", "PHP template file", "Markup"}},
-    {".volt", {"Volt", "Template engine for Phalcon PHP framework", "Markup"}},
+    {".twig", "Twig", "Template engine for PHP with syntax inspired by Jinja and Django", "Markup"},
+    {".jinja", "Jinja", "Template engine for Python with inheritance and macros", "Markup"},
+    {".jinja2", "Jinja2", "Template engine for Python with inheritance and macros", "Markup"},
+    {".j2", "Jinja2", "Template engine for Python with inheritance and macros", "Markup"},
+    {".haml", "Haml", "HTML abstraction markup language for cleaner templates", "Markup"},
+    {".pug", "Pug", "Template engine for Node.js with indentation-based syntax", "Markup"},
+    {".jade", "Jade", "Predecessor to Pug template language", "Markup"},
+    {".slim", "Slim", "Template language for Ruby with minimal syntax", "Markup"},
+    {".liquid", "Liquid", "Template language for Ruby used in Shopify and Jekyll", "Markup"},
+    {".mustache", "Mustache", "Logic-less template system for web applications", "Markup"},
+    {".handlebars", "Handlebars", "Extension of Mustache templates with helpers and blocks", "Markup"},
+    {".ejs", "EJS", "Embedded JavaScript templates for Node.js", "Markup"},
+    {".soy", "Soy Template", "Google's template language for client and server rendering", "Markup"},
+    {".ftl", "FreeMarker", "Java-based template engine for generating text output", "Markup"},
+    {".njk", "Nunjucks", "JavaScript templating engine based on Jinja", "Markup"},
+    {".blade.php", "Blade", "Template engine for the Laravel PHP framework", "Markup"},
+    {".cfm", "ColdFusion", "Tag-based template language for the ColdFusion platform", "Markup"},
+    {".cfml", "ColdFusion", "ColdFusion Markup Language file", "Markup"},
+    {".cfc", "ColdFusion Component", "ColdFusion component file", "Markup"},
+    {".tmpl", "Go Template", "Template language used in Go's standard library", "Markup"},
+    {".gotmpl", "Go Template", "Template language used in Go's standard library", "Markup"},
+    {".tpl", "Smarty Template", "Template engine for PHP applications", "Markup"},
+    {".rhtml", "Ruby HTML", "Classic Ruby template format embedding Ruby in HTML", "Markup"},
+    {".erb", "ERB", "Embedded Ruby template system used in Rails", "Markup"},
+    {".eex", "Elixir EEx", "Embedded Elixir templates for web applications", "Markup"},
+    {".heex", "Elixir HEEx", "HTML-aware embedded Elixir templates for Phoenix Framework", "Markup"},
+    {".leex", "Elixir LiveEEx", "Live embedded Elixir templates", "Markup"},
+    {".dust", "Dust.js", "Asynchronous templating for Node.js and browsers", "Markup"},
+    {".eco", "Eco", "Embedded CoffeeScript templates", "Markup"},
+    {".dot", "doT", "Fast JavaScript template engine", "Markup"},
+    {".ect", "ECT", "Embedded CoffeeScript templates", "Markup"},
+    {".kid", "Kid", "XML-based templating language", "Markup"},
+    {".kit", "Kit", "Template language for HTML preprocessing", "Markup"},
+    {".latte", "Latte", "Template engine for PHP with context-aware escaping", "Markup"},
+    {".plates", "Plates", "Native PHP template system", "Markup"},
+    {".tpl.php", "PHP Template", "PHP template file", "Markup"},
+    {".volt", "Volt", "Template engine for Phalcon PHP framework", "Markup"},
 
 
     // SERVER-SIDE WEB LANGUAGES
-    {".php", {"PHP", "Server-side scripting language designed for web development", "General-Purpose"}},
-    {".php3", {"PHP", "Server-side scripting language designed for web development", "General-Purpose"}},
-    {".php4", {"PHP", "Server-side scripting language designed for web development", "General-Purpose"}},
-    {".php5", {"PHP", "Server-side scripting language designed for web development", "General-Purpose"}},
-    {".php7", {"PHP", "Server-side scripting language designed for web development", "General-Purpose"}},
-    {".phps", {"PHP Source", "PHP source with syntax highlighting", "General-Purpose"}},
-    {".phpt", {"PHP Test", "PHP unit test file", "General-Purpose"}},
-    {".phtml", {"PHP HTML", "PHP file with embedded HTML", "Markup"}},
-    {".phar", {"PHP Archive", "PHP application archive", "General-Purpose"}},
-    {".composer.json", {"Composer", "PHP dependency manager configuration", "Configuration"}},
-    {".composer.lock", {"Composer Lock", "PHP dependency lock file", "Configuration"}},
-    {".asp", {"ASP", "Microsoft's server-side script engine for dynamic web pages", "Markup"}},
-    {".aspx", {"ASP.NET", "ASP.NET web page", "Markup"}},
-    {".erb", {"ERB", "Embedded Ruby for web templates", "Markup"}},
-    {".erl", {"Erlang", "Functional language for distributed systems", "General-Purpose"}},
-    {".ex", {"Elixir", "Functional language built on Erlang VM", "General-Purpose"}},
-    {".exs", {"Elixir Script", "Elixir script file", "Scripting"}},
-    {".gs", {"Google Apps Script", "JavaScript for Google Workspace automation", "Scripting"}},
-    {".jsp", {"Java Server Pages", "Java technology for dynamic web content", "Markup"}},
-    {".pl", {"Perl", "High-level general-purpose language", "Scripting"}},
-    {".cgi", {"CGI Script", "Common Gateway Interface script", "Scripting"}},
-    {".fcgi", {"FastCGI", "FastCGI script", "Scripting"}},
+    {".php", "PHP", "Server-side scripting language designed for web development", "General-Purpose"},
+    {".php3", "PHP", "Server-side scripting language designed for web development", "General-Purpose"},
+    {".php4", "PHP", "Server-side scripting language designed for web development", "General-Purpose"},
+    {".php5", "PHP", "Server-side scripting language designed for web development", "General-Purpose"},
+    {".php7", "PHP", "Server-side scripting language designed for web development", "General-Purpose"},
+    {".phps", "PHP Source", "PHP source with syntax highlighting", "General-Purpose"},
+    {".phpt", "PHP Test", "PHP unit test file", "General-Purpose"},
+    {".phtml", "PHP HTML", "PHP file with embedded HTML", "Markup"},
+    {".phar", "PHP Archive", "PHP application archive", "General-Purpose"},
+    {".composer.json", "Composer", "PHP dependency manager configuration", "Configuration"},
+    {".composer.lock", "Composer Lock", "PHP dependency lock file", "Configuration"},
+    {".asp", "ASP", "Microsoft's server-side script engine for dynamic web pages", "Markup"},
+    {".erl", "Erlang", "Functional language for distributed systems", "General-Purpose"},
+    {".ex", "Elixir", "Functional language built on Erlang VM", "General-Purpose"},
+    {".exs", "Elixir Script", "Elixir script file", "Scripting"},
+    {".pl", "Perl", "High-level general-purpose language", "Scripting"},
+    {".cgi", "CGI Script", "Common Gateway Interface script", "Scripting"},
+    {".fcgi", "FastCGI", "FastCGI script", "Scripting"},
 
     // RUBY AND RELATED
-    {".rb", {"Ruby", "Dynamic, object-oriented language focusing on simplicity and productivity", "General-Purpose"}},
-    {".rbw", {"Ruby Windows", "Ruby script for Windows that doesn't show console", "General-Purpose"}},
-    {".rake", {"Ruby Rake", "Ruby build utility and task automation tool", "Scripting"}},
-    {".gemfile", {"Ruby Gemfile", "Ruby dependency manifest file", "Configuration"}},
-    {".gemspec", {"Ruby Gem Spec", "Ruby gem specification file", "Configuration"}},
-    {".ru", {"Ruby Rack", "Ruby Rack configuration file", "Configuration"}},
-    {".erb", {"Embedded Ruby", "Ruby templating system", "Markup"}},
-    {".rhtml", {"Ruby HTML", "Ruby HTML template file", "Markup"}},
-    {".rjs", {"Ruby JavaScript", "Ruby JavaScript generator file", "General-Purpose"}},
-    {".rxml", {"Ruby XML", "Ruby XML generator file", "General-Purpose"}},
-    {".rsel", {"Ruby Selector", "Ruby selector file", "General-Purpose"}},
-    {".builder", {"Ruby Builder", "Ruby XML builder file", "General-Purpose"}},
-{".rsel", {"Ruby Selector", "Ruby selector file", "General-Purpose"}},
-{".builder", {"Ruby Builder", "Ruby XML builder file", "General-Purpose"}},
-{".rabl", {"Ruby API Builder", "Ruby API builder template", "General-Purpose"}},
-{".jbuilder", {"Jbuilder", "Ruby JSON builder for Rails", "General-Purpose"}},
-{".cap", {"Capistrano", "Ruby deployment script", "Scripting"}},
-{".capfile", {"Capistrano", "Ruby deployment configuration", "Configuration"}},
-{".thor", {"Thor", "Ruby toolkit for building command-line utilities", "Scripting"}},
-{".rails", {"Rails", "Ruby on Rails application directory", "Configuration"}},
-{".rspec", {"RSpec", "Ruby testing framework configuration", "Configuration"}},
-{".haml", {"Haml", "HTML abstraction markup language for Ruby", "Markup"}},
-{".slim", {"Slim", "Ruby template language", "Markup"}},
-{".liquid", {"Liquid", "Ruby template language used in Jekyll", "Markup"}},
-{".prawn", {"Prawn", "Ruby PDF generation file", "Domain-Specific"}},
-{".axlsx", {"Axlsx", "Ruby Excel file generation", "Domain-Specific"}},
-{".fastfile", {"Fastlane", "Ruby mobile app automation configuration", "Configuration"}},
-{".podspec", {"CocoaPods", "Ruby specification for iOS/macOS dependencies", "Configuration"}},
-{".motion", {"RubyMotion", "Ruby for iOS/Android development", "General-Purpose"}},
-{".watchr", {"Watchr", "Ruby file monitoring script", "Scripting"}},
+    {".rb", "Ruby", "Dynamic, object-oriented language focusing on simplicity and productivity", "General-Purpose"},
+    {".rbw", "Ruby Windows", "Ruby script for Windows that doesn't show console", "General-Purpose"},
+    {".rake", "Ruby Rake", "Ruby build utility and task automation tool", "Scripting"},
+    {".gemfile", "Ruby Gemfile", "Ruby dependency manifest file", "Configuration"},
+    {".gemspec", "Ruby Gem Spec", "Ruby gem specification file", "Configuration"},
+    {".ru", "Ruby Rack", "Ruby Rack configuration file", "Configuration"},
+    {".rjs", "Ruby JavaScript", "Ruby JavaScript generator file", "General-Purpose"},
+    {".rxml", "Ruby XML", "Ruby XML generator file", "General-Purpose"},
+    {".rsel", "Ruby Selector", "Ruby selector file", "General-Purpose"},
+    {".builder", "Ruby Builder", "Ruby XML builder file", "General-Purpose"},
+{".rabl", "Ruby API Builder", "Ruby API builder template", "General-Purpose"},
+{".jbuilder", "Jbuilder", "Ruby JSON builder for Rails", "General-Purpose"},
+{".cap", "Capistrano", "Ruby deployment script", "Scripting"},
+{".capfile", "Capistrano", "Ruby deployment configuration", "Configuration"},
+{".thor", "Thor", "Ruby toolkit for building command-line utilities", "Scripting"},
+{".rails", "Rails", "Ruby on Rails application directory", "Configuration"},
+{".rspec", "RSpec", "Ruby testing framework configuration", "Configuration"},
+{".prawn", "Prawn", "Ruby PDF generation file", "Domain-Specific"},
+{".axlsx", "Axlsx", "Ruby Excel file generation", "Domain-Specific"},
+{".fastfile", "Fastlane", "Ruby mobile app automation configuration", "Configuration"},
+{".podspec", "CocoaPods", "Ruby specification for iOS/macOS dependencies", "Configuration"},
+{".motion", "RubyMotion", "Ruby for iOS/Android development", "General-Purpose"},
+{".watchr", "Watchr", "Ruby file monitoring script", "Scripting"},
 
 // GO, RUST AND MODERN SYSTEMS PROGRAMMING
-{".go", {"Go", "Statically-typed language designed for simplicity and efficiency", "General-Purpose"}},
-{".golang", {"Go", "Statically-typed language designed for simplicity and efficiency", "General-Purpose"}},
-{".mod", {"Go Module", "Go module definition file", "Configuration"}},
-{".sum", {"Go Sum", "Go module checksum file", "Configuration"}},
-{".rs", {"Rust", "Systems language focused on safety, concurrency, and performance", "General-Purpose"}},
-{".toml", {"TOML", "Minimal configuration file format with clear semantics (used by Rust Cargo)", "Configuration"}},
-{".cargo", {"Cargo", "Rust package manager directory", "Configuration"}},
-{".d", {"D", "Systems language combining efficiency, control, and modeling power", "General-Purpose"}},
-{".di", {"D Interface", "D language interface file", "General-Purpose"}},
-{".dpp", {"D++", "D language with C++ compatibility", "General-Purpose"}},
-{".swift", {"Swift", "Apple's modern language for iOS, macOS and server development", "General-Purpose"}},
-{".swiftpm", {"Swift Package", "Swift package manager directory", "Configuration"}},
-{".xcodeproj", {"Xcode Project", "Xcode project file", "Configuration"}},
-{".xcworkspace", {"Xcode Workspace", "Xcode workspace file", "Configuration"}},
-{".metal", {"Metal", "Apple's GPU programming language", "Domain-Specific"}},
-{".v", {"V", "Simple, fast, safe language for developing maintainable software", "General-Purpose"}},
-{".zig", {"Zig", "Systems language focusing on robustness, optimality, and clarity", "General-Purpose"}},
-{".nim", {"Nim", "Statically-typed compiled language with Python-like syntax", "General-Purpose"}},
-{".nimble", {"Nimble", "Nim package manager file", "Configuration"}},
-{".nims", {"Nim Script", "Script file for the Nim programming language", "Scripting"}},
-{".cr", {"Crystal", "Ruby-inspired statically-typed language", "General-Purpose"}},
-{".odin", {"Odin", "Systems language with focus on simplicity, performance, and modern paradigms", "General-Purpose"}},
-{".vala", {"Vala", "C#-inspired language that compiles to C", "General-Purpose"}},
-{".vapi", {"Vala API", "Vala API binding file", "Configuration"}},
-{".opa", {"Opa", "Full-stack web development language", "General-Purpose"}},
-{".hx", {"Haxe", "Cross-platform toolkit and language", "General-Purpose"}},
-{".hxml", {"Haxe Build", "Haxe build configuration file", "Configuration"}},
-{".circom", {"Circom", "Domain-specific language for zero-knowledge circuits", "Domain-Specific"}},
-{".move", {"Move", "Programming language for secure blockchain smart contracts", "Domain-Specific"}},
-{".wasm", {"WebAssembly", "Binary instruction format for stack-based virtual machine", "Domain-Specific"}},
-{".wat", {"WebAssembly Text", "Text format for WebAssembly", "Domain-Specific"}},
-{".kit", {"Kit", "Programming language designed for game development", "Domain-Specific"}},
-{".jai", {"JAI", "Game development-focused systems programming language", "Domain-Specific"}},
-{".ooc", {"OOC", "Object-oriented language with C-like syntax", "General-Purpose"}},
-{".grace", {"Grace", "Educational language designed to teach programming", "General-Purpose"}},
-{".frege", {"Frege", "Haskell for the JVM", "General-Purpose"}},
+{".go", "Go", "Statically-typed language designed for simplicity and efficiency", "General-Purpose"},
+{".golang", "Go", "Statically-typed language designed for simplicity and efficiency", "General-Purpose"},
+{".mod", "Go Module", "Go module definition file", "Configuration"},
+{".sum", "Go Sum", "Go module checksum file", "Configuration"},
+{".rs", "Rust", "Systems language focused on safety, concurrency, and performance", "General-Purpose"},
+{".toml", "TOML", "Minimal configuration file format with clear semantics (used by Rust Cargo)", "Configuration"},
+{".cargo", "Cargo", "Rust package manager directory", "Configuration"},
+{".d", "D", "Systems language combining efficiency, control, and modeling power", "General-Purpose"},
+{".di", "D Interface", "D language interface file", "General-Purpose"},
+{".dpp", "D++", "D language with C++ compatibility", "General-Purpose"},
+{".swift", "Swift", "Apple's modern language for iOS, macOS and server development", "General-Purpose"},
+{".swiftpm", "Swift Package", "Swift package manager directory", "Configuration"},
+{".xcodeproj", "Xcode Project", "Xcode project file", "Configuration"},
+{".xcworkspace", "Xcode Workspace", "Xcode workspace file", "Configuration"},
+{".metal", "Metal", "Apple's GPU programming language", "Domain-Specific"},
+{".v", "V", "Simple, fast, safe language for developing maintainable software", "General-Purpose"},
+{".zig", "Zig", "Systems language focusing on robustness, optimality, and clarity", "General-Purpose"},
+{".nim", "Nim", "Statically-typed compiled language with Python-like syntax", "General-Purpose"},
+{".nimble", "Nimble", "Nim package manager file", "Configuration"},
+{".nims", "Nim Script", "Script file for the Nim programming language", "Scripting"},
+{".cr", "Crystal", "Ruby-inspired statically-typed language", "General-Purpose"},
+{".odin", "Odin", "Systems language with focus on simplicity, performance, and modern paradigms", "General-Purpose"},
+{".vala", "Vala", "C#-inspired language that compiles to C", "General-Purpose"},
+{".vapi", "Vala API", "Vala API binding file", "Configuration"},
+{".opa", "Opa", "Full-stack web development language", "General-Purpose"},
+{".hxml", "Haxe Build", "Haxe build configuration file", "Configuration"},
+{".circom", "Circom", "Domain-specific language for zero-knowledge circuits", "Domain-Specific"},
+{".move", "Move", "Programming language for secure blockchain smart contracts", "Domain-Specific"},
+{".wasm", "WebAssembly", "Binary instruction format for stack-based virtual machine", "Domain-Specific"},
+{".wat", "WebAssembly Text", "Text format for WebAssembly", "Domain-Specific"},
+{".jai", "JAI", "Game development-focused systems programming language", "Domain-Specific"},
+{".ooc", "OOC", "Object-oriented language with C-like syntax", "General-Purpose"},
+{".grace", "Grace", "Educational language designed to teach programming", "General-Purpose"},
+{".frege", "Frege", "Haskell for the JVM", "General-Purpose"},
 
 // FUNCTIONAL PROGRAMMING LANGUAGES
-{".hs", {"Haskell", "Pure functional language with static typing and lazy evaluation", "General-Purpose"}},
-{".lhs", {"Literate Haskell", "Haskell in a literate programming format", "Markup"}},
-{".hsc", {"Haskell C", "Haskell FFI binding file", "General-Purpose"}},
-{".chs", {"C2HS", "C to Haskell interface generator file", "General-Purpose"}},
-{".cabal", {"Cabal", "Haskell package description", "Configuration"}},
-{".stack.yaml", {"Stack", "Haskell Stack tool configuration", "Configuration"}},
-{".ml", {"OCaml", "Functional language with strong static typing and type inference", "General-Purpose"}},
-{".mli", {"OCaml Interface", "OCaml module interface file", "General-Purpose"}},
-{".mll", {"OCaml Lexer", "OCaml lexer definition file", "Domain-Specific"}},
-{".mly", {"OCaml Parser", "OCaml parser definition file", "Domain-Specific"}},
-{".dune", {"Dune", "OCaml build system file", "Configuration"}},
-{".merlin", {"Merlin", "OCaml editor configuration file", "Configuration"}},
-{".opam", {"OPAM", "OCaml package manager file", "Configuration"}},
-{".re", {"Reason", "Syntax extension for OCaml focused on JavaScript developers", "General-Purpose"}},
-{".rei", {"Reason Interface", "Reason language interface file", "General-Purpose"}},
-{".res", {"ReScript", "Type-safe language compiling to efficient JavaScript", "General-Purpose"}},
-{".resi", {"ReScript Interface", "ReScript language interface file", "General-Purpose"}},
-{".ex", {"Elixir", "Functional language built on Erlang VM for scalable applications", "General-Purpose"}},
-{".exs", {"Elixir Script", "Script file for the Elixir programming language", "Scripting"}},
-{".erl", {"Erlang", "Functional language designed for concurrent, distributed systems", "General-Purpose"}},
-{".hrl", {"Erlang Header", "Header file for Erlang modules", "General-Purpose"}},
-{".escript", {"Erlang Script", "Erlang script file", "Scripting"}},
-{".app.src", {"Erlang Application", "Erlang application resource file", "Configuration"}},
-{".config", {"Erlang Config", "Erlang configuration file", "Configuration"}},
-{".gleam", {"Gleam", "Type-safe functional language for the Erlang VM", "General-Purpose"}},
-{".lisp", {"Lisp", "Family of languages with fully parenthesized prefix notation", "General-Purpose"}},
-{".lsp", {"Lisp", "Family of languages with fully parenthesized prefix notation", "General-Purpose"}},
-{".cl", {"Common Lisp", "Dialect of Lisp with ANSI standard specification", "General-Purpose"}},
-{".l", {"Lisp", "Lisp source file", "General-Purpose"}},
-{".fasl", {"Lisp Binary", "Compiled Lisp binary file", "General-Purpose"}},
-{".scm", {"Scheme", "Minimalist dialect of Lisp focusing on simplicity", "General-Purpose"}},
-{".ss", {"Scheme", "Minimalist dialect of Lisp focusing on simplicity", "General-Purpose"}},
-{".rkt", {"Racket", "Scheme-based language with extensible design", "General-Purpose"}},
-{".scrbl", {"Scribble", "Racket documentation language", "Markup"}},
-{".sld", {"Scheme Library", "R7RS Scheme library definition", "General-Purpose"}},
-{".sls", {"Scheme Library", "R6RS Scheme library definition", "General-Purpose"}},
-{".idr", {"Idris", "Functional language with dependent types for verified programming", "General-Purpose"}},
-{".agda", {"Agda", "Dependently typed functional language based on intuitionistic type theory", "General-Purpose"}},
-{".lagda", {"Literate Agda", "Agda in a literate programming format", "Markup"}},
-{".coq", {"Coq", "Proof assistant based on dependent type theory", "Domain-Specific"}},
-{".v", {"Coq", "Proof assistant based on dependent type theory", "Domain-Specific"}},
-{".lean", {"Lean", "Theorem prover and programming language", "Domain-Specific"}},
-{".flix", {"Flix", "Functional programming language with a logic engine", "General-Purpose"}},
-{".elm", {"Elm", "Functional language for reliable web applications with no runtime exceptions", "General-Purpose"}},
-{".elm-package.json", {"Elm Package", "Elm package configuration", "Configuration"}},
-{".carp", {"Carp", "Statically typed Lisp without garbage collection", "General-Purpose"}},
-{".purs", {"PureScript", "Strongly-typed functional language that compiles to JavaScript", "General-Purpose"}},
-{".dhall", {"Dhall", "Functional configuration language", "Configuration"}},
-{".fsx", {"F# Script", "F# script file", "Scripting"}},
-{".fs", {"F#", "Functional-first language for .NET", "General-Purpose"}},
-{".fsi", {"F# Interface", "F# signature file", "General-Purpose"}},
+{".hs", "Haskell", "Pure functional language with static typing and lazy evaluation", "General-Purpose"},
+{".lhs", "Literate Haskell", "Haskell in a literate programming format", "Markup"},
+{".hsc", "Haskell C", "Haskell FFI binding file", "General-Purpose"},
+{".chs", "C2HS", "C to Haskell interface generator file", "General-Purpose"},
+{".cabal", "Cabal", "Haskell package description", "Configuration"},
+{".stack.yaml", "Stack", "Haskell Stack tool configuration", "Configuration"},
+{".ml", "OCaml", "Functional language with strong static typing and type inference", "General-Purpose"},
+{".mli", "OCaml Interface", "OCaml module interface file", "General-Purpose"},
+{".mll", "OCaml Lexer", "OCaml lexer definition file", "Domain-Specific"},
+{".mly", "OCaml Parser", "OCaml parser definition file", "Domain-Specific"},
+{".dune", "Dune", "OCaml build system file", "Configuration"},
+{".merlin", "Merlin", "OCaml editor configuration file", "Configuration"},
+{".opam", "OPAM", "OCaml package manager file", "Configuration"},
+{".re", "Reason", "Syntax extension for OCaml focused on JavaScript developers", "General-Purpose"},
+{".rei", "Reason Interface", "Reason language interface file", "General-Purpose"},
+{".res", "ReScript", "Type-safe language compiling to efficient JavaScript", "General-Purpose"},
+{".resi", "ReScript Interface", "ReScript language interface file", "General-Purpose"},
+{".hrl", "Erlang Header", "Header file for Erlang modules", "General-Purpose"},
+{".escript", "Erlang Script", "Erlang script file", "Scripting"},
+{".app.src", "Erlang Application", "Erlang application resource file", "Configuration"},
+{".config", "Erlang Config", "Erlang configuration file", "Configuration"},
+{".gleam", "Gleam", "Type-safe functional language for the Erlang VM", "General-Purpose"},
+{".lisp", "Lisp", "Family of languages with fully parenthesized prefix notation", "General-Purpose"},
+{".lsp", "Lisp", "Family of languages with fully parenthesized prefix notation", "General-Purpose"},
+{".cl", "Common Lisp", "Dialect of Lisp with ANSI standard specification", "General-Purpose"},
+{".l", "Lisp", "Lisp source file", "General-Purpose"},
+{".fasl", "Lisp Binary", "Compiled Lisp binary file", "General-Purpose"},
+{".scm", "Scheme", "Minimalist dialect of Lisp focusing on simplicity", "General-Purpose"},
+{".ss", "Scheme", "Minimalist dialect of Lisp focusing on simplicity", "General-Purpose"},
+{".rkt", "Racket", "Scheme-based language with extensible design", "General-Purpose"},
+{".scrbl", "Scribble", "Racket documentation language", "Markup"},
+{".sld", "Scheme Library", "R7RS Scheme library definition", "General-Purpose"},
+{".sls", "Scheme Library", "R6RS Scheme library definition", "General-Purpose"},
+{".idr", "Idris", "Functional language with dependent types for verified programming", "General-Purpose"},
+{".agda", "Agda", "Dependently typed functional language based on intuitionistic type theory", "General-Purpose"},
+{".lagda", "Literate Agda", "Agda in a literate programming format", "Markup"},
+{".coq", "Coq", "Proof assistant based on dependent type theory", "Domain-Specific"},
+{".lean", "Lean", "Theorem prover and programming language", "Domain-Specific"},
+{".flix", "Flix", "Functional programming language with a logic engine", "General-Purpose"},
+{".elm-package.json", "Elm Package", "Elm package configuration", "Configuration"},
+{".carp", "Carp", "Statically typed Lisp without garbage collection", "General-Purpose"},
+{".purs", "PureScript", "Strongly-typed functional language that compiles to JavaScript", "General-Purpose"},
+{".dhall", "Dhall", "Functional configuration language", "Configuration"},
 
 
 // SCIENTIFIC, STATISTICAL AND NUMERICAL COMPUTING
-{".jl", {"Julia", "High-level language for numerical and scientific computing with C-like performance", "Domain-Specific"}},
-{".ipynb", {"Jupyter Notebook", "Interactive computing notebook", "Markup"}},
-{".r", {"R", "Language for statistical computing and data analysis", "Domain-Specific"}},
-{".rhistory", {"R History", "R command history file", "Configuration"}},
-{".rprofile", {"R Profile", "R startup profile", "Configuration"}},
-{".rdata", {"R Data", "R data file", "Configuration"}},
-{".rds", {"R Data Serialized", "R serialized data file", "Configuration"}},
-{".rmd", {"R Markdown", "R code with Markdown for reproducible analysis reports", "Markup"}},
-{".stan", {"Stan", "Statistical modeling language for Bayesian inference", "Domain-Specific"}},
-{".m", {"MATLAB/Octave", "Matrix-based language for mathematical and numerical computation", "Domain-Specific"}},
-{".mat", {"MATLAB Data", "MATLAB data file", "Configuration"}},
-{".fig", {"MATLAB Figure", "MATLAB figure file", "Configuration"}},
-{".mexw64", {"MATLAB MEX", "MATLAB MEX file for Windows 64-bit", "Domain-Specific"}},
-{".mexa64", {"MATLAB MEX", "MATLAB MEX file for Linux 64-bit", "Domain-Specific"}},
-{".mexmaci64", {"MATLAB MEX", "MATLAB MEX file for macOS 64-bit", "Domain-Specific"}},
-{".mlx", {"MATLAB Live Script", "MATLAB live script file", "Markup"}},
-{".nb", {"Mathematica Notebook", "Wolfram Mathematica computational notebook", "Markup"}},
-{".wl", {"Wolfram Language", "Symbolic computation language used in Mathematica", "Domain-Specific"}},
-{".wls", {"Wolfram Script", "Wolfram Language script file", "Scripting"}},
-{".wlt", {"Wolfram Test", "Wolfram Language test file", "Domain-Specific"}},
-{".sas", {"SAS", "Statistical Analysis System language", "Domain-Specific"}},
-{".sps", {"SPSS", "SPSS syntax file", "Domain-Specific"}},
-{".spv", {"SPSS Output", "SPSS output file", "Configuration"}},
-{".sav", {"SPSS Data", "SPSS data file", "Configuration"}},
-{".dta", {"Stata Data", "Stata data file", "Configuration"}},
-{".do", {"Stata", "Stata command file", "Domain-Specific"}},
-{".ado", {"Stata", "Stata command file", "Domain-Specific"}},
-{".py", {"Python", "Scientific Python scripts (NumPy, SciPy, etc.)", "Domain-Specific"}},
-{".fortran", {"Fortran", "Numerical computing language", "Domain-Specific"}},
-{".f", {"Fortran", "Fortran 77 source file", "Domain-Specific"}},
-{".f90", {"Fortran 90", "Fortran 90 source file", "Domain-Specific"}},
-{".f95", {"Fortran 95", "Fortran 95 source file", "Domain-Specific"}},
-{".f03", {"Fortran 2003", "Fortran 2003 source file", "Domain-Specific"}},
-{".f08", {"Fortran 2008", "Fortran 2008 source file", "Domain-Specific"}},
-{".sage", {"SageMath", "Python-based mathematics software system", "Domain-Specific"}},
-{".sagews", {"SageMath Worksheet", "SageMath worksheet file", "Markup"}},
-{".mo", {"Modelica", "Object-oriented physical modeling language", "Domain-Specific"}},
-{".mos", {"Modelica Script", "Modelica script file", "Scripting"}},
-{".mlir", {"MLIR", "Multi-Level Intermediate Representation for machine learning", "Domain-Specific"}},
-{".nlogo", {"NetLogo", "Multi-agent programmable modeling environment", "Domain-Specific"}},
-{".gap", {"GAP", "System for computational discrete algebra", "Domain-Specific"}},
-{".idl", {"IDL", "Interactive Data Language for data analysis", "Domain-Specific"}},
-{".sci", {"Scilab", "Scientific software package", "Domain-Specific"}},
-{".sce", {"Scilab Script", "Scilab script file", "Domain-Specific"}},
-{".ipf", {"Igor Pro", "Scientific graphing and data analysis", "Domain-Specific"}},
+{".jl", "Julia", "High-level language for numerical and scientific computing with C-like performance", "Domain-Specific"},
+{".r", "R", "Language for statistical computing and data analysis", "Domain-Specific"},
+{".rhistory", "R History", "R command history file", "Configuration"},
+{".rprofile", "R Profile", "R startup profile", "Configuration"},
+{".rdata", "R Data", "R data file", "Configuration"},
+{".rds", "R Data Serialized", "R serialized data file", "Configuration"},
+{".rmd", "R Markdown", "R code with Markdown for reproducible analysis reports", "Markup"},
+{".stan", "Stan", "Statistical modeling language for Bayesian inference", "Domain-Specific"},
+{".m", "MATLAB/Octave", "Matrix-based language for mathematical and numerical computation", "Domain-Specific"},
+{".mat", "MATLAB Data", "MATLAB data file", "Configuration"},
+{".fig", "MATLAB Figure", "MATLAB figure file", "Configuration"},
+{".mexw64", "MATLAB MEX", "MATLAB MEX file for Windows 64-bit", "Domain-Specific"},
+{".mexa64", "MATLAB MEX", "MATLAB MEX file for Linux 64-bit", "Domain-Specific"},
+{".mexmaci64", "MATLAB MEX", "MATLAB MEX file for macOS 64-bit", "Domain-Specific"},
+{".mlx", "MATLAB Live Script", "MATLAB live script file", "Markup"},
+{".nb", "Mathematica Notebook", "Wolfram Mathematica computational notebook", "Markup"},
+{".wl", "Wolfram Language", "Symbolic computation language used in Mathematica", "Domain-Specific"},
+{".wls", "Wolfram Script", "Wolfram Language script file", "Scripting"},
+{".wlt", "Wolfram Test", "Wolfram Language test file", "Domain-Specific"},
+{".sas", "SAS", "Statistical Analysis System language", "Domain-Specific"},
+{".sps", "SPSS", "SPSS syntax file", "Domain-Specific"},
+{".spv", "SPSS Output", "SPSS output file", "Configuration"},
+{".sav", "SPSS Data", "SPSS data file", "Configuration"},
+{".dta", "Stata Data", "Stata data file", "Configuration"},
+{".do", "Stata", "Stata command file", "Domain-Specific"},
+{".ado", "Stata", "Stata command file", "Domain-Specific"},
+{".fortran", "Fortran", "Numerical computing language", "Domain-Specific"},
+{".f", "Fortran", "Fortran 77 source file", "Domain-Specific"},
+{".f90", "Fortran 90", "Fortran 90 source file", "Domain-Specific"},
+{".f95", "Fortran 95", "Fortran 95 source file", "Domain-Specific"},
+{".f03", "Fortran 2003", "Fortran 2003 source file", "Domain-Specific"},
+{".f08", "Fortran 2008", "Fortran 2008 source file", "Domain-Specific"},
+{".sage", "SageMath", "Python-based mathematics software system", "Domain-Specific"},
+{".sagews", "SageMath Worksheet", "SageMath worksheet file", "Markup"},
+{".mo", "Modelica", "Object-oriented physical modeling language", "Domain-Specific"},
+{".mos", "Modelica Script", "Modelica script file", "Scripting"},
+{".mlir", "MLIR", "Multi-Level Intermediate Representation for machine learning", "Domain-Specific"},
+{".nlogo", "NetLogo", "Multi-agent programmable modeling environment", "Domain-Specific"},
+{".gap", "GAP", "System for computational discrete algebra", "Domain-Specific"},
+{".idl", "IDL", "Interactive Data Language for data analysis", "Domain-Specific"},
+{".sci", "Scilab", "Scientific software package", "Domain-Specific"},
+{".sce", "Scilab Script", "Scilab script file", "Domain-Specific"},
+{".ipf", "Igor Pro", "Scientific graphing and data analysis", "Domain-Specific"},
 
 
 // SHELL AND SCRIPTING
-{".sh", {"Shell", "Unix shell script for automation and command execution", "Scripting"}},
-{".bash", {"Bash", "Extended Unix shell with improvements for scripting", "Scripting"}},
-{".bashrc", {"Bash Config", "Bash shell configuration file", "Configuration"}},
-{".bash_profile", {"Bash Profile", "Bash login configuration", "Configuration"}},
-{".bash_logout", {"Bash Logout", "Bash logout file", "Configuration"}},
-{".bash_history", {"Bash History", "Bash command history", "Configuration"}},
-{".profile", {"Shell Profile", "Unix shell profile", "Configuration"}},
-{".zsh", {"Zsh", "Extended Bourne shell with improved features and customization", "Scripting"}},
-{".zshrc", {"Zsh Config", "Zsh configuration file", "Configuration"}},
-{".zprofile", {"Zsh Profile", "Zsh login configuration", "Configuration"}},
-{".zshenv", {"Zsh Environment", "Zsh environment configuration", "Configuration"}},
-{".zlogin", {"Zsh Login", "Zsh login script", "Configuration"}},
-{".zlogout", {"Zsh Logout", "Zsh logout script", "Configuration"}},
-{".fish", {"Fish", "User-friendly shell focused on interactive use and discoverability", "Scripting"}},
-{".fishrc", {"Fish Config", "Fish shell configuration", "Configuration"}},
-{".ksh", {"Korn Shell", "Unix shell with advanced scripting capabilities", "Scripting"}},
-{".csh", {"C Shell", "Unix shell with C-like syntax", "Scripting"}},
-{".cshrc", {"C Shell Config", "C shell configuration file", "Configuration"}},
-{".tcsh", {"Tcsh", "Enhanced version of the C shell", "Scripting"}},
-{".tcshrc", {"Tcsh Config", "Tcsh configuration file", "Configuration"}},
-{".ps1", {"PowerShell", "Microsoft's task automation language and shell for Windows", "Scripting"}},
-{".psm1", {"PowerShell Module", "PowerShell module file containing functions and variables", "Scripting"}},
-{".psd1", {"PowerShell Data", "PowerShell data definition file for modules", "Configuration"}},
-{".ps1xml", {"PowerShell XML", "PowerShell format and type definition", "Configuration"}},
-{".psc1", {"PowerShell Console", "PowerShell console file", "Configuration"}},
-{".pssc", {"PowerShell Session", "PowerShell session configuration file", "Configuration"}},
-{".cdxml", {"PowerShell CDXML", "PowerShell cmdlet definition XML", "Configuration"}},
-{".bat", {"Batch", "Windows command script for automating system tasks", "Scripting"}},
-{".cmd", {"Batch", "Windows command script for automating system tasks", "Scripting"}},
-{".btm", {"Batch", "Batch file for 4DOS/NDOS/TCC", "Scripting"}},
-{".vbs", {"VBScript", "Visual Basic Scripting Edition for Windows automation", "Scripting"}},
-{".vbe", {"VBScript Encoded", "Encoded Visual Basic script", "Scripting"}},
-{".vba", {"VBA", "Visual Basic for Applications used in Microsoft Office products", "Scripting"}},
-{".wsf", {"Windows Script File", "Windows Script File for multiple scripting languages", "Scripting"}},
-{".wsc", {"Windows Script Component", "Windows Script Component file", "Scripting"}},
-{".js", {"JScript", "Microsoft's implementation of JavaScript for scripting", "Scripting"}},
-{".jse", {"JScript Encoded", "Encoded JScript file", "Scripting"}},
-{".awk", {"AWK", "Text processing language for pattern scanning and processing", "Scripting"}},
-{".gawk", {"GNU AWK", "Enhanced version of the AWK language", "Scripting"}},
-{".mawk", {"MAWK", "AWK implementation focused on speed", "Scripting"}},
-{".sed", {"sed", "Stream editor for filtering and transforming text", "Scripting"}},
-{".pl", {"Perl", "High-level, general-purpose scripting language", "Scripting"}},
-{".pm", {"Perl Module", "Reusable Perl code package", "Scripting"}},
-{".perl", {"Perl", "High-level, general-purpose scripting language", "Scripting"}},
-{".t", {"Perl Test", "Perl test file", "Scripting"}},
-{".pod", {"Perl POD", "Perl Plain Old Documentation", "Markup"}},
-{".ph", {"Perl Header", "Perl header file", "Scripting"}},
-{".plx", {"Perl Executable", "Perl executable script", "Scripting"}},
-{".tcl", {"Tcl", "Tool Command Language for scripting and embedded systems", "Scripting"}},
-{".tk", {"Tk", "GUI toolkit extension for Tcl and other languages", "Scripting"}},
-{".itcl", {"Incr Tcl", "Object-oriented extension for Tcl", "Scripting"}},
-{".lua", {"Lua", "Lightweight scripting language designed for embedded use", "Scripting"}},
-{".luac", {"Lua Bytecode", "Compiled Lua bytecode file", "Scripting"}},
-{".moon", {"MoonScript", "Language that compiles to Lua", "Scripting"}},
-{".au3", {"AutoIt", "BASIC-like scripting language for Windows GUI automation", "Scripting"}},
-{".ahk", {"AutoHotkey", "Scripting language for desktop automation on Windows", "Scripting"}},
-{".ahkl", {"AutoHotkey_L", "AutoHotkey variant with Unicode support", "Scripting"}},
-{".nsi", {"NSIS", "Nullsoft Scriptable Install System script", "Scripting"}},
-{".nsh", {"NSIS Header", "NSIS header file", "Scripting"}},
-{".as", {"ActionScript", "Scripting language for Flash", "Scripting"}},
-{".jsfl", {"JavaScript Flash", "JavaScript for Flash IDE automation", "Scripting"}},
-{".scpt", {"AppleScript", "Apple's automation language for macOS", "Scripting"}},
-{".applescript", {"AppleScript", "Apple's automation language for macOS", "Scripting"}},
-{".osascript", {"AppleScript", "AppleScript for macOS automation", "Scripting"}},
-{".command", {"Shell Command", "macOS shell command file", "Scripting"}},
-{".hta", {"HTML Application", "HTML-based application for Windows", "Scripting"}},
-{".iim", {"iMacros", "Browser macro scripting language", "Scripting"}},
-{".mel", {"Maya Embedded Language", "Scripting language for Autodesk Maya", "Domain-Specific"}},
-{".ms", {"MAXScript", "Scripting language for 3ds Max", "Domain-Specific"}},
-{".coffee", {"CoffeeScript", "Language that compiles to JavaScript", "Scripting"}},
-{".hx", {"Haxe", "Cross-platform language", "General-Purpose"}},
-{".groovy", {"Groovy", "Dynamic language for the JVM", "Scripting"}},
-{".gvy", {"Groovy", "Dynamic language for the JVM", "Scripting"}},
-{".gnt", {"GNAT Script", "Ada scripting language", "Scripting"}},
-{".dotsettings", {"ReSharper", "JetBrains ReSharper settings", "Configuration"}},
-{".lsp", {"AutoLISP", "AutoCAD automation language", "Domain-Specific"}},
-{".clj", {"Clojure", "Lisp dialect for the JVM", "General-Purpose"}},
-{".cljs", {"ClojureScript", "Clojure that compiles to JavaScript", "General-Purpose"}},
-{".cljc", {"Clojure Common", "Cross-platform Clojure code", "General-Purpose"}},
-{".edn", {"Extensible Data Notation", "Clojure data format", "Configuration"}},
+{".sh", "Shell", "Unix shell script for automation and command execution", "Scripting"},
+{".bash", "Bash", "Extended Unix shell with improvements for scripting", "Scripting"},
+{".bashrc", "Bash Config", "Bash shell configuration file", "Configuration"},
+{".bash_profile", "Bash Profile", "Bash login configuration", "Configuration"},
+{".bash_logout", "Bash Logout", "Bash logout file", "Configuration"},
+{".bash_history", "Bash History", "Bash command history", "Configuration"},
+{".profile", "Shell Profile", "Unix shell profile", "Configuration"},
+{".zsh", "Zsh", "Extended Bourne shell with improved features and customization", "Scripting"},
+{".zshrc", "Zsh Config", "Zsh configuration file", "Configuration"},
+{".zprofile", "Zsh Profile", "Zsh login configuration", "Configuration"},
+{".zshenv", "Zsh Environment", "Zsh environment configuration", "Configuration"},
+{".zlogin", "Zsh Login", "Zsh login script", "Configuration"},
+{".zlogout", "Zsh Logout", "Zsh logout script", "Configuration"},
+{".fish", "Fish", "User-friendly shell focused on interactive use and discoverability", "Scripting"},
+{".fishrc", "Fish Config", "Fish shell configuration", "Configuration"},
+{".ksh", "Korn Shell", "Unix shell with advanced scripting capabilities", "Scripting"},
+{".csh", "C Shell", "Unix shell with C-like syntax", "Scripting"},
+{".cshrc", "C Shell Config", "C shell configuration file", "Configuration"},
+{".tcsh", "Tcsh", "Enhanced version of the C shell", "Scripting"},
+{".tcshrc", "Tcsh Config", "Tcsh configuration file", "Configuration"},
+{".ps1", "PowerShell", "Microsoft's task automation language and shell for Windows", "Scripting"},
+{".psm1", "PowerShell Module", "PowerShell module file containing functions and variables", "Scripting"},
+{".psd1", "PowerShell Data", "PowerShell data definition file for modules", "Configuration"},
+{".ps1xml", "PowerShell XML", "PowerShell format and type definition", "Configuration"},
+{".psc1", "PowerShell Console", "PowerShell console file", "Configuration"},
+{".pssc", "PowerShell Session", "PowerShell session configuration file", "Configuration"},
+{".cdxml", "PowerShell CDXML", "PowerShell cmdlet definition XML", "Configuration"},
+{".bat", "Batch", "Windows command script for automating system tasks", "Scripting"},
+{".cmd", "Batch", "Windows command script for automating system tasks", "Scripting"},
+{".btm", "Batch", "Batch file for 4DOS/NDOS/TCC", "Scripting"},
+{".vbs", "VBScript", "Visual Basic Scripting Edition for Windows automation", "Scripting"},
+{".vbe", "VBScript Encoded", "Encoded Visual Basic script", "Scripting"},
+{".vba", "VBA", "Visual Basic for Applications used in Microsoft Office products", "Scripting"},
+{".wsf", "Windows Script File", "Windows Script File for multiple scripting languages", "Scripting"},
+{".wsc", "Windows Script Component", "Windows Script Component file", "Scripting"},
+{".jse", "JScript Encoded", "Encoded JScript file", "Scripting"},
+{".awk", "AWK", "Text processing language for pattern scanning and processing", "Scripting"},
+{".gawk", "GNU AWK", "Enhanced version of the AWK language", "Scripting"},
+{".mawk", "MAWK", "AWK implementation focused on speed", "Scripting"},
+{".sed", "sed", "Stream editor for filtering and transforming text", "Scripting"},
+{".pm", "Perl Module", "Reusable Perl code package", "Scripting"},
+{".perl", "Perl", "High-level, general-purpose scripting language", "Scripting"},
+{".t", "Perl Test", "Perl test file", "Scripting"},
+{".pod", "Perl POD", "Perl Plain Old Documentation", "Markup"},
+{".ph", "Perl Header", "Perl header file", "Scripting"},
+{".plx", "Perl Executable", "Perl executable script", "Scripting"},
+{".tcl", "Tcl", "Tool Command Language for scripting and embedded systems", "Scripting"},
+{".tk", "Tk", "GUI toolkit extension for Tcl and other languages", "Scripting"},
+{".itcl", "Incr Tcl", "Object-oriented extension for Tcl", "Scripting"},
+{".lua", "Lua", "Lightweight scripting language designed for embedded use", "Scripting"},
+{".luac", "Lua Bytecode", "Compiled Lua bytecode file", "Scripting"},
+{".moon", "MoonScript", "Language that compiles to Lua", "Scripting"},
+{".au3", "AutoIt", "BASIC-like scripting language for Windows GUI automation", "Scripting"},
+{".ahk", "AutoHotkey", "Scripting language for desktop automation on Windows", "Scripting"},
+{".ahkl", "AutoHotkey_L", "AutoHotkey variant with Unicode support", "Scripting"},
+{".nsi", "NSIS", "Nullsoft Scriptable Install System script", "Scripting"},
+{".nsh", "NSIS Header", "NSIS header file", "Scripting"},
+{".as", "ActionScript", "Scripting language for Flash", "Scripting"},
+{".scpt", "AppleScript", "Apple's automation language for macOS", "Scripting"},
+{".applescript", "AppleScript", "Apple's automation language for macOS", "Scripting"},
+{".osascript", "AppleScript", "AppleScript for macOS automation", "Scripting"},
+{".command", "Shell Command", "macOS shell command file", "Scripting"},
+{".iim", "iMacros", "Browser macro scripting language", "Scripting"},
+{".mel", "Maya Embedded Language", "Scripting language for Autodesk Maya", "Domain-Specific"},
+{".ms", "MAXScript", "Scripting language for 3ds Max", "Domain-Specific"},
+{".gnt", "GNAT Script", "Ada scripting language", "Scripting"},
+{".dotsettings", "ReSharper", "JetBrains ReSharper settings", "Configuration"},
 
 
 // CONFIGURATION AND DATA FORMATS
-{".json", {"JSON", "Lightweight data interchange format based on JavaScript syntax", "Configuration"}},
-{".jsonl", {"JSON Lines", "JSON objects separated by newlines for streaming data", "Configuration"}},
-{".jsonc", {"JSON with Comments", "JSON format that allows comments", "Configuration"}},
-{".json5", {"JSON5", "Extension of JSON with comments, multi-line strings, and trailing commas", "Configuration"}},
-{".geojson", {"GeoJSON", "Format for encoding geographic data structures", "Configuration"}},
-{".topojson", {"TopoJSON", "Extension of GeoJSON with topology", "Configuration"}},
-{".xml", {"XML", "Extensible markup language for storing and transporting data", "Markup"}},
-{".xsd", {"XML Schema", "Definition language for XML document structure", "Configuration"}},
-{".xsl", {"XSLT", "Language for transforming XML documents", "Markup"}},
-{".xslt", {"XSLT", "Language for transforming XML documents", "Markup"}},
-{".dtd", {"DTD", "Document Type Definition for XML document validation", "Configuration"}},
-{".yaml", {"YAML", "Human-readable data serialization standard", "Configuration"}},
-{".yml", {"YAML", "Human-readable data serialization standard", "Configuration"}},
-{".toml", {"TOML", "Minimal configuration file format with clear semantics", "Configuration"}},
-{".ini", {"INI", "Simple configuration file format with sections and properties", "Configuration"}},
-{".cfg", {"Configuration", "Generic configuration file", "Configuration"}},
-{".conf", {"Configuration", "Generic configuration file", "Configuration"}},
-{".config", {"Configuration", "Generic configuration file", "Configuration"}},
-{".properties", {"Properties", "Java property file with key-value pairs", "Configuration"}},
-{".prop", {"Properties", "Property file with key-value pairs", "Configuration"}},
-{".env", {"Environment", "Environment variables file", "Configuration"}},
-{".dotenv", {"DotEnv", "Environment variables file", "Configuration"}},
-{".csv", {"CSV", "Comma-separated values for tabular data storage", "Configuration"}},
-{".tsv", {"TSV", "Tab-separated values for tabular data storage", "Configuration"}},
-{".ssv", {"SSV", "Semicolon-separated values", "Configuration"}},
-{".dsv", {"DSV", "Delimiter-separated values", "Configuration"}},
-{".plist", {"Property List", "Apple property list file", "Configuration"}},
-{".proto", {"Protocol Buffers", "Google's language-neutral data serialization format", "Configuration"}},
-{".avsc", {"Avro Schema", "Schema definition for the Avro data serialization system", "Configuration"}},
-{".thrift", {"Thrift", "Interface definition for cross-language services", "Configuration"}},
-{".editorconfig", {"EditorConfig", "Editor configuration normalization file", "Configuration"}},
-{".graphql", {"GraphQL", "Query language for APIs and runtime for executing queries", "Domain-Specific"}},
-{".gql", {"GraphQL", "Query language for APIs and runtime for executing queries", "Domain-Specific"}},
-{".cson", {"CSON", "CoffeeScript Object Notation", "Configuration"}},
-{".hjson", {"HJSON", "Human JSON with comments and relaxed syntax", "Configuration"}},
-{".bson", {"BSON", "Binary JSON format", "Configuration"}},
-{".hcl", {"HCL", "HashiCorp Configuration Language", "Configuration"}},
-{".tfvars", {"Terraform Variables", "Terraform variables file", "Configuration"}},
-{".tfstate", {"Terraform State", "Terraform state file", "Configuration"}},
-{".kdl", {"KDL", "Kubernetes Description Language", "Configuration"}},
-{".edn", {"EDN", "Extensible Data Notation", "Configuration"}},
-{".msgpack", {"MessagePack", "Efficient binary serialization format", "Configuration"}},
-{".capnp", {"Cap'n Proto", "Data interchange format and RPC system", "Configuration"}},
-{".fbs", {"FlatBuffers Schema", "Schema for Google's FlatBuffers", "Configuration"}},
-{".ndjson", {"NDJSON", "Newline-delimited JSON", "Configuration"}},
-{".jsonnet", {"Jsonnet", "Data templating language", "Configuration"}},
-{".libsonnet", {"Jsonnet Library", "Jsonnet library file", "Configuration"}},
-{".ston", {"STON", "Smalltalk Object Notation", "Configuration"}},
-{".glean", {"Glean", "Mozilla's telemetry data format", "Configuration"}},
+{".json", "JSON", "Lightweight data interchange format based on JavaScript syntax", "Configuration"},
+{".jsonl", "JSON Lines", "JSON objects separated by newlines for streaming data", "Configuration"},
+{".jsonc", "JSON with Comments", "JSON format that allows comments", "Configuration"},
+{".json5", "JSON5", "Extension of JSON with comments, multi-line strings, and trailing commas", "Configuration"},
+{".geojson", "GeoJSON", "Format for encoding geographic data structures", "Configuration"},
+{".topojson", "TopoJSON", "Extension of GeoJSON with topology", "Configuration"},
+{".xml", "XML", "Extensible markup language for storing and transporting data", "Markup"},
+{".xsd", "XML Schema", "Definition language for XML document structure", "Configuration"},
+{".xsl", "XSLT", "Language for transforming XML documents", "Markup"},
+{".xslt", "XSLT", "Language for transforming XML documents", "Markup"},
+{".dtd", "DTD", "Document Type Definition for XML document validation", "Configuration"},
+{".yaml", "YAML", "Human-readable data serialization standard", "Configuration"},
+{".yml", "YAML", "Human-readable data serialization standard", "Configuration"},
+{".ini", "INI", "Simple configuration file format with sections and properties", "Configuration"},
+{".cfg", "Configuration", "Generic configuration file", "Configuration"},
+{".conf", "Configuration", "Generic configuration file", "Configuration"},
+{".prop", "Properties", "Property file with key-value pairs", "Configuration"},
+{".env", "Environment", "Environment variables file", "Configuration"},
+{".dotenv", "DotEnv", "Environment variables file", "Configuration"},
+{".csv", "CSV", "Comma-separated values for tabular data storage", "Configuration"},
+{".tsv", "TSV", "Tab-separated values for tabular data storage", "Configuration"},
+{".ssv", "SSV", "Semicolon-separated values", "Configuration"},
+{".dsv", "DSV", "Delimiter-separated values", "Configuration"},
+{".plist", "Property List", "Apple property list file", "Configuration"},
+{".proto", "Protocol Buffers", "Google's language-neutral data serialization format", "Configuration"},
+{".avsc", "Avro Schema", "Schema definition for the Avro data serialization system", "Configuration"},
+{".thrift", "Thrift", "Interface definition for cross-language services", "Configuration"},
+{".editorconfig", "EditorConfig", "Editor configuration normalization file", "Configuration"},
+{".graphql", "GraphQL", "Query language for APIs and runtime for executing queries", "Domain-Specific"},
+{".gql", "GraphQL", "Query language for APIs and runtime for executing queries", "Domain-Specific"},
+{".cson", "CSON", "CoffeeScript Object Notation", "Configuration"},
+{".hjson", "HJSON", "Human JSON with comments and relaxed syntax", "Configuration"},
+{".bson", "BSON", "Binary JSON format", "Configuration"},
+{".hcl", "HCL", "HashiCorp Configuration Language", "Configuration"},
+{".tfvars", "Terraform Variables", "Terraform variables file", "Configuration"},
+{".tfstate", "Terraform State", "Terraform state file", "Configuration"},
+{".kdl", "KDL", "Kubernetes Description Language", "Configuration"},
+{".msgpack", "MessagePack", "Efficient binary serialization format", "Configuration"},
+{".capnp", "Cap'n Proto", "Data interchange format and RPC system", "Configuration"},
+{".fbs", "FlatBuffers Schema", "Schema for Google's FlatBuffers", "Configuration"},
+{".ndjson", "NDJSON", "Newline-delimited JSON", "Configuration"},
+{".jsonnet", "Jsonnet", "Data templating language", "Configuration"},
+{".libsonnet", "Jsonnet Library", "Jsonnet library file", "Configuration"},
+{".ston", "STON", "Smalltalk Object Notation", "Configuration"},
+{".glean", "Glean", "Mozilla's telemetry data format", "Configuration"},
 
 
 // MARKUP AND DOCUMENTATION
-{".md", {"Markdown", "Lightweight markup language for creating formatted text", "Markup"}},
-{".markdown", {"Markdown", "Lightweight markup language for creating formatted text", "Markup"}},
-{".mdown", {"Markdown", "Lightweight markup language for creating formatted text", "Markup"}},
-{".mdwn", {"Markdown", "Lightweight markup language for creating formatted text", "Markup"}},
-{".mkd", {"Markdown", "Lightweight markup language for creating formatted text", "Markup"}},
-{".mkdn", {"Markdown", "Lightweight markup language for creating formatted text", "Markup"}},
-{".rst", {"reStructuredText", "Markup language for technical documentation", "Markup"}},
-{".rest", {"reStructuredText", "Markup language for technical documentation", "Markup"}},
-{".asciidoc", {"AsciiDoc", "Lightweight markup language for technical documentation", "Markup"}},
-{".adoc", {"AsciiDoc", "Lightweight markup language for technical documentation", "Markup"}},
-{".asc", {"AsciiDoc", "Lightweight markup language for technical documentation", "Markup"}},
-{".tex", {"LaTeX", "Document preparation system for high-quality typesetting", "Markup"}},
-{".latex", {"LaTeX", "Document preparation system for high-quality typesetting", "Markup"}},
-{".ltx", {"LaTeX", "Document preparation system for high-quality typesetting", "Markup"}},
-{".sty", {"LaTeX Style", "Style definition file for LaTeX documents", "Markup"}},
-{".cls", {"LaTeX Class", "Document class definition file for LaTeX", "Markup"}},
-{".dtx", {"LaTeX DocTeX", "LaTeX documentation file", "Markup"}},
-{".ins", {"LaTeX Install", "LaTeX installation file", "Markup"}},
-{".bib", {"BibTeX", "Reference management format for LaTeX documents", "Markup"}},
-{".bst", {"BibTeX Style", "Bibliography style file for BibTeX", "Markup"}},
-{".bbx", {"Biblatex Bibliography", "Biblatex bibliography style", "Markup"}},
-{".cbx", {"Biblatex Citation", "Biblatex citation style", "Markup"}},
-{".lbx", {"Biblatex Localization", "Biblatex localization file", "Markup"}},
-{".txt", {"Text", "Plain text document", "Markup"}},
-{".rtf", {"Rich Text Format", "Formatted text document", "Markup"}},
-{".org", {"Org", "Emacs major mode for notes, planning, and authoring", "Markup"}},
-{".wiki", {"Wiki", "Generic wiki markup language", "Markup"}},
-{".mediawiki", {"MediaWiki", "Markup language used by Wikipedia and other wikis", "Markup"}},
-{".textile", {"Textile", "Lightweight markup language using text symbols for formatting", "Markup"}},
-{".creole", {"Creole", "Lightweight wiki markup language", "Markup"}},
-{".pod", {"POD", "Plain Old Documentation format used in Perl", "Markup"}},
-{".1", {"Man Page", "Unix manual page format (section 1)", "Markup"}},
-{".2", {"Man Page", "Unix manual page format (section 2)", "Markup"}},
-{".3", {"Man Page", "Unix manual page format (section 3)", "Markup"}},
-{".4", {"Man Page", "Unix manual page format (section 4)", "Markup"}},
-{".5", {"Man Page", "Unix manual page format (section 5)", "Markup"}},
-{".6", {"Man Page", "Unix manual page format (section 6)", "Markup"}},
-{".7", {"Man Page", "Unix manual page format (section 7)", "Markup"}},
-{".8", {"Man Page", "Unix manual page format (section 8)", "Markup"}},
-{".9", {"Man Page", "Unix manual page format (section 9)", "Markup"}},
-{".man", {"Man Page", "Unix manual page format", "Markup"}},
-{".manpage", {"Man Page", "Unix manual page format", "Markup"}},
-{".roff", {"Roff", "Unix text formatting language", "Markup"}},
-{".me", {"Roff Me", "Roff macro package", "Markup"}},
-{".ms", {"Roff Ms", "Roff macro package", "Markup"}},
-{".mm", {"Roff Mm", "Roff macro package", "Markup"}},
-{".tr", {"Troff", "Unix document processing system", "Markup"}},
-{".t", {"Troff", "Unix document processing system", "Markup"}},
-{".mom", {"Mom", "Roff macro package", "Markup"}},
-{".mandoc", {"Mandoc", "Manual page document format", "Markup"}},
-{".dox", {"Doxygen", "Documentation generator markup for source code", "Markup"}},
-{".doxygen", {"Doxygen", "Documentation generator markup for source code", "Markup"}},
-{".javadoc", {"Javadoc", "Documentation comment format for Java code", "Markup"}},
-{".jsdoc", {"JSDoc", "API documentation format for JavaScript", "Markup"}},
-{".tsdoc", {"TSDoc", "Documentation comment format for TypeScript", "Markup"}},
-{".rdoc", {"RDoc", "Ruby documentation format", "Markup"}},
-{".yard", {"YARD", "Ruby documentation tool", "Markup"}},
-{".pydoc", {"PyDoc", "Python documentation format", "Markup"}},
-{".epydoc", {"Epydoc", "Python documentation format", "Markup"}},
-{".sphinx", {"Sphinx", "Python documentation generator", "Markup"}},
-{".restructuredtext", {"reStructuredText", "Markup language for technical documentation", "Markup"}},
-{".docbook", {"DocBook", "XML-based markup language for technical documentation", "Markup"}},
-{".sgml", {"SGML", "Standard Generalized Markup Language", "Markup"}},
-{".docx", {"Word Document", "Microsoft Word document", "Markup"}},
-{".dot", {"Word Template", "Microsoft Word template", "Markup"}},
-{".odt", {"OpenDocument Text", "OpenDocument text document", "Markup"}},
-{".ott", {"OpenDocument Template", "OpenDocument text template", "Markup"}},
-{".info", {"Info", "GNU Info document", "Markup"}},
-{".texi", {"Texinfo", "GNU documentation format", "Markup"}},
-{".texinfo", {"Texinfo", "GNU documentation format", "Markup"}},
-{".txi", {"Texinfo", "GNU documentation format", "Markup"}},
+{".md", "Markdown", "Lightweight markup language for creating formatted text", "Markup"},
+{".markdown", "Markdown", "Lightweight markup language for creating formatted text", "Markup"},
+{".mdown", "Markdown", "Lightweight markup language for creating formatted text", "Markup"},
+{".mdwn", "Markdown", "Lightweight markup language for creating formatted text", "Markup"},
+{".mkd", "Markdown", "Lightweight markup language for creating formatted text", "Markup"},
+{".mkdn", "Markdown", "Lightweight markup language for creating formatted text", "Markup"},
+{".rst", "reStructuredText", "Markup language for technical documentation", "Markup"},
+{".rest", "reStructuredText", "Markup language for technical documentation", "Markup"},
+{".asciidoc", "AsciiDoc", "Lightweight markup language for technical documentation", "Markup"},
+{".adoc", "AsciiDoc", "Lightweight markup language for technical documentation", "Markup"},
+{".asc", "AsciiDoc", "Lightweight markup language for technical documentation", "Markup"},
+{".tex", "LaTeX", "Document preparation system for high-quality typesetting", "Markup"},
+{".latex", "LaTeX", "Document preparation system for high-quality typesetting", "Markup"},
+{".ltx", "LaTeX", "Document preparation system for high-quality typesetting", "Markup"},
+{".sty", "LaTeX Style", "Style definition file for LaTeX documents", "Markup"},
+{".cls", "LaTeX Class", "Document class definition file for LaTeX", "Markup"},
+{".dtx", "LaTeX DocTeX", "LaTeX documentation file", "Markup"},
+{".ins", "LaTeX Install", "LaTeX installation file", "Markup"},
+{".bib", "BibTeX", "Reference management format for LaTeX documents", "Markup"},
+{".bst", "BibTeX Style", "Bibliography style file for BibTeX", "Markup"},
+{".bbx", "Biblatex Bibliography", "Biblatex bibliography style", "Markup"},
+{".cbx", "Biblatex Citation", "Biblatex citation style", "Markup"},
+{".lbx", "Biblatex Localization", "Biblatex localization file", "Markup"},
+{".txt", "Text", "Plain text document", "Markup"},
+{".rtf", "Rich Text Format", "Formatted text document", "Markup"},
+{".org", "Org", "Emacs major mode for notes, planning, and authoring", "Markup"},
+{".wiki", "Wiki", "Generic wiki markup language", "Markup"},
+{".mediawiki", "MediaWiki", "Markup language used by Wikipedia and other wikis", "Markup"},
+{".textile", "Textile", "Lightweight markup language using text symbols for formatting", "Markup"},
+{".creole", "Creole", "Lightweight wiki markup language", "Markup"},
+{".1", "Man Page", "Unix manual page format (section 1)", "Markup"},
+{".2", "Man Page", "Unix manual page format (section 2)", "Markup"},
+{".3", "Man Page", "Unix manual page format (section 3)", "Markup"},
+{".4", "Man Page", "Unix manual page format (section 4)", "Markup"},
+{".5", "Man Page", "Unix manual page format (section 5)", "Markup"},
+{".6", "Man Page", "Unix manual page format (section 6)", "Markup"},
+{".7", "Man Page", "Unix manual page format (section 7)", "Markup"},
+{".8", "Man Page", "Unix manual page format (section 8)", "Markup"},
+{".9", "Man Page", "Unix manual page format (section 9)", "Markup"},
+{".man", "Man Page", "Unix manual page format", "Markup"},
+{".manpage", "Man Page", "Unix manual page format", "Markup"},
+{".roff", "Roff", "Unix text formatting language", "Markup"},
+{".me", "Roff Me", "Roff macro package", "Markup"},
+{".mm", "Roff Mm", "Roff macro package", "Markup"},
+{".tr", "Troff", "Unix document processing system", "Markup"},
+{".mom", "Mom", "Roff macro package", "Markup"},
+{".mandoc", "Mandoc", "Manual page document format", "Markup"},
+{".dox", "Doxygen", "Documentation generator markup for source code", "Markup"},
+{".doxygen", "Doxygen", "Documentation generator markup for source code", "Markup"},
+{".javadoc", "Javadoc", "Documentation comment format for Java code", "Markup"},
+{".jsdoc", "JSDoc", "API documentation format for JavaScript", "Markup"},
+{".tsdoc", "TSDoc", "Documentation comment format for TypeScript", "Markup"},
+{".rdoc", "RDoc", "Ruby documentation format", "Markup"},
+{".yard", "YARD", "Ruby documentation tool", "Markup"},
+{".pydoc", "PyDoc", "Python documentation format", "Markup"},
+{".epydoc", "Epydoc", "Python documentation format", "Markup"},
+{".sphinx", "Sphinx", "Python documentation generator", "Markup"},
+{".restructuredtext", "reStructuredText", "Markup language for technical documentation", "Markup"},
+{".docbook", "DocBook", "XML-based markup language for technical documentation", "Markup"},
+{".sgml", "SGML", "Standard Generalized Markup Language", "Markup"},
+{".docx", "Word Document", "Microsoft Word document", "Markup"},
+{".odt", "OpenDocument Text", "OpenDocument text document", "Markup"},
+{".ott", "OpenDocument Template", "OpenDocument text template", "Markup"},
+{".info", "Info", "GNU Info document", "Markup"},
+{".texi", "Texinfo", "GNU documentation format", "Markup"},
+{".texinfo", "Texinfo", "GNU documentation format", "Markup"},
+{".txi", "Texinfo", "GNU documentation format", "Markup"},
 
 // DATABASE LANGUAGES
-{".sql", {"SQL", "Structured Query Language for relational database management", "Domain-Specific"}},
-{".ddl", {"Data Definition Language", "SQL statements for defining data structures", "Domain-Specific"}},
-{".dml", {"Data Manipulation Language", "SQL statements for manipulating data", "Domain-Specific"}},
-{".pgsql", {"PostgreSQL", "PostgreSQL dialect of SQL", "Domain-Specific"}},
-{".plsql", {"PL/SQL", "Oracle's procedural extension for SQL", "Domain-Specific"}},
-{".pks", {"PL/SQL Package Spec", "PL/SQL package specification", "Domain-Specific"}},
-{".pkb", {"PL/SQL Package Body", "PL/SQL package body", "Domain-Specific"}},
-{".trg", {"PL/SQL Trigger", "PL/SQL trigger definition", "Domain-Specific"}},
-{".fnc", {"PL/SQL Function", "PL/SQL function definition", "Domain-Specific"}},
-{".prc", {"PL/SQL Procedure", "PL/SQL procedure definition", "Domain-Specific"}},
-{".tsql", {"T-SQL", "Microsoft's Transact-SQL dialect", "Domain-Specific"}},
-{".mysql", {"MySQL", "MySQL dialect of SQL", "Domain-Specific"}},
-{".psql", {"PostgreSQL", "PostgreSQL command file", "Domain-Specific"}},
-{".plpgsql", {"PL/pgSQL", "PostgreSQL procedural language", "Domain-Specific"}},
-{".sqlite", {"SQLite", "SQLite database file", "Domain-Specific"}},
-{".sqlite3", {"SQLite", "SQLite 3 database file", "Domain-Specific"}},
-{".db", {"Database", "Generic database file", "Domain-Specific"}},
-{".mdb", {"Microsoft Access", "Microsoft Access database file", "Domain-Specific"}},
-{".accdb", {"Microsoft Access", "Microsoft Access database file", "Domain-Specific"}},
-{".hql", {"HiveQL", "SQL-like language for Hadoop/Hive data warehouse", "Domain-Specific"}},
-{".cql", {"Cassandra CQL", "Query language for Cassandra NoSQL database", "Domain-Specific"}},
-{".cypher", {"Cypher", "Query language for the Neo4j graph database", "Domain-Specific"}},
-{".gremlin", {"Gremlin", "Graph traversal language", "Domain-Specific"}},
-{".n1ql", {"N1QL", "Query language for Couchbase", "Domain-Specific"}},
-{".rql", {"ReQL", "Query language for RethinkDB", "Domain-Specific"}},
-{".aql", {"ArangoDB Query", "Query language for ArangoDB", "Domain-Specific"}},
-{".mql", {"MongoDB Query", "Query language for MongoDB", "Domain-Specific"}},
-{".sparql", {"SPARQL", "Query language for RDF graph databases", "Domain-Specific"}},
-{".spql", {"SPARQL", "Query language for RDF graph databases", "Domain-Specific"}},
-{".influx", {"InfluxQL", "Query language for InfluxDB", "Domain-Specific"}},
-{".flux", {"Flux", "Data scripting language for InfluxDB", "Domain-Specific"}},
-{".prisma", {"Prisma", "Database schema and query builder language", "Domain-Specific"}},
-{".migration", {"Database Migration", "Database schema change script", "Domain-Specific"}},
-{".dbml", {"Database Markup", "Database schema markup language", "Domain-Specific"}},
-{".liquibase", {"Liquibase", "Database change management", "Domain-Specific"}},
-{".changelog", {"Liquibase Changelog", "Liquibase database changelog", "Domain-Specific"}},
-{".flyway", {"Flyway", "Database migration tool", "Domain-Specific"}},
-{".nosql", {"NoSQL", "NoSQL database file", "Domain-Specific"}},
-{".dat", {"Data", "Generic data file", "Configuration"}},
+{".sql", "SQL", "Structured Query Language for relational database management", "Domain-Specific"},
+{".ddl", "Data Definition Language", "SQL statements for defining data structures", "Domain-Specific"},
+{".dml", "Data Manipulation Language", "SQL statements for manipulating data", "Domain-Specific"},
+{".pgsql", "PostgreSQL", "PostgreSQL dialect of SQL", "Domain-Specific"},
+{".plsql", "PL/SQL", "Oracle's procedural extension for SQL", "Domain-Specific"},
+{".pks", "PL/SQL Package Spec", "PL/SQL package specification", "Domain-Specific"},
+{".pkb", "PL/SQL Package Body", "PL/SQL package body", "Domain-Specific"},
+{".trg", "PL/SQL Trigger", "PL/SQL trigger definition", "Domain-Specific"},
+{".fnc", "PL/SQL Function", "PL/SQL function definition", "Domain-Specific"},
+{".prc", "PL/SQL Procedure", "PL/SQL procedure definition", "Domain-Specific"},
+{".tsql", "T-SQL", "Microsoft's Transact-SQL dialect", "Domain-Specific"},
+{".mysql", "MySQL", "MySQL dialect of SQL", "Domain-Specific"},
+{".psql", "PostgreSQL", "PostgreSQL command file", "Domain-Specific"},
+{".plpgsql", "PL/pgSQL", "PostgreSQL procedural language", "Domain-Specific"},
+{".sqlite", "SQLite", "SQLite database file", "Domain-Specific"},
+{".sqlite3", "SQLite", "SQLite 3 database file", "Domain-Specific"},
+{".db", "Database", "Generic database file", "Domain-Specific"},
+{".mdb", "Microsoft Access", "Microsoft Access database file", "Domain-Specific"},
+{".accdb", "Microsoft Access", "Microsoft Access database file", "Domain-Specific"},
+{".hql", "HiveQL", "SQL-like language for Hadoop/Hive data warehouse", "Domain-Specific"},
+{".cql", "Cassandra CQL", "Query language for Cassandra NoSQL database", "Domain-Specific"},
+{".cypher", "Cypher", "Query language for the Neo4j graph database", "Domain-Specific"},
+{".gremlin", "Gremlin", "Graph traversal language", "Domain-Specific"},
+{".n1ql", "N1QL", "Query language for Couchbase", "Domain-Specific"},
+{".rql", "ReQL", "Query language for RethinkDB", "Domain-Specific"},
+{".aql", "ArangoDB Query", "Query language for ArangoDB", "Domain-Specific"},
+{".mql", "MongoDB Query", "Query language for MongoDB", "Domain-Specific"},
+{".sparql", "SPARQL", "Query language for RDF graph databases", "Domain-Specific"},
+{".spql", "SPARQL", "Query language for RDF graph databases", "Domain-Specific"},
+{".influx", "InfluxQL", "Query language for InfluxDB", "Domain-Specific"},
+{".flux", "Flux", "Data scripting language for InfluxDB", "Domain-Specific"},
+{".prisma", "Prisma", "Database schema and query builder language", "Domain-Specific"},
+{".migration", "Database Migration", "Database schema change script", "Domain-Specific"},
+{".dbml", "Database Markup", "Database schema markup language", "Domain-Specific"},
+{".liquibase", "Liquibase", "Database change management", "Domain-Specific"},
+{".changelog", "Liquibase Changelog", "Liquibase database changelog", "Domain-Specific"},
+{".flyway", "Flyway", "Database migration tool", "Domain-Specific"},
+{".nosql", "NoSQL", "NoSQL database file", "Domain-Specific"},
+{".dat", "Data", "Generic data file", "Configuration"},
 
 // MOBILE AND APP DEVELOPMENT
-{".swift", {"Swift", "Apple's modern language for iOS, macOS and server development", "General-Purpose"}},
-{".xib", {"Interface Builder", "XML Interface Builder document for iOS/macOS UI", "Markup"}},
-{".storyboard", {"Storyboard", "Visual representation of UI for iOS/macOS applications", "Markup"}},
-{".xcassets", {"Xcode Assets", "Xcode asset catalog", "Configuration"}},
-{".pbxproj", {"Xcode Project", "Xcode project file", "Configuration"}},
-{".plist", {"Property List", "XML-based configuration file for Apple platforms", "Configuration"}},
-{".entitlements", {"Entitlements", "macOS/iOS application entitlements", "Configuration"}},
-{".modulemap", {"Module Map", "Swift/Objective-C module definition", "Configuration"}},
-{".appiconset", {"App Icon Set", "iOS/macOS application icon set", "Configuration"}},
-{".xcconfig", {"Xcode Config", "Xcode build configuration", "Configuration"}},
-{".kt", {"Kotlin", "Modern JVM language with null safety used for Android development", "General-Purpose"}},
-{".gradle", {"Gradle", "Build system used for Android app development", "Configuration"}},
-{".java", {"Java", "Object-oriented language used for Android development and enterprise apps", "General-Purpose"}},
-{".xml", {"Android XML", "Android resource XML file", "Markup"}},
-{".aidl", {"Android IDL", "Android Interface Definition Language", "Domain-Specific"}},
-{".dex", {"Dalvik Executable", "Android app bytecode format", "Domain-Specific"}},
-{".aab", {"Android App Bundle", "Android app publishing format", "Domain-Specific"}},
-{".apk", {"Android Package", "Android application package", "Domain-Specific"}},
-{".ipa", {"iOS App", "iOS application archive", "Domain-Specific"}},
-{".xcarchive", {"Xcode Archive", "Xcode application archive", "Domain-Specific"}},
-{".dart", {"Dart", "Google's language for Flutter cross-platform development", "General-Purpose"}},
-{".flutter", {"Flutter", "Google's UI toolkit for mobile, web, and desktop", "Domain-Specific"}},
-{".pubspec.yaml", {"Pub Spec", "Flutter/Dart package specification", "Configuration"}},
-{".arb", {"Application Resource Bundle", "Flutter internationalization format", "Configuration"}},
-{".appxmanifest", {"AppX Manifest", "Windows application manifest", "Configuration"}},
-{".appx", {"AppX Package", "Windows application package", "Domain-Specific"}},
-{".appxbundle", {"AppX Bundle", "Windows application bundle", "Domain-Specific"}},
-{".msix", {"MSIX Package", "Modern Windows application package", "Domain-Specific"}},
-{".tns", {"NativeScript", "Cross-platform mobile development", "Domain-Specific"}},
-{".nativescript", {"NativeScript", "NativeScript configuration", "Configuration"}},
-{".jks", {"Java KeyStore", "Java keystore file for app signing", "Configuration"}},
-{".keystore", {"Android KeyStore", "Android keystore file", "Configuration"}},
-{".watchkit", {"WatchKit", "Apple Watch app extension", "Domain-Specific"}},
-{".framework", {"Framework", "macOS/iOS framework bundle", "Domain-Specific"}},
-{".bundle", {"Bundle", "macOS/iOS resource bundle", "Domain-Specific"}},
-{".workbook", {"Xamarin Workbook", "Interactive C# for mobile development", "Markup"}},
-{".targets", {"MSBuild Targets", ".NET build targets", "Configuration"}},
-{".props", {"MSBuild Properties", ".NET build properties", "Configuration"}},
-{".nuspec", {"NuGet Spec", ".NET package specification", "Configuration"}},
-{".nupkg", {"NuGet Package", ".NET package file", "Domain-Specific"}},
-{".iml", {"IntelliJ Module", "IntelliJ IDEA module file", "Configuration"}},
+{".xib", "Interface Builder", "XML Interface Builder document for iOS/macOS UI", "Markup"},
+{".storyboard", "Storyboard", "Visual representation of UI for iOS/macOS applications", "Markup"},
+{".xcassets", "Xcode Assets", "Xcode asset catalog", "Configuration"},
+{".pbxproj", "Xcode Project", "Xcode project file", "Configuration"},
+{".entitlements", "Entitlements", "macOS/iOS application entitlements", "Configuration"},
+{".modulemap", "Module Map", "Swift/Objective-C module definition", "Configuration"},
+{".appiconset", "App Icon Set", "iOS/macOS application icon set", "Configuration"},
+{".xcconfig", "Xcode Config", "Xcode build configuration", "Configuration"},
+{".dex", "Dalvik Executable", "Android app bytecode format", "Domain-Specific"},
+{".aab", "Android App Bundle", "Android app publishing format", "Domain-Specific"},
+{".apk", "Android Package", "Android application package", "Domain-Specific"},
+{".ipa", "iOS App", "iOS application archive", "Domain-Specific"},
+{".xcarchive", "Xcode Archive", "Xcode application archive", "Domain-Specific"},
+{".flutter", "Flutter", "Google's UI toolkit for mobile, web, and desktop", "Domain-Specific"},
+{".pubspec.yaml", "Pub Spec", "Flutter/Dart package specification", "Configuration"},
+{".arb", "Application Resource Bundle", "Flutter internationalization format", "Configuration"},
+{".appxmanifest", "AppX Manifest", "Windows application manifest", "Configuration"},
+{".appx", "AppX Package", "Windows application package", "Domain-Specific"},
+{".appxbundle", "AppX Bundle", "Windows application bundle", "Domain-Specific"},
+{".msix", "MSIX Package", "Modern Windows application package", "Domain-Specific"},
+{".tns", "NativeScript", "Cross-platform mobile development", "Domain-Specific"},
+{".nativescript", "NativeScript", "NativeScript configuration", "Configuration"},
+{".jks", "Java KeyStore", "Java keystore file for app signing", "Configuration"},
+{".keystore", "Android KeyStore", "Android keystore file", "Configuration"},
+{".watchkit", "WatchKit", "Apple Watch app extension", "Domain-Specific"},
+{".framework", "Framework", "macOS/iOS framework bundle", "Domain-Specific"},
+{".bundle", "Bundle", "macOS/iOS resource bundle", "Domain-Specific"},
+{".workbook", "Xamarin Workbook", "Interactive C# for mobile development", "Markup"},
+{".targets", "MSBuild Targets", ".NET build targets", "Configuration"},
+{".props", "MSBuild Properties", ".NET build properties", "Configuration"},
+{".nuspec", "NuGet Spec", ".NET package specification", "Configuration"},
+{".nupkg", "NuGet Package", ".NET package file", "Domain-Specific"},
 
 // GAME DEVELOPMENT
-{".gd", {"GDScript", "Scripting language for the Godot game engine", "Domain-Specific"}},
-{".gdshader", {"Godot Shader", "Shader language for Godot engine", "Domain-Specific"}},
-{".tscn", {"Godot Scene", "Godot engine scene file", "Domain-Specific"}},
-{".tres", {"Godot Resource", "Godot engine resource file", "Domain-Specific"}},
-{".import", {"Godot Import", "Godot engine import file", "Configuration"}},
-{".godot", {"Godot Project", "Godot engine project file", "Configuration"}},
-{".cs", {"C# Unity", "C# script for Unity game engine", "Domain-Specific"}},
-{".unity", {"Unity Scene", "Unity game engine scene file", "Domain-Specific"}},
-{".prefab", {"Unity Prefab", "Reusable game object in Unity", "Domain-Specific"}},
-{".asset", {"Unity Asset", "Unity game engine asset file", "Domain-Specific"}},
-{".meta", {"Unity Meta", "Unity metadata file", "Configuration"}},
-{".controller", {"Unity Controller", "Unity animation controller", "Domain-Specific"}},
-{".anim", {"Unity Animation", "Unity animation file", "Domain-Specific"}},
-{".mat", {"Unity Material", "Unity material file", "Domain-Specific"}},
-{".physicMaterial", {"Unity Physics Material", "Unity physics material", "Domain-Specific"}},
-{".shader", {"Unity Shader", "Shader program for the Unity game engine", "Domain-Specific"}},
-{".cginc", {"Unity Shader Include", "Unity shader include file", "Domain-Specific"}},
-{".compute", {"Unity Compute Shader", "Unity compute shader", "Domain-Specific"}},
-{".shadergraph", {"Unity Shader Graph", "Unity visual shader graph", "Domain-Specific"}},
-{".uasset", {"Unreal Asset", "Unreal Engine asset file", "Domain-Specific"}},
-{".umap", {"Unreal Map", "Unreal Engine level map", "Domain-Specific"}},
-{".uproject", {"Unreal Project", "Unreal Engine project file", "Configuration"}},
-{".uplugin", {"Unreal Plugin", "Unreal Engine plugin file", "Configuration"}},
-{".usf", {"Unreal Shader", "Unreal Engine shader file", "Domain-Specific"}},
-{".ush", {"Unreal Shader Header", "Unreal Engine shader header", "Domain-Specific"}},
-{".uc", {"UnrealScript", "Legacy scripting language for Unreal Engine 3", "Domain-Specific"}},
-{".gml", {"GameMaker Language", "Scripting language for GameMaker Studio", "Domain-Specific"}},
-{".gmx", {"GameMaker Resource", "GameMaker Studio resource file", "Domain-Specific"}},
-{".yyp", {"GameMaker Project", "GameMaker Studio 2 project file", "Configuration"}},
-{".love", {"LÖVE", "LÖVE game engine project", "Domain-Specific"}},
-{".glsl", {"GLSL", "OpenGL Shading Language for graphics programming", "Domain-Specific"}},
-{".vert", {"GLSL Vertex Shader", "Vertex shader for OpenGL graphics pipeline", "Domain-Specific"}},
-{".frag", {"GLSL Fragment Shader", "Fragment shader for OpenGL graphics pipeline", "Domain-Specific"}},
-{".comp", {"GLSL Compute Shader", "Compute shader for OpenGL general-purpose computing", "Domain-Specific"}},
-{".geom", {"GLSL Geometry Shader", "Geometry shader for OpenGL", "Domain-Specific"}},
-{".tesc", {"GLSL Tessellation Control", "Tessellation control shader for OpenGL", "Domain-Specific"}},
-{".tese", {"GLSL Tessellation Evaluation", "Tessellation evaluation shader for OpenGL", "Domain-Specific"}},
-{".hlsl", {"HLSL", "High-Level Shading Language for DirectX graphics", "Domain-Specific"}},
-{".fx", {"Effect Shader", "Effect file format for DirectX graphics", "Domain-Specific"}},
-{".cso", {"Compiled Shader Object", "Compiled DirectX shader", "Domain-Specific"}},
-{".metal", {"Metal Shader", "Shader language for Apple's Metal graphics API", "Domain-Specific"}},
-{".wgsl", {"WebGPU Shader", "WebGPU Shading Language for web graphics", "Domain-Specific"}},
-{".msl", {"Metal Shading Language", "Apple's Metal Shading Language", "Domain-Specific"}},
-{".shadrc", {"Shadertoy", "Shadertoy shader configuration", "Domain-Specific"}},
-{".sfz", {"SFZ", "SFZ instrument definition format", "Domain-Specific"}},
-{".blend", {"Blender", "Blender 3D file", "Domain-Specific"}},
-{".blend1", {"Blender Backup", "Blender 3D file backup", "Domain-Specific"}},
-{".fbx", {"FBX", "Filmbox 3D model format", "Domain-Specific"}},
-{".obj", {"OBJ", "Wavefront 3D model format", "Domain-Specific"}},
-{".mtl", {"MTL", "Wavefront material template library", "Domain-Specific"}},
-{".gltf", {"glTF", "GL Transmission Format for 3D models", "Domain-Specific"}},
-{".glb", {"GLB", "Binary glTF format", "Domain-Specific"}},
-{".pck", {"Godot Pack", "Godot packed resource file", "Domain-Specific"}},
-{".rpy", {"Ren'Py", "Visual novel engine script", "Domain-Specific"}},
-{".renpy", {"Ren'Py", "Visual novel engine script", "Domain-Specific"}},
-{".agc", {"AppGameKit", "AppGameKit script", "Domain-Specific"}},
-{".agk", {"AppGameKit", "AppGameKit project", "Domain-Specific"}},
-{".angelscript", {"AngelScript", "Scripting language for games", "Domain-Specific"}},
-{".as", {"AngelScript", "Scripting language for games", "Domain-Specific"}},
-{".cry", {"CryEngine", "CryEngine script", "Domain-Specific"}},
-{".cryproj", {"CryEngine Project", "CryEngine project file", "Configuration"}},
-{".vpc", {"Valve Project", "Valve project configuration", "Configuration"}},
+{".gd", "GDScript", "Scripting language for the Godot game engine", "Domain-Specific"},
+{".gdshader", "Godot Shader", "Shader language for Godot engine", "Domain-Specific"},
+{".tscn", "Godot Scene", "Godot engine scene file", "Domain-Specific"},
+{".tres", "Godot Resource", "Godot engine resource file", "Domain-Specific"},
+{".import", "Godot Import", "Godot engine import file", "Configuration"},
+{".godot", "Godot Project", "Godot engine project file", "Configuration"},
+{".unity", "Unity Scene", "Unity game engine scene file", "Domain-Specific"},
+{".prefab", "Unity Prefab", "Reusable game object in Unity", "Domain-Specific"},
+{".asset", "Unity Asset", "Unity game engine asset file", "Domain-Specific"},
+{".meta", "Unity Meta", "Unity metadata file", "Configuration"},
+{".controller", "Unity Controller", "Unity animation controller", "Domain-Specific"},
+{".anim", "Unity Animation", "Unity animation file", "Domain-Specific"},
+{".physicmaterial", "Unity Physics Material", "Unity physics material", "Domain-Specific"},
+{".shader", "Unity Shader", "Shader program for the Unity game engine", "Domain-Specific"},
+{".cginc", "Unity Shader Include", "Unity shader include file", "Domain-Specific"},
+{".compute", "Unity Compute Shader", "Unity compute shader", "Domain-Specific"},
+{".shadergraph", "Unity Shader Graph", "Unity visual shader graph", "Domain-Specific"},
+{".uasset", "Unreal Asset", "Unreal Engine asset file", "Domain-Specific"},
+{".umap", "Unreal Map", "Unreal Engine level map", "Domain-Specific"},
+{".uproject", "Unreal Project", "Unreal Engine project file", "Configuration"},
+{".uplugin", "Unreal Plugin", "Unreal Engine plugin file", "Configuration"},
+{".usf", "Unreal Shader", "Unreal Engine shader file", "Domain-Specific"},
+{".ush", "Unreal Shader Header", "Unreal Engine shader header", "Domain-Specific"},
+{".uc", "UnrealScript", "Legacy scripting language for Unreal Engine 3", "Domain-Specific"},
+{".gml", "GameMaker Language", "Scripting language for GameMaker Studio", "Domain-Specific"},
+{".gmx", "GameMaker Resource", "GameMaker Studio resource file", "Domain-Specific"},
+{".yyp", "GameMaker Project", "GameMaker Studio 2 project file", "Configuration"},
+{".love", "LÖVE", "LÖVE game engine project", "Domain-Specific"},
+{".glsl", "GLSL", "OpenGL Shading Language for graphics programming", "Domain-Specific"},
+{".vert", "GLSL Vertex Shader", "Vertex shader for OpenGL graphics pipeline", "Domain-Specific"},
+{".frag", "GLSL Fragment Shader", "Fragment shader for OpenGL graphics pipeline", "Domain-Specific"},
+{".comp", "GLSL Compute Shader", "Compute shader for OpenGL general-purpose computing", "Domain-Specific"},
+{".geom", "GLSL Geometry Shader", "Geometry shader for OpenGL", "Domain-Specific"},
+{".tesc", "GLSL Tessellation Control", "Tessellation control shader for OpenGL", "Domain-Specific"},
+{".tese", "GLSL Tessellation Evaluation", "Tessellation evaluation shader for OpenGL", "Domain-Specific"},
+{".hlsl", "HLSL", "High-Level Shading Language for DirectX graphics", "Domain-Specific"},
+{".fx", "Effect Shader", "Effect file format for DirectX graphics", "Domain-Specific"},
+{".cso", "Compiled Shader Object", "Compiled DirectX shader", "Domain-Specific"},
+{".wgsl", "WebGPU Shader", "WebGPU Shading Language for web graphics", "Domain-Specific"},
+{".msl", "Metal Shading Language", "Apple's Metal Shading Language", "Domain-Specific"},
+{".shadrc", "Shadertoy", "Shadertoy shader configuration", "Domain-Specific"},
+{".sfz", "SFZ", "SFZ instrument definition format", "Domain-Specific"},
+{".blend", "Blender", "Blender 3D file", "Domain-Specific"},
+{".blend1", "Blender Backup", "Blender 3D file backup", "Domain-Specific"},
+{".fbx", "FBX", "Filmbox 3D model format", "Domain-Specific"},
+{".obj", "OBJ", "Wavefront 3D model format", "Domain-Specific"},
+{".mtl", "MTL", "Wavefront material template library", "Domain-Specific"},
+{".gltf", "glTF", "GL Transmission Format for 3D models", "Domain-Specific"},
+{".glb", "GLB", "Binary glTF format", "Domain-Specific"},
+{".pck", "Godot Pack", "Godot packed resource file", "Domain-Specific"},
+{".rpy", "Ren'Py", "Visual novel engine script", "Domain-Specific"},
+{".renpy", "Ren'Py", "Visual novel engine script", "Domain-Specific"},
+{".agc", "AppGameKit", "AppGameKit script", "Domain-Specific"},
+{".agk", "AppGameKit", "AppGameKit project", "Domain-Specific"},
+{".angelscript", "AngelScript", "Scripting language for games", "Domain-Specific"},
+{".cry", "CryEngine", "CryEngine script", "Domain-Specific"},
+{".cryproj", "CryEngine Project", "CryEngine project file", "Configuration"},
+{".vpc", "Valve Project", "Valve project configuration", "Configuration"},
 
 // BUILD SYSTEMS AND AUTOMATION
-{".mk", {"Makefile", "Build automation file defining targets and dependencies", "Scripting"}},
-{".mak", {"Makefile", "Build automation file defining targets and dependencies", "Scripting"}},
-{".makefile", {"Makefile", "Build automation file defining targets and dependencies", "Scripting"}},
-{".gnumakefile", {"GNU Makefile", "GNU Make specific makefile", "Scripting"}},
-{".cmake", {"CMake", "Cross-platform build system generator script", "Scripting"}},
-{".cmakelists.txt", {"CMakeLists", "CMake project definition file", "Scripting"}},
-{".in", {"CMake Input", "CMake input template file", "Configuration"}},
-{".gradle", {"Gradle", "Build automation system using Groovy or Kotlin DSL", "Scripting"}},
-{".gradle.kts", {"Gradle Kotlin", "Gradle build script using Kotlin DSL", "Scripting"}},
-{".ant", {"Ant", "XML-based build tool for Java projects", "Scripting"}},
-{".bzl", {"Bazel", "Build rule for the Bazel build system", "Scripting"}},
-{".bazel", {"Bazel", "Build file for the Bazel build system", "Scripting"}},
-{".bazelrc", {"Bazel Config", "Bazel configuration file", "Configuration"}},
-{".skylark", {"Skylark", "Bazel rule language", "Scripting"}},
-{".rake", {"Ruby Rake", "Ruby-based build utility similar to Make", "Scripting"}},
-{".Rakefile", {"Rakefile", "Ruby Rake build definition file", "Scripting"}},
-{".sbt", {"SBT", "Scala-based build tool for Scala and Java projects", "Scripting"}},
-{".buck", {"Buck", "Facebook's build system", "Scripting"}},
-{".buckconfig", {"Buck Config", "Buck build system configuration", "Configuration"}},
-{".pants", {"Pants", "Build system for monorepos", "Scripting"}},
-{".meson", {"Meson", "High-performance build system", "Scripting"}},
-{".meson.build", {"Meson Build", "Meson build definition file", "Scripting"}},
-{".ninja", {"Ninja", "Small build system focused on speed", "Scripting"}},
-{".gyp", {"GYP", "Generate Your Projects build tool", "Scripting"}},
-{".gypi", {"GYP Include", "GYP include file", "Scripting"}},
-{".gn", {"GN", "Generate Ninja build tool", "Scripting"}},
-{".gni", {"GN Include", "GN build system include file", "Scripting"}},
-{".jam", {"Jam", "Perforce Jam build system", "Scripting"}},
-{".pro", {"QMake", "Qt build system file", "Scripting"}},
-{".pri", {"QMake Include", "Qt QMake include file", "Scripting"}},
-{".xcodebuild", {"Xcode Build", "Xcode build configuration", "Scripting"}},
-{".pbxproj", {"Xcode Project", "Xcode project file", "Configuration"}},
-{".xcscheme", {"Xcode Scheme", "Xcode scheme file", "Configuration"}},
-{".vcxproj", {"Visual C++ Project", "Visual C++ project file", "Configuration"}},
-{".sln", {"Solution", "Visual Studio solution file", "Configuration"}},
-{".jenkinsfile", {"Jenkinsfile", "Pipeline definition for Jenkins CI/CD", "Scripting"}},
-{".travis.yml", {"Travis CI", "Configuration for Travis CI build system", "Configuration"}},
-{".github", {"GitHub Actions", "GitHub CI/CD workflow configuration", "Configuration"}},
-{".gitlab-ci.yml", {"GitLab CI", "Configuration for GitLab CI/CD pipeline", "Configuration"}},
-{".appveyor.yml", {"AppVeyor", "Configuration for AppVeyor CI service", "Configuration"}},
-{".circleci", {"CircleCI", "Configuration for CircleCI build system", "Configuration"}},
-{".drone.yml", {"Drone CI", "Configuration for Drone CI platform", "Configuration"}},
-{".azure-pipelines.yml", {"Azure Pipelines", "Configuration for Azure DevOps CI/CD", "Configuration"}},
-{".teamcity", {"TeamCity", "TeamCity CI configuration", "Configuration"}},
-{".github/workflows", {"GitHub Workflows", "GitHub Actions workflow definition", "Configuration"}},
-{".buildkite", {"BuildKite", "BuildKite CI configuration", "Configuration"}},
-{".codeship", {"Codeship", "Codeship CI configuration", "Configuration"}},
-{".bamboo-specs", {"Bamboo", "Bamboo CI configuration", "Configuration"}},
-{".build", {"Build File", "Generic build file", "Scripting"}},
+{".mk", "Makefile", "Build automation file defining targets and dependencies", "Scripting"},
+{".mak", "Makefile", "Build automation file defining targets and dependencies", "Scripting"},
+{".makefile", "Makefile", "Build automation file defining targets and dependencies", "Scripting"},
+{".gnumakefile", "GNU Makefile", "GNU Make specific makefile", "Scripting"},
+{".cmake", "CMake", "Cross-platform build system generator script", "Scripting"},
+{".cmakelists.txt", "CMakeLists", "CMake project definition file", "Scripting"},
+{".in", "CMake Input", "CMake input template file", "Configuration"},
+{".gradle.kts", "Gradle Kotlin", "Gradle build script using Kotlin DSL", "Scripting"},
+{".ant", "Ant", "XML-based build tool for Java projects", "Scripting"},
+{".bzl", "Bazel", "Build rule for the Bazel build system", "Scripting"},
+{".bazel", "Bazel", "Build file for the Bazel build system", "Scripting"},
+{".bazelrc", "Bazel Config", "Bazel configuration file", "Configuration"},
+{".skylark", "Skylark", "Bazel rule language", "Scripting"},
+{".rakefile", "Rakefile", "Ruby Rake build definition file", "Scripting"},
+{".buck", "Buck", "Facebook's build system", "Scripting"},
+{".buckconfig", "Buck Config", "Buck build system configuration", "Configuration"},
+{".pants", "Pants", "Build system for monorepos", "Scripting"},
+{".meson", "Meson", "High-performance build system", "Scripting"},
+{".meson.build", "Meson Build", "Meson build definition file", "Scripting"},
+{".ninja", "Ninja", "Small build system focused on speed", "Scripting"},
+{".gyp", "GYP", "Generate Your Projects build tool", "Scripting"},
+{".gypi", "GYP Include", "GYP include file", "Scripting"},
+{".gn", "GN", "Generate Ninja build tool", "Scripting"},
+{".gni", "GN Include", "GN build system include file", "Scripting"},
+{".jam", "Jam", "Perforce Jam build system", "Scripting"},
+{".pro", "QMake", "Qt build system file", "Scripting"},
+{".pri", "QMake Include", "Qt QMake include file", "Scripting"},
+{".xcodebuild", "Xcode Build", "Xcode build configuration", "Scripting"},
+{".xcscheme", "Xcode Scheme", "Xcode scheme file", "Configuration"},
+{".vcxproj", "Visual C++ Project", "Visual C++ project file", "Configuration"},
+{".jenkinsfile", "Jenkinsfile", "Pipeline definition for Jenkins CI/CD", "Scripting"},
+{".travis.yml", "Travis CI", "Configuration for Travis CI build system", "Configuration"},
+{".github", "GitHub Actions", "GitHub CI/CD workflow configuration", "Configuration"},
+{".gitlab-ci.yml", "GitLab CI", "Configuration for GitLab CI/CD pipeline", "Configuration"},
+{".appveyor.yml", "AppVeyor", "Configuration for AppVeyor CI service", "Configuration"},
+{".circleci", "CircleCI", "Configuration for CircleCI build system", "Configuration"},
+{".drone.yml", "Drone CI", "Configuration for Drone CI platform", "Configuration"},
+{".azure-pipelines.yml", "Azure Pipelines", "Configuration for Azure DevOps CI/CD", "Configuration"},
+{".teamcity", "TeamCity", "TeamCity CI configuration", "Configuration"},
+{".github/workflows", "GitHub Workflows", "GitHub Actions workflow definition", "Configuration"},
+{".buildkite", "BuildKite", "BuildKite CI configuration", "Configuration"},
+{".codeship", "Codeship", "Codeship CI configuration", "Configuration"},
+{".bamboo-specs", "Bamboo", "Bamboo CI configuration", "Configuration"},
+{".build", "Build File", "Generic build file", "Scripting"},
 
 // HARDWARE DESCRIPTION AND EMBEDDED SYSTEMS
-{".v", {"Verilog", "Hardware description language for modeling electronic systems", "Domain-Specific"}},
-{".sv", {"SystemVerilog", "Hardware description and verification language extending Verilog", "Domain-Specific"}},
-{".svh", {"SystemVerilog Header", "Header file for SystemVerilog", "Domain-Specific"}},
-{".vh", {"Verilog Header", "Header file for Verilog designs", "Domain-Specific"}},
-{".vhd", {"VHDL", "Hardware description language for digital circuits and systems", "Domain-Specific"}},
-{".vhdl", {"VHDL", "Hardware description language for digital circuits and systems", "Domain-Specific"}},
-{".vho", {"VHDL Output", "VHDL post-synthesis output file", "Domain-Specific"}},
-{".ucf", {"User Constraints", "User constraints file for FPGA design", "Domain-Specific"}},
-{".xdc", {"Xilinx Design Constraints", "Constraints file for Xilinx FPGAs", "Domain-Specific"}},
-{".sdc", {"Synopsys Design Constraints", "Timing constraints file", "Domain-Specific"}},
-{".qsf", {"Quartus Settings", "Altera/Intel Quartus settings file", "Configuration"}},
-{".qpf", {"Quartus Project", "Altera/Intel Quartus project file", "Configuration"}},
-{".ip", {"IP Core", "Intellectual property core for FPGA/ASIC", "Domain-Specific"}},
-{".bsv", {"BlueSpec", "BlueSpec SystemVerilog hardware description language", "Domain-Specific"}},
-{".chisel", {"Chisel", "Hardware construction language for Scala", "Domain-Specific"}},
-{".tclp", {"TCL Project", "Tcl project file for EDA tools", "Scripting"}},
-{".edif", {"EDIF", "Electronic Design Interchange Format", "Domain-Specific"}},
-{".spice", {"SPICE", "Simulation Program with Integrated Circuit Emphasis", "Domain-Specific"}},
-{".cir", {"Circuit", "SPICE circuit file", "Domain-Specific"}},
-{".lib", {"Liberty", "Liberty timing file format", "Domain-Specific"}},
-{".lef", {"LEF", "Library Exchange Format", "Domain-Specific"}},
-{".def", {"DEF", "Design Exchange Format", "Domain-Specific"}},
-{".gds", {"GDSII", "Graphic Data System II stream format", "Domain-Specific"}},
-{".sdf", {"SDF", "Standard Delay Format", "Domain-Specific"}},
-{".ino", {"Arduino", "Sketch for Arduino microcontroller programming", "Domain-Specific"}},
-{".pde", {"Processing", "Sketch for Processing visual arts programming environment", "Domain-Specific"}},
-{".dts", {"Device Tree", "Device specification for embedded Linux systems", "Domain-Specific"}},
-{".dtsi", {"Device Tree Include", "Include file for device tree specifications", "Domain-Specific"}},
-{".dtbo", {"Device Tree Blob Overlay", "Compiled device tree overlay binary", "Domain-Specific"}},
-{".dtb", {"Device Tree Blob", "Compiled device tree binary format", "Domain-Specific"}},
-{".kicad_pcb", {"KiCad PCB", "KiCad printed circuit board file", "Domain-Specific"}},
-{".kicad_sch", {"KiCad Schematic", "KiCad schematic file", "Domain-Specific"}},
-{".sch", {"Schematic", "Electronic schematic file", "Domain-Specific"}},
-{".brd", {"Board", "Printed circuit board layout file", "Domain-Specific"}},
-{".gbr", {"Gerber", "Gerber file for PCB manufacturing", "Domain-Specific"}},
-{".asm", {"Assembly", "Low-level programming language specific to a computer architecture", "Domain-Specific"}},
-{".s", {"Assembly", "Low-level programming language specific to a computer architecture", "Domain-Specific"}},
-{".S", {"Assembly", "Assembly with preprocessor directives", "Domain-Specific"}},
-{".nasm", {"NASM Assembly", "Netwide Assembler syntax assembly language", "Domain-Specific"}},
-{".arm", {"ARM Assembly", "Assembly for ARM architecture", "Domain-Specific"}},
-{".x86", {"x86 Assembly", "Assembly for x86 architecture", "Domain-Specific"}},
-{".riscv", {"RISC-V Assembly", "Assembly for RISC-V architecture", "Domain-Specific"}},
-{".mips", {"MIPS Assembly", "Assembly for MIPS architecture", "Domain-Specific"}},
-{".aarch64", {"AArch64 Assembly", "Assembly for 64-bit ARM architecture", "Domain-Specific"}},
-{".xasm", {"XASM", "Extended assembly language", "Domain-Specific"}},
-{".hex", {"Hex", "Hexadecimal object file format", "Domain-Specific"}},
-{".ihex", {"Intel HEX", "Intel hexadecimal object file format", "Domain-Specific"}},
-{".srec", {"SREC", "Motorola S-record format", "Domain-Specific"}},
-{".bin", {"Binary", "Raw binary file", "Domain-Specific"}},
-{".axf", {"ARM Executable", "ARM executable file", "Domain-Specific"}},
-{".elf", {"ELF", "Executable and Linkable Format", "Domain-Specific"}},
-{".o", {"Object File", "Compiled object file", "Domain-Specific"}},
-{".obj", {"Object File", "Compiled object file", "Domain-Specific"}},
-{".a", {"Static Library", "Unix static library", "Domain-Specific"}},
-{".lib", {"Library", "Windows static library", "Domain-Specific"}},
-{".eep", {"EEPROM", "EEPROM data file", "Domain-Specific"}},
-{".keil", {"Keil", "Keil MDK project file", "Configuration"}},
-{".uvproj", {"µVision Project", "Keil µVision project file", "Configuration"}},
-{".mcs", {"Memory Configuration", "Memory configuration file", "Configuration"}},
+{".sv", "SystemVerilog", "Hardware description and verification language extending Verilog", "Domain-Specific"},
+{".svh", "SystemVerilog Header", "Header file for SystemVerilog", "Domain-Specific"},
+{".vh", "Verilog Header", "Header file for Verilog designs", "Domain-Specific"},
+{".vhd", "VHDL", "Hardware description language for digital circuits and systems", "Domain-Specific"},
+{".vhdl", "VHDL", "Hardware description language for digital circuits and systems", "Domain-Specific"},
+{".vho", "VHDL Output", "VHDL post-synthesis output file", "Domain-Specific"},
+{".ucf", "User Constraints", "User constraints file for FPGA design", "Domain-Specific"},
+{".xdc", "Xilinx Design Constraints", "Constraints file for Xilinx FPGAs", "Domain-Specific"},
+{".sdc", "Synopsys Design Constraints", "Timing constraints file", "Domain-Specific"},
+{".qsf", "Quartus Settings", "Altera/Intel Quartus settings file", "Configuration"},
+{".qpf", "Quartus Project", "Altera/Intel Quartus project file", "Configuration"},
+{".ip", "IP Core", "Intellectual property core for FPGA/ASIC", "Domain-Specific"},
+{".bsv", "BlueSpec", "BlueSpec SystemVerilog hardware description language", "Domain-Specific"},
+{".chisel", "Chisel", "Hardware construction language for Scala", "Domain-Specific"},
+{".tclp", "TCL Project", "Tcl project file for EDA tools", "Scripting"},
+{".edif", "EDIF", "Electronic Design Interchange Format", "Domain-Specific"},
+{".spice", "SPICE", "Simulation Program with Integrated Circuit Emphasis", "Domain-Specific"},
+{".cir", "Circuit", "SPICE circuit file", "Domain-Specific"},
+{".lib", "Liberty", "Liberty timing file format", "Domain-Specific"},
+{".lef", "LEF", "Library Exchange Format", "Domain-Specific"},
+{".def", "DEF", "Design Exchange Format", "Domain-Specific"},
+{".gds", "GDSII", "Graphic Data System II stream format", "Domain-Specific"},
+{".sdf", "SDF", "Standard Delay Format", "Domain-Specific"},
+{".ino", "Arduino", "Sketch for Arduino microcontroller programming", "Domain-Specific"},
+{".pde", "Processing", "Sketch for Processing visual arts programming environment", "Domain-Specific"},
+{".dts", "Device Tree", "Device specification for embedded Linux systems", "Domain-Specific"},
+{".dtsi", "Device Tree Include", "Include file for device tree specifications", "Domain-Specific"},
+{".dtbo", "Device Tree Blob Overlay", "Compiled device tree overlay binary", "Domain-Specific"},
+{".dtb", "Device Tree Blob", "Compiled device tree binary format", "Domain-Specific"},
+{".kicad_pcb", "KiCad PCB", "KiCad printed circuit board file", "Domain-Specific"},
+{".kicad_sch", "KiCad Schematic", "KiCad schematic file", "Domain-Specific"},
+{".sch", "Schematic", "Electronic schematic file", "Domain-Specific"},
+{".brd", "Board", "Printed circuit board layout file", "Domain-Specific"},
+{".gbr", "Gerber", "Gerber file for PCB manufacturing", "Domain-Specific"},
+{".asm", "Assembly", "Low-level programming language specific to a computer architecture", "Domain-Specific"},
+{".s", "Assembly", "Low-level programming language specific to a computer architecture", "Domain-Specific"},
+{".nasm", "NASM Assembly", "Netwide Assembler syntax assembly language", "Domain-Specific"},
+{".arm", "ARM Assembly", "Assembly for ARM architecture", "Domain-Specific"},
+{".x86", "x86 Assembly", "Assembly for x86 architecture", "Domain-Specific"},
+{".riscv", "RISC-V Assembly", "Assembly for RISC-V architecture", "Domain-Specific"},
+{".mips", "MIPS Assembly", "Assembly for MIPS architecture", "Domain-Specific"},
+{".aarch64", "AArch64 Assembly", "Assembly for 64-bit ARM architecture", "Domain-Specific"},
+{".xasm", "XASM", "Extended assembly language", "Domain-Specific"},
+{".hex", "Hex", "Hexadecimal object file format", "Domain-Specific"},
+{".ihex", "Intel HEX", "Intel hexadecimal object file format", "Domain-Specific"},
+{".srec", "SREC", "Motorola S-record format", "Domain-Specific"},
+{".bin", "Binary", "Raw binary file", "Domain-Specific"},
+{".axf", "ARM Executable", "ARM executable file", "Domain-Specific"},
+{".elf", "ELF", "Executable and Linkable Format", "Domain-Specific"},
+{".o", "Object File", "Compiled object file", "Domain-Specific"},
+{".a", "Static Library", "Unix static library", "Domain-Specific"},
+{".eep", "EEPROM", "EEPROM data file", "Domain-Specific"},
+{".keil", "Keil", "Keil MDK project file", "Configuration"},
+{".uvproj", "µVision Project", "Keil µVision project file", "Configuration"},
+{".mcs", "Memory Configuration", "Memory configuration file", "Configuration"},
 
 // VERSION CONTROL AND CI/CD
-{".git", {"Git", "Git version control directory", "Configuration"}},
-{".gitignore", {"Git Ignore", "Specifies intentionally untracked files to ignore", "Configuration"}},
-{".gitattributes", {"Git Attributes", "Defines attributes for paths in Git repository", "Configuration"}},
-{".gitmodules", {"Git Modules", "Defines submodule properties for Git", "Configuration"}},
-{".gitconfig", {"Git Config", "Git configuration file", "Configuration"}},
-{".gitkeep", {"Git Keep", "Placeholder file to keep directory in Git", "Configuration"}},
-{".github", {"GitHub", "GitHub specific configuration directory", "Configuration"}},
-{".gitlab", {"GitLab", "GitLab specific configuration directory", "Configuration"}},
-{".hg", {"Mercurial", "Mercurial version control directory", "Configuration"}},
-{".hgignore", {"Mercurial Ignore", "Mercurial ignore file", "Configuration"}},
-{".hgeol", {"Mercurial EOL", "Mercurial end-of-line configuration", "Configuration"}},
-{".hgrc", {"Mercurial Config", "Mercurial configuration file", "Configuration"}},
-{".svn", {"Subversion", "Subversion version control directory", "Configuration"}},
-{".svnignore", {"Subversion Ignore", "Subversion ignore file", "Configuration"}},
-{".bzr", {"Bazaar", "Bazaar version control directory", "Configuration"}},
-{".bzrignore", {"Bazaar Ignore", "Bazaar ignore file", "Configuration"}},
-{".cvs", {"CVS", "CVS version control directory", "Configuration"}},
-{".cvsignore", {"CVS Ignore", "CVS ignore file", "Configuration"}},
-{".dockerignore", {"Docker Ignore", "Specifies files and directories to exclude from Docker builds", "Configuration"}},
-{".lintstagedrc", {"Lint Staged", "Configuration for lint-staged", "Configuration"}},
-{".eslintrc", {"ESLint Config", "Configuration file for JavaScript linting", "Configuration"}},
-{".eslintignore", {"ESLint Ignore", "ESLint ignore file", "Configuration"}},
-{".stylelintrc", {"Stylelint Config", "Configuration file for CSS linting", "Configuration"}},
-{".stylelintignore", {"Stylelint Ignore", "Stylelint ignore file", "Configuration"}},
-{".prettierrc", {"Prettier Config", "Configuration file for code formatting", "Configuration"}},
-{".prettierignore", {"Prettier Ignore", "Prettier ignore file", "Configuration"}},
-{".editorconfig", {"EditorConfig", "File format defining coding styles across editors", "Configuration"}},
-{".jshintrc", {"JSHint Config", "JSHint configuration file", "Configuration"}},
-{".jshintignore", {"JSHint Ignore", "JSHint ignore file", "Configuration"}},
-{".jscsrc", {"JSCS Config", "JavaScript Code Style configuration", "Configuration"}},
-{".jslintrc", {"JSLint Config", "JSLint configuration file", "Configuration"}},
-{".markdownlint.json", {"Markdown Lint", "Markdown linter configuration", "Configuration"}},
-{".mdlrc", {"Markdown Lint", "Markdown linter configuration", "Configuration"}},
-{".htmlhintrc", {"HTMLHint", "HTML linter configuration", "Configuration"}},
-{".csslintrc", {"CSSLint", "CSS linter configuration", "Configuration"}},
-{".sass-lint.yml", {"Sass Lint", "Sass linter configuration", "Configuration"}},
-{".travis.yml", {"Travis CI", "Configuration for Travis CI build system", "Configuration"}},
-{".gitlab-ci.yml", {"GitLab CI", "Configuration for GitLab CI/CD pipeline", "Configuration"}},
-{".appveyor.yml", {"AppVeyor", "Configuration for AppVeyor CI service", "Configuration"}},
-{".circleci", {"CircleCI", "Configuration for CircleCI build system", "Configuration"}},
-{".drone.yml", {"Drone CI", "Configuration for Drone CI platform", "Configuration"}},
-{".azure-pipelines.yml", {"Azure Pipelines", "Configuration for Azure DevOps CI/CD", "Configuration"}},
-{".github/workflows", {"GitHub Actions", "Workflow definitions for GitHub's CI/CD", "Configuration"}},
-{".dependabot", {"Dependabot", "Dependency update configuration", "Configuration"}},
-{".pre-commit-config.yaml", {"Pre-commit", "Pre-commit hooks configuration", "Configuration"}},
-{".npmrc", {"NPM Config", "Configuration file for NPM package manager", "Configuration"}},
-{".yarnrc", {"Yarn Config", "Configuration file for Yarn package manager", "Configuration"}},
-{".flowconfig", {"Flow Config", "Configuration for Flow type checker", "Configuration"}},
-{".huskyrc", {"Husky", "Git hooks configuration", "Configuration"}},
-{".releaserc", {"Semantic Release", "Semantic Release configuration", "Configuration"}},
-{".commitlintrc", {"Commitlint", "Commit message linter configuration", "Configuration"}},
-{".lintstagedrc", {"Lint Staged", "Lint staged files configuration", "Configuration"}},
-{".storybook", {"Storybook", "Storybook configuration directory", "Configuration"}},
-{".sentryclirc", {"Sentry CLI", "Sentry CLI configuration", "Configuration"}},
-{".coveragerc", {"Coverage", "Test coverage configuration", "Configuration"}},
-{".snyk", {"Snyk", "Snyk security testing configuration", "Configuration"}},
-{".hadolint.yaml", {"Hadolint", "Dockerfile linter configuration", "Configuration"}},
-{".sonarqube", {"SonarQube", "SonarQube configuration", "Configuration"}},
-{".percy.yml", {"Percy", "Percy visual testing configuration", "Configuration"}},
-{".codeqlconfig.yml", {"CodeQL", "CodeQL analysis configuration", "Configuration"}},
-{".deepscan.json", {"DeepScan", "DeepScan static analysis configuration", "Configuration"}},
+{".git", "Git", "Git version control directory", "Configuration"},
+{".gitignore", "Git Ignore", "Specifies intentionally untracked files to ignore", "Configuration"},
+{".gitattributes", "Git Attributes", "Defines attributes for paths in Git repository", "Configuration"},
+{".gitmodules", "Git Modules", "Defines submodule properties for Git", "Configuration"},
+{".gitconfig", "Git Config", "Git configuration file", "Configuration"},
+{".gitkeep", "Git Keep", "Placeholder file to keep directory in Git", "Configuration"},
+{".gitlab", "GitLab", "GitLab specific configuration directory", "Configuration"},
+{".hg", "Mercurial", "Mercurial version control directory", "Configuration"},
+{".hgignore", "Mercurial Ignore", "Mercurial ignore file", "Configuration"},
+{".hgeol", "Mercurial EOL", "Mercurial end-of-line configuration", "Configuration"},
+{".hgrc", "Mercurial Config", "Mercurial configuration file", "Configuration"},
+{".svn", "Subversion", "Subversion version control directory", "Configuration"},
+{".svnignore", "Subversion Ignore", "Subversion ignore file", "Configuration"},
+{".bzr", "Bazaar", "Bazaar version control directory", "Configuration"},
+{".bzrignore", "Bazaar Ignore", "Bazaar ignore file", "Configuration"},
+{".cvs", "CVS", "CVS version control directory", "Configuration"},
+{".cvsignore", "CVS Ignore", "CVS ignore file", "Configuration"},
+{".dockerignore", "Docker Ignore", "Specifies files and directories to exclude from Docker builds", "Configuration"},
+{".lintstagedrc", "Lint Staged", "Configuration for lint-staged", "Configuration"},
+{".stylelintignore", "Stylelint Ignore", "Stylelint ignore file", "Configuration"},
+{".jshintrc", "JSHint Config", "JSHint configuration file", "Configuration"},
+{".jshintignore", "JSHint Ignore", "JSHint ignore file", "Configuration"},
+{".jscsrc", "JSCS Config", "JavaScript Code Style configuration", "Configuration"},
+{".jslintrc", "JSLint Config", "JSLint configuration file", "Configuration"},
+{".markdownlint.json", "Markdown Lint", "Markdown linter configuration", "Configuration"},
+{".mdlrc", "Markdown Lint", "Markdown linter configuration", "Configuration"},
+{".htmlhintrc", "HTMLHint", "HTML linter configuration", "Configuration"},
+{".csslintrc", "CSSLint", "CSS linter configuration", "Configuration"},
+{".sass-lint.yml", "Sass Lint", "Sass linter configuration", "Configuration"},
+{".dependabot", "Dependabot", "Dependency update configuration", "Configuration"},
+{".pre-commit-config.yaml", "Pre-commit", "Pre-commit hooks configuration", "Configuration"},
+{".flowconfig", "Flow Config", "Configuration for Flow type checker", "Configuration"},
+{".huskyrc", "Husky", "Git hooks configuration", "Configuration"},
+{".releaserc", "Semantic Release", "Semantic Release configuration", "Configuration"},
+{".commitlintrc", "Commitlint", "Commit message linter configuration", "Configuration"},
+{".sentryclirc", "Sentry CLI", "Sentry CLI configuration", "Configuration"},
+{".coveragerc", "Coverage", "Test coverage configuration", "Configuration"},
+{".snyk", "Snyk", "Snyk security testing configuration", "Configuration"},
+{".hadolint.yaml", "Hadolint", "Dockerfile linter configuration", "Configuration"},
+{".sonarqube", "SonarQube", "SonarQube configuration", "Configuration"},
+{".percy.yml", "Percy", "Percy visual testing configuration", "Configuration"},
+{".codeqlconfig.yml", "CodeQL", "CodeQL analysis configuration", "Configuration"},
+{".deepscan.json", "DeepScan", "DeepScan static analysis configuration", "Configuration"},
 
 // CONTAINER AND INFRASTRUCTURE AS CODE
-{".dockerfile", {"Dockerfile", "Instructions for building a Docker container image", "Configuration"}},
-{".dockerignore", {"Docker Ignore", "Files to exclude from Docker context", "Configuration"}},
-{".docker-compose.yml", {"Docker Compose", "Multi-container Docker applications definition", "Configuration"}},
-{".kubernetes", {"Kubernetes", "Kubernetes resource definition files", "Configuration"}},
-{".k8s", {"Kubernetes", "Kubernetes resource definition files", "Configuration"}},
-{".kube", {"Kubernetes", "Kubernetes configuration directory", "Configuration"}},
-{".helm", {"Helm Chart", "Package manager for Kubernetes applications", "Configuration"}},
-{".helmignore", {"Helm Ignore", "Helm chart ignore file", "Configuration"}},
-{".tf", {"Terraform", "Infrastructure as code for cloud resources provisioning", "Configuration"}},
-{".tfvars", {"Terraform Variables", "Variable definitions for Terraform", "Configuration"}},
-{".tfstate", {"Terraform State", "Terraform state file", "Configuration"}},
-{".terraformrc", {"Terraform Config", "Terraform CLI configuration", "Configuration"}},
-{".cloudformation", {"CloudFormation", "AWS infrastructure as code template", "Configuration"}},
-{".cf", {"CloudFormation", "AWS infrastructure as code template", "Configuration"}},
-{".cft", {"CloudFormation", "AWS CloudFormation template", "Configuration"}},
-{".cfn", {"CloudFormation", "AWS CloudFormation template", "Configuration"}},
-{".sam", {"AWS SAM", "AWS Serverless Application Model", "Configuration"}},
-{".ansible", {"Ansible", "IT automation playbook", "Configuration"}},
-{".ansible.cfg", {"Ansible Config", "Ansible configuration file", "Configuration"}},
-{".ansible-lint", {"Ansible Lint", "Ansible linter configuration", "Configuration"}},
-{".vagrantfile", {"Vagrant", "Virtual development environments configuration", "Configuration"}},
-{".chef", {"Chef", "Configuration management recipes", "Configuration"}},
-{".kitchen.yml", {"Test Kitchen", "Chef test environment configuration", "Configuration"}},
-{".berksfile", {"Berkshelf", "Chef cookbook dependency manager", "Configuration"}},
-{".chefignore", {"Chef Ignore", "Chef ignore file", "Configuration"}},
-{".puppet", {"Puppet", "Configuration management manifests", "Configuration"}},
-{".puppetfile", {"Puppetfile", "Puppet module dependency manager", "Configuration"}},
-{".salt", {"Salt", "SaltStack configuration management", "Configuration"}},
-{".nix", {"Nix", "Purely functional package manager and OS configuration", "Configuration"}},
-{".nixos", {"NixOS", "NixOS system configuration", "Configuration"}},
-{".pulumi", {"Pulumi", "Infrastructure as code in programming languages", "Configuration"}},
-{".serverless", {"Serverless", "Serverless Framework configuration", "Configuration"}},
-{".amplify", {"AWS Amplify", "AWS Amplify configuration", "Configuration"}},
-{".cdk", {"AWS CDK", "AWS Cloud Development Kit", "Configuration"}},
-{".azure", {"Azure", "Azure cloud configuration", "Configuration"}},
-{".gclouds", {"Google Cloud", "Google Cloud configuration", "Configuration"}},
-{".skaffold.yaml", {"Skaffold", "Kubernetes application development tool", "Configuration"}},
-{".kustomize", {"Kustomize", "Kubernetes resource customization", "Configuration"}},
-{".kustomization.yaml", {"Kustomization", "Kustomize configuration file", "Configuration"}},
-{".argo", {"Argo CD", "GitOps continuous delivery for Kubernetes", "Configuration"}},
-{".istio", {"Istio", "Service mesh configuration", "Configuration"}},
-{".linkerd", {"Linkerd", "Service mesh configuration", "Configuration"}},
-{".openshift", {"OpenShift", "Red Hat OpenShift configuration", "Configuration"}},
-{".rancher", {"Rancher", "Kubernetes management platform configuration", "Configuration"}},
-{".consul", {"Consul", "Service mesh configuration", "Configuration"}},
-{".envoy", {"Envoy", "Edge and service proxy configuration", "Configuration"}},
-{".vault", {"Vault", "Secret management configuration", "Configuration"}},
-{".packer", {"Packer", "Machine image creation configuration", "Configuration"}},
-{".nomad", {"Nomad", "Workload orchestrator configuration", "Configuration"}},
-{".waypoint", {"Waypoint", "Application build/deploy configuration", "Configuration"}},
-{".boundary", {"Boundary", "Identity-based access management", "Configuration"}},
-{".tekton", {"Tekton", "Kubernetes native CI/CD configuration", "Configuration"}},
-{".concourse.yml", {"Concourse", "Concourse CI pipeline configuration", "Configuration"}},
-{".prometheus", {"Prometheus", "Monitoring system configuration", "Configuration"}},
-{".grafana", {"Grafana", "Observability platform configuration", "Configuration"}},
-{".fluentd", {"Fluentd", "Data collector configuration", "Configuration"}},
-{".logstash", {"Logstash", "Data processing pipeline configuration", "Configuration"}},
-{".kibana", {"Kibana", "Data visualization configuration", "Configuration"}},
-{".elasticsearch", {"Elasticsearch", "Search engine configuration", "Configuration"}},
-{".jaeger", {"Jaeger", "Distributed tracing configuration", "Configuration"}},
-{".kong", {"Kong", "API gateway configuration", "Configuration"}},
+{".dockerfile", "Dockerfile", "Instructions for building a Docker container image", "Configuration"},
+{".docker-compose.yml", "Docker Compose", "Multi-container Docker applications definition", "Configuration"},
+{".kubernetes", "Kubernetes", "Kubernetes resource definition files", "Configuration"},
+{".k8s", "Kubernetes", "Kubernetes resource definition files", "Configuration"},
+{".kube", "Kubernetes", "Kubernetes configuration directory", "Configuration"},
+{".helm", "Helm Chart", "Package manager for Kubernetes applications", "Configuration"},
+{".helmignore", "Helm Ignore", "Helm chart ignore file", "Configuration"},
+{".tf", "Terraform", "Infrastructure as code for cloud resources provisioning", "Configuration"},
+{".terraformrc", "Terraform Config", "Terraform CLI configuration", "Configuration"},
+{".cloudformation", "CloudFormation", "AWS infrastructure as code template", "Configuration"},
+{".cf", "CloudFormation", "AWS infrastructure as code template", "Configuration"},
+{".cft", "CloudFormation", "AWS CloudFormation template", "Configuration"},
+{".cfn", "CloudFormation", "AWS CloudFormation template", "Configuration"},
+{".sam", "AWS SAM", "AWS Serverless Application Model", "Configuration"},
+{".ansible", "Ansible", "IT automation playbook", "Configuration"},
+{".ansible.cfg", "Ansible Config", "Ansible configuration file", "Configuration"},
+{".ansible-lint", "Ansible Lint", "Ansible linter configuration", "Configuration"},
+{".vagrantfile", "Vagrant", "Virtual development environments configuration", "Configuration"},
+{".chef", "Chef", "Configuration management recipes", "Configuration"},
+{".kitchen.yml", "Test Kitchen", "Chef test environment configuration", "Configuration"},
+{".berksfile", "Berkshelf", "Chef cookbook dependency manager", "Configuration"},
+{".chefignore", "Chef Ignore", "Chef ignore file", "Configuration"},
+{".puppet", "Puppet", "Configuration management manifests", "Configuration"},
+{".puppetfile", "Puppetfile", "Puppet module dependency manager", "Configuration"},
+{".salt", "Salt", "SaltStack configuration management", "Configuration"},
+{".nix", "Nix", "Purely functional package manager and OS configuration", "Configuration"},
+{".nixos", "NixOS", "NixOS system configuration", "Configuration"},
+{".pulumi", "Pulumi", "Infrastructure as code in programming languages", "Configuration"},
+{".serverless", "Serverless", "Serverless Framework configuration", "Configuration"},
+{".amplify", "AWS Amplify", "AWS Amplify configuration", "Configuration"},
+{".cdk", "AWS CDK", "AWS Cloud Development Kit", "Configuration"},
+{".azure", "Azure", "Azure cloud configuration", "Configuration"},
+{".gclouds", "Google Cloud", "Google Cloud configuration", "Configuration"},
+{".skaffold.yaml", "Skaffold", "Kubernetes application development tool", "Configuration"},
+{".kustomize", "Kustomize", "Kubernetes resource customization", "Configuration"},
+{".kustomization.yaml", "Kustomization", "Kustomize configuration file", "Configuration"},
+{".argo", "Argo CD", "GitOps continuous delivery for Kubernetes", "Configuration"},
+{".istio", "Istio", "Service mesh configuration", "Configuration"},
+{".linkerd", "Linkerd", "Service mesh configuration", "Configuration"},
+{".openshift", "OpenShift", "Red Hat OpenShift configuration", "Configuration"},
+{".rancher", "Rancher", "Kubernetes management platform configuration", "Configuration"},
+{".consul", "Consul", "Service mesh configuration", "Configuration"},
+{".envoy", "Envoy", "Edge and service proxy configuration", "Configuration"},
+{".vault", "Vault", "Secret management configuration", "Configuration"},
+{".packer", "Packer", "Machine image creation configuration", "Configuration"},
+{".nomad", "Nomad", "Workload orchestrator configuration", "Configuration"},
+{".waypoint", "Waypoint", "Application build/deploy configuration", "Configuration"},
+{".boundary", "Boundary", "Identity-based access management", "Configuration"},
+{".tekton", "Tekton", "Kubernetes native CI/CD configuration", "Configuration"},
+{".concourse.yml", "Concourse", "Concourse CI pipeline configuration", "Configuration"},
+{".prometheus", "Prometheus", "Monitoring system configuration", "Configuration"},
+{".grafana", "Grafana", "Observability platform configuration", "Configuration"},
+{".fluentd", "Fluentd", "Data collector configuration", "Configuration"},
+{".logstash", "Logstash", "Data processing pipeline configuration", "Configuration"},
+{".kibana", "Kibana", "Data visualization configuration", "Configuration"},
+{".elasticsearch", "Elasticsearch", "Search engine configuration", "Configuration"},
+{".jaeger", "Jaeger", "Distributed tracing configuration", "Configuration"},
+{".kong", "Kong", "API gateway configuration", "Configuration"},
 
 // MISCELLANEOUS
-{".license", {"License", "Software license file", "Configuration"}},
-{".license.txt", {"License", "Software license file", "Configuration"}},
-{".license.md", {"License", "Software license file in markdown format", "Configuration"}},
-{".copying", {"License", "Software license file (GNU tradition)", "Configuration"}},
-{".copyright", {"Copyright", "Copyright notice file", "Configuration"}},
-{".authors", {"Authors", "List of project authors", "Configuration"}},
-{".contributors", {"Contributors", "List of project contributors", "Configuration"}},
-{".codeowners", {"Code Owners", "GitHub CODEOWNERS file defining code ownership", "Configuration"}},
-{".mailmap", {"Git Mailmap", "Git mail mapping for name/email consolidation", "Configuration"}},
-{".md5", {"MD5 Checksum", "MD5 checksum verification file", "Configuration"}},
-{".sha1", {"SHA-1 Checksum", "SHA-1 checksum verification file", "Configuration"}},
-{".sha256", {"SHA-256 Checksum", "SHA-256 checksum verification file", "Configuration"}},
-{".sha512", {"SHA-512 Checksum", "SHA-512 checksum verification file", "Configuration"}},
-{".sig", {"Signature", "Digital signature file", "Configuration"}},
-{".asc", {"ASCII Armored", "ASCII-armored PGP signature", "Configuration"}},
-{".key", {"Key", "Cryptographic key file", "Configuration"}},
-{".pem", {"PEM", "Privacy Enhanced Mail certificate", "Configuration"}},
-{".crt", {"Certificate", "Security certificate", "Configuration"}},
-{".cer", {"Certificate", "Security certificate", "Configuration"}},
-{".p12", {"PKCS#12", "Digital certificate container format", "Configuration"}},
-{".pfx", {"PFX", "Personal Exchange Format certificate", "Configuration"}},
-{".jks", {"Java KeyStore", "Java KeyStore secure storage", "Configuration"}},
-{".keystore", {"KeyStore", "Cryptographic key storage", "Configuration"}},
-{".truststore", {"TrustStore", "Trusted certificate storage", "Configuration"}},
-{".htaccess", {"Apache Config", "Apache web server directory configuration", "Configuration"}},
-{".htpasswd", {"Apache Password", "Apache web server password file", "Configuration"}},
-{".nginx", {"Nginx Config", "Nginx web server configuration", "Configuration"}},
-{".vcl", {"Varnish Config", "Varnish Cache configuration", "Configuration"}},
-{".haproxy", {"HAProxy", "HAProxy load balancer configuration", "Configuration"}},
-{".traefik", {"Traefik", "Traefik proxy configuration", "Configuration"}},
-{".caddy", {"Caddy", "Caddy web server configuration", "Configuration"}},
-{".sudoers", {"Sudoers", "Sudo privileges configuration", "Configuration"}},
-{".hosts", {"Hosts", "Hosts file mapping hostnames to IP addresses", "Configuration"}},
-{".nsswitch.conf", {"NSS Switch", "Name Service Switch configuration", "Configuration"}},
-{".exports", {"NFS Exports", "NFS exports configuration", "Configuration"}},
-{".fstab", {"Filesystem Table", "Filesystem mount configuration", "Configuration"}},
-{".crontab", {"Crontab", "Scheduled tasks configuration", "Configuration"}},
-{".systemd", {"Systemd", "Systemd service manager configuration", "Configuration"}},
-{".socket", {"Systemd Socket", "Socket unit configuration for systemd", "Configuration"}},
-{".device", {"Systemd Device", "Device unit configuration for systemd", "Configuration"}},
-{".mount", {"Systemd Mount", "Mount unit configuration for systemd", "Configuration"}},
-{".automount", {"Systemd Automount", "Automount unit configuration for systemd", "Configuration"}},
-{".service", {"Systemd Service", "Service unit configuration for systemd", "Configuration"}},
-{".timer", {"Systemd Timer", "Timer unit configuration for systemd", "Configuration"}},
-{".target", {"Systemd Target", "Target unit configuration for systemd", "Configuration"}},
-{".path", {"Systemd Path", "Path unit configuration for systemd", "Configuration"}},
-{".slice", {"Systemd Slice", "Slice unit configuration for systemd", "Configuration"}},
-{".script", {"Systemd Script", "Script for systemd", "Configuration"}},
-{".diff", {"Diff", "File difference format showing changes between files", "Configuration"}},
-{".patch", {"Patch", "File containing changes to be applied to files", "Configuration"}},
-{".log", {"Log", "Log file containing recorded events or messages", "Configuration"}},
-{".lock", {"Lock File", "Dependency lock file ensuring reproducible builds", "Configuration"}},
-{".tmp", {"Temporary", "Temporary file", "Configuration"}},
-{".temp", {"Temporary", "Temporary file", "Configuration"}},
-{".cache", {"Cache", "Cached data file", "Configuration"}},
-{".bak", {"Backup", "Backup file", "Configuration"}},
-{".old", {"Old", "Old version of a file", "Configuration"}},
-{".orig", {"Original", "Original version of a file", "Configuration"}},
-{".swp", {"Swap", "Vim swap file", "Configuration"}},
-{".swo", {"Swap", "Vim swap file", "Configuration"}},
-{".swn", {"Swap", "Vim swap file", "Configuration"}},
-{".desktop", {"Desktop Entry", "FreeDesktop desktop entry file", "Configuration"}},
-{".appdata.xml", {"AppData", "Application metadata for Linux", "Configuration"}},
-{".metainfo.xml", {"MetaInfo", "Component metadata for Linux", "Configuration"}},
-{".thumbs.db", {"Thumbs DB", "Windows thumbnail cache", "Configuration"}},
-{".ds_store", {"DS Store", "macOS folder metadata", "Configuration"}},
-{".localized", {"Localized", "macOS folder localization", "Configuration"}},
-{".manifest", {"Manifest", "Application manifest file", "Configuration"}},
-{".rc", {"Run Command", "Generic runtime configuration file", "Configuration"}},
-{".reg", {"Registry", "Windows registry file", "Configuration"}},
-{".suo", {"Solution User Options", "Visual Studio user options", "Configuration"}},
-{".sln.docstates", {"Solution Document States", "Visual Studio document states", "Configuration"}},
-{".vcxproj.filters", {"Visual C++ Filters", "Visual C++ project filters", "Configuration"}},
-{".pdb", {"Program Database", "Debug symbols file", "Configuration"}},
-{".ilk", {"Incremental Link", "Visual Studio incremental linking file", "Configuration"}},
-{".exp", {"Export", "Export information file", "Configuration"}},
-{".map", {"Map", "Source map file for debugging", "Configuration"}},
-{".bundle", {"Bundle", "Generic bundled resources", "Configuration"}},
-{".gyb", {"Generate Your Boilerplate", "Swift code generation template", "Configuration"}},
-{".inc", {"Include", "Included file for various languages", "General-Purpose"}},
-{".sublime-project", {"Sublime Text Project", "Sublime Text project file", "Configuration"}},
-{".sublime-workspace", {"Sublime Text Workspace", "Sublime Text workspace file", "Configuration"}},
-{".vscode", {"Visual Studio Code", "VS Code configuration directory", "Configuration"}},
-{".code-workspace", {"VS Code Workspace", "VS Code workspace file", "Configuration"}},
-{".idea", {"IntelliJ IDEA", "IntelliJ IDEA configuration directory", "Configuration"}},
-{".settings", {"Eclipse Settings", "Eclipse IDE settings directory", "Configuration"}},
-{".project", {"Eclipse Project", "Eclipse project file", "Configuration"}},
-{".classpath", {"Eclipse Classpath", "Eclipse Java classpath file", "Configuration"}},
-{".factorypath", {"Eclipse Factorypath", "Eclipse annotation processor path", "Configuration"}},
-{".pydevproject", {"PyDev Project", "Eclipse PyDev project file", "Configuration"}},
-{".spyderproject", {"Spyder Project", "Spyder IDE project file", "Configuration"}},
-{".spyproject", {"Spyder Project", "Spyder IDE project directory", "Configuration"}},
-{".ropeproject", {"Rope Project", "Python refactoring library project", "Configuration"}},
-{".clang-format", {"Clang Format", "Clang code formatter configuration", "Configuration"}},
-{".clangd", {"Clang", "Clang language server configuration", "Configuration"}},
-{".pycache", {"Python Cache", "Python compiled code cache", "Configuration"}},
-{".pytest_cache", {"Pytest Cache", "Pytest cache directory", "Configuration"}},
-{".mypy_cache", {"MyPy Cache", "MyPy type checker cache", "Configuration"}},
-{".ipynb_checkpoints", {"Jupyter Checkpoints", "Jupyter notebook checkpoints", "Configuration"}},
-{".egg-info", {"Egg Info", "Python package metadata", "Configuration"}},
-{".tox", {"Tox", "Python testing environment", "Configuration"}},
-{".nox", {"Nox", "Python testing environment", "Configuration"}},
-{".pants.d", {"Pants", "Pants build system cache", "Configuration"}},
-{".gradle", {"Gradle", "Gradle build system directory", "Configuration"}},
-{".m2", {"Maven", "Maven repository directory", "Configuration"}},
-{".bsp", {"Build Server Protocol", "Build server protocol directory", "Configuration"}},
-{".metals", {"Metals", "Scala language server directory", "Configuration"}},
-{".mill", {"Mill", "Mill build tool directory", "Configuration"}},
-{".bloop", {"Bloop", "Scala build server directory", "Configuration"}},
-{".ensime", {"ENSIME", "ENhanced Scala Interaction Mode for Emacs", "Configuration"}},
-{".sbtopts", {"SBT Options", "SBT command line options", "Configuration"}},
-{".jvmopts", {"JVM Options", "JVM command line options", "Configuration"}},
-{".ghc.environment", {"GHC Environment", "Glasgow Haskell Compiler environment", "Configuration"}},
-{".stack-work", {"Stack Work", "Haskell Stack work directory", "Configuration"}},
-{".cabal", {"Cabal", "Haskell Cabal package description", "Configuration"}},
-{".kateconfig", {"Kate Config", "Kate editor configuration", "Configuration"}},
-{".vimrc", {"Vim Config", "Vim editor configuration", "Configuration"}},
-{".nvimrc", {"Neovim Config", "Neovim editor configuration", "Configuration"}},
-{".emacs", {"Emacs Config", "Emacs editor configuration", "Configuration"}},
-{".spacemacs", {"Spacemacs Config", "Spacemacs configuration", "Configuration"}},
-{".doom.d", {"Doom Emacs", "Doom Emacs configuration", "Configuration"}},
-{".tmux.conf", {"Tmux Config", "Tmux terminal multiplexer configuration", "Configuration"}},
-{".screenrc", {"Screen Config", "GNU Screen configuration", "Configuration"}},
-{".direnv", {"Direnv", "Directory-specific environment", "Configuration"}},
-{".envrc", {"Direnv RC", "Direnv configuration file", "Configuration"}},
-{".prof", {"Profile", "Profiling information", "Configuration"}},
-{".coverage", {"Coverage", "Code coverage data", "Configuration"}},
-{".gcno", {"GCC Coverage", "GCC coverage notes file", "Configuration"}},
-{".gcda", {"GCC Coverage Data", "GCC coverage data file", "Configuration"}},
-{".a", {"Static Library", "Static library archive", "Domain-Specific"}},
-{".la", {"Libtool Archive", "Libtool library archive", "Domain-Specific"}},
-{".lo", {"Libtool Object", "Libtool object file", "Domain-Specific"}},
-{".lib", {"Library", "Generic library file", "Domain-Specific"}},
-{".dll", {"Dynamic Link Library", "Windows shared library", "Domain-Specific"}},
-{".so", {"Shared Object", "Unix/Linux shared library", "Domain-Specific"}},
-{".dylib", {"Dynamic Library", "macOS shared library", "Domain-Specific"}},
-{".jnilib", {"JNI Library", "Java Native Interface library", "Domain-Specific"}},
-{".framework", {"Framework", "macOS framework bundle", "Domain-Specific"}},
-{".jsm", {"JavaScript Module", "JavaScript module", "General-Purpose"}},
-{".mjs", {"ECMAScript Module", "ECMAScript module", "General-Purpose"}},
-{".cjs", {"CommonJS Module", "CommonJS module", "General-Purpose"}},
-{".node", {"Node.js Addon", "Node.js native addon", "Domain-Specific"}},
-{".sln", {"Solution", "Visual Studio solution file", "Configuration"}},
-{".suo", {"Solution User Options", "Visual Studio solution user options", "Configuration"}},
-{".user", {"User Settings", "User-specific settings file", "Configuration"}},
-{".pubxml", {"Publish Profile", ".NET publish profile", "Configuration"}},
-{".dbproj", {"Database Project", "Database project file", "Configuration"}},
-{".dbml", {"Database Markup", "Database markup language file", "Domain-Specific"}},
-{".modelproj", {"Model Project", "Modeling project file", "Configuration"}},
-{".edmx", {"Entity Data Model", "Entity Data Model XML file", "Domain-Specific"}},
-{".tt", {"Text Template", "T4 text template", "General-Purpose"}},
-{".ttinclude", {"T4 Include", "T4 text template include file", "General-Purpose"}},
-{".vsixmanifest", {"VSIX Manifest", "Visual Studio extension manifest", "Configuration"}},
-{".vsct", {"Visual Studio Command Table", "Visual Studio command table", "Configuration"}},
-{".targets", {"MSBuild Targets", "MSBuild targets file", "Configuration"}},
-{".props", {"MSBuild Properties", "MSBuild properties file", "Configuration"}},
-{".wxs", {"WiX Source", "Windows Installer XML source file", "Configuration"}},
-{".wxl", {"WiX Localization", "Windows Installer XML localization file", "Configuration"}},
-{".wxi", {"WiX Include", "Windows Installer XML include file", "Configuration"}},
-{".wixproj", {"WiX Project", "Windows Installer XML project file", "Configuration"}},
-{".wixobj", {"WiX Object", "Windows Installer XML object file", "Configuration"}},
-{".wxlib", {"WiX Library", "Windows Installer XML library file", "Configuration"}},
-{".rc", {"Resource", "Resource script file", "Configuration"}},
-{".res", {"Resource", "Compiled resource file", "Configuration"}},
-{".resx", {"Resource XML", ".NET resource XML file", "Configuration"}},
-{".resources", {"Resource Binary", "Compiled .NET resources", "Configuration"}},
-{".manifest", {"Application Manifest", "Application manifest file", "Configuration"}},
-{".csproj.user", {"C# Project User", "C# project user settings", "Configuration"}},
-{".shproj", {"Shared Project", "Visual Studio shared project file", "Configuration"}},
-{".jsproj", {"JavaScript Project", "Visual Studio JavaScript project file", "Configuration"}},
-{".sqlproj", {"SQL Project", "SQL Server Database Project", "Configuration"}},
-{".deployproj", {"Deployment Project", "Deployment project file", "Configuration"}},
-{".ccproj", {"Cloud Project", "Azure Cloud Service project file", "Configuration"}},
-{".sfproj", {"Service Fabric Project", "Service Fabric project file", "Configuration"}},
-{".ndproj", {"Node.js Project", "Node.js project file", "Configuration"}},
-{".xproj", {"ASP.NET Core Project", "Legacy ASP.NET Core project file", "Configuration"}},
-{".dtproj", {"SSIS Project", "SQL Server Integration Services project", "Configuration"}},
-{".rptproj", {"Reporting Project", "SQL Server Reporting Services project", "Configuration"}},
-{".dwproj", {"Data Warehouse Project", "SQL Server Data Warehouse project", "Configuration"}},
-{".fsi", {"F# Signature", "F# interface file", "General-Purpose"}},
-{".xaml.cs", {"XAML CodeBehind", "C# code-behind for XAML", "General-Purpose"}},
-{".ascx.cs", {"ASCX CodeBehind", "C# code-behind for ASCX", "General-Purpose"}},
-{".aspx.cs", {"ASPX CodeBehind", "C# code-behind for ASPX", "General-Purpose"}},
-{".xaml.vb", {"XAML CodeBehind", "VB code-behind for XAML", "General-Purpose"}},
-{".ascx.vb", {"ASCX CodeBehind", "VB code-behind for ASCX", "General-Purpose"}},
-{".aspx.vb", {"ASPX CodeBehind", "VB code-behind for ASPX", "General-Purpose"}},
-{".master.cs", {"Master CodeBehind", "C# code-behind for master page", "General-Purpose"}},
-{".master.vb", {"Master CodeBehind", "VB code-behind for master page", "General-Purpose"}},
-{".sitemap", {"Site Map", "ASP.NET site map file", "Configuration"}},
-{".browser", {"Browser", "ASP.NET browser capabilities file", "Configuration"}},
-{".datasource", {"Data Source", ".NET data source file", "Configuration"}},
-{".settings", {"Settings", ".NET settings file", "Configuration"}},
-{".mdf", {"SQL Server Database", "SQL Server database file", "Domain-Specific"}},
-{".ldf", {"SQL Server Log", "SQL Server transaction log file", "Domain-Specific"}},
-{".sdf", {"SQL Server CE", "SQL Server Compact Edition database", "Domain-Specific"}},
-{".ndf", {"SQL Server Data", "SQL Server secondary data file", "Domain-Specific"}},
-{".bak", {"SQL Server Backup", "SQL Server backup file", "Configuration"}},
-{".dacpac", {"DACPAC", "Data-tier Application Package", "Domain-Specific"}},
-{".bacpac", {"BACPAC", "Backup Package for Azure SQL", "Domain-Specific"}},
-{".pdc", {"Database Diagram", "Visual Studio database diagram", "Domain-Specific"}},
+{".license", "License", "Software license file", "Configuration"},
+{".license.txt", "License", "Software license file", "Configuration"},
+{".license.md", "License", "Software license file in markdown format", "Configuration"},
+{".copying", "License", "Software license file (GNU tradition)", "Configuration"},
+{".copyright", "Copyright", "Copyright notice file", "Configuration"},
+{".authors", "Authors", "List of project authors", "Configuration"},
+{".contributors", "Contributors", "List of project contributors", "Configuration"},
+{".codeowners", "Code Owners", "GitHub CODEOWNERS file defining code ownership", "Configuration"},
+{".mailmap", "Git Mailmap", "Git mail mapping for name/email consolidation", "Configuration"},
+{".md5", "MD5 Checksum", "MD5 checksum verification file", "Configuration"},
+{".sha1", "SHA-1 Checksum", "SHA-1 checksum verification file", "Configuration"},
+{".sha256", "SHA-256 Checksum", "SHA-256 checksum verification file", "Configuration"},
+{".sha512", "SHA-512 Checksum", "SHA-512 checksum verification file", "Configuration"},
+{".sig", "Signature", "Digital signature file", "Configuration"},
+{".key", "Key", "Cryptographic key file", "Configuration"},
+{".pem", "PEM", "Privacy Enhanced Mail certificate", "Configuration"},
+{".crt", "Certificate", "Security certificate", "Configuration"},
+{".cer", "Certificate", "Security certificate", "Configuration"},
+{".p12", "PKCS#12", "Digital certificate container format", "Configuration"},
+{".pfx", "PFX", "Personal Exchange Format certificate", "Configuration"},
+{".truststore", "TrustStore", "Trusted certificate storage", "Configuration"},
+{".htaccess", "Apache Config", "Apache web server directory configuration", "Configuration"},
+{".htpasswd", "Apache Password", "Apache web server password file", "Configuration"},
+{".nginx", "Nginx Config", "Nginx web server configuration", "Configuration"},
+{".vcl", "Varnish Config", "Varnish Cache configuration", "Configuration"},
+{".haproxy", "HAProxy", "HAProxy load balancer configuration", "Configuration"},
+{".traefik", "Traefik", "Traefik proxy configuration", "Configuration"},
+{".caddy", "Caddy", "Caddy web server configuration", "Configuration"},
+{".sudoers", "Sudoers", "Sudo privileges configuration", "Configuration"},
+{".hosts", "Hosts", "Hosts file mapping hostnames to IP addresses", "Configuration"},
+{".nsswitch.conf", "NSS Switch", "Name Service Switch configuration", "Configuration"},
+{".exports", "NFS Exports", "NFS exports configuration", "Configuration"},
+{".fstab", "Filesystem Table", "Filesystem mount configuration", "Configuration"},
+{".crontab", "Crontab", "Scheduled tasks configuration", "Configuration"},
+{".systemd", "Systemd", "Systemd service manager configuration", "Configuration"},
+{".socket", "Systemd Socket", "Socket unit configuration for systemd", "Configuration"},
+{".device", "Systemd Device", "Device unit configuration for systemd", "Configuration"},
+{".mount", "Systemd Mount", "Mount unit configuration for systemd", "Configuration"},
+{".automount", "Systemd Automount", "Automount unit configuration for systemd", "Configuration"},
+{".service", "Systemd Service", "Service unit configuration for systemd", "Configuration"},
+{".timer", "Systemd Timer", "Timer unit configuration for systemd", "Configuration"},
+{".target", "Systemd Target", "Target unit configuration for systemd", "Configuration"},
+{".path", "Systemd Path", "Path unit configuration for systemd", "Configuration"},
+{".slice", "Systemd Slice", "Slice unit configuration for systemd", "Configuration"},
+{".script", "Systemd Script", "Script for systemd", "Configuration"},
+{".diff", "Diff", "File difference format showing changes between files", "Configuration"},
+{".patch", "Patch", "File containing changes to be applied to files", "Configuration"},
+{".log", "Log", "Log file containing recorded events or messages", "Configuration"},
+{".lock", "Lock File", "Dependency lock file ensuring reproducible builds", "Configuration"},
+{".tmp", "Temporary", "Temporary file", "Configuration"},
+{".temp", "Temporary", "Temporary file", "Configuration"},
+{".cache", "Cache", "Cached data file", "Configuration"},
+{".bak", "Backup", "Backup file", "Configuration"},
+{".old", "Old", "Old version of a file", "Configuration"},
+{".orig", "Original", "Original version of a file", "Configuration"},
+{".swp", "Swap", "Vim swap file", "Configuration"},
+{".swo", "Swap", "Vim swap file", "Configuration"},
+{".swn", "Swap", "Vim swap file", "Configuration"},
+{".desktop", "Desktop Entry", "FreeDesktop desktop entry file", "Configuration"},
+{".appdata.xml", "AppData", "Application metadata for Linux", "Configuration"},
+{".metainfo.xml", "MetaInfo", "Component metadata for Linux", "Configuration"},
+{".thumbs.db", "Thumbs DB", "Windows thumbnail cache", "Configuration"},
+{".ds_store", "DS Store", "macOS folder metadata", "Configuration"},
+{".localized", "Localized", "macOS folder localization", "Configuration"},
+{".manifest", "Manifest", "Application manifest file", "Configuration"},
+{".rc", "Run Command", "Generic runtime configuration file", "Configuration"},
+{".reg", "Registry", "Windows registry file", "Configuration"},
+{".suo", "Solution User Options", "Visual Studio user options", "Configuration"},
+{".sln.docstates", "Solution Document States", "Visual Studio document states", "Configuration"},
+{".vcxproj.filters", "Visual C++ Filters", "Visual C++ project filters", "Configuration"},
+{".pdb", "Program Database", "Debug symbols file", "Configuration"},
+{".ilk", "Incremental Link", "Visual Studio incremental linking file", "Configuration"},
+{".exp", "Export", "Export information file", "Configuration"},
+{".map", "Map", "Source map file for debugging", "Configuration"},
+{".gyb", "Generate Your Boilerplate", "Swift code generation template", "Configuration"},
+{".sublime-project", "Sublime Text Project", "Sublime Text project file", "Configuration"},
+{".sublime-workspace", "Sublime Text Workspace", "Sublime Text workspace file", "Configuration"},
+{".vscode", "Visual Studio Code", "VS Code configuration directory", "Configuration"},
+{".code-workspace", "VS Code Workspace", "VS Code workspace file", "Configuration"},
+{".idea", "IntelliJ IDEA", "IntelliJ IDEA configuration directory", "Configuration"},
+{".settings", "Eclipse Settings", "Eclipse IDE settings directory", "Configuration"},
+{".project", "Eclipse Project", "Eclipse project file", "Configuration"},
+{".classpath", "Eclipse Classpath", "Eclipse Java classpath file", "Configuration"},
+{".factorypath", "Eclipse Factorypath", "Eclipse annotation processor path", "Configuration"},
+{".pydevproject", "PyDev Project", "Eclipse PyDev project file", "Configuration"},
+{".spyderproject", "Spyder Project", "Spyder IDE project file", "Configuration"},
+{".spyproject", "Spyder Project", "Spyder IDE project directory", "Configuration"},
+{".ropeproject", "Rope Project", "Python refactoring library project", "Configuration"},
+{".clang-format", "Clang Format", "Clang code formatter configuration", "Configuration"},
+{".clangd", "Clang", "Clang language server configuration", "Configuration"},
+{".pycache", "Python Cache", "Python compiled code cache", "Configuration"},
+{".mypy_cache", "MyPy Cache", "MyPy type checker cache", "Configuration"},
+{".pants.d", "Pants", "Pants build system cache", "Configuration"},
+{".m2", "Maven", "Maven repository directory", "Configuration"},
+{".bsp", "Build Server Protocol", "Build server protocol directory", "Configuration"},
+{".metals", "Metals", "Scala language server directory", "Configuration"},
+{".mill", "Mill", "Mill build tool directory", "Configuration"},
+{".bloop", "Bloop", "Scala build server directory", "Configuration"},
+{".ensime", "ENSIME", "ENhanced Scala Interaction Mode for Emacs", "Configuration"},
+{".sbtopts", "SBT Options", "SBT command line options", "Configuration"},
+{".jvmopts", "JVM Options", "JVM command line options", "Configuration"},
+{".ghc.environment", "GHC Environment", "Glasgow Haskell Compiler environment", "Configuration"},
+{".stack-work", "Stack Work", "Haskell Stack work directory", "Configuration"},
+{".kateconfig", "Kate Config", "Kate editor configuration", "Configuration"},
+{".vimrc", "Vim Config", "Vim editor configuration", "Configuration"},
+{".nvimrc", "Neovim Config", "Neovim editor configuration", "Configuration"},
+{".emacs", "Emacs Config", "Emacs editor configuration", "Configuration"},
+{".spacemacs", "Spacemacs Config", "Spacemacs configuration", "Configuration"},
+{".doom.d", "Doom Emacs", "Doom Emacs configuration", "Configuration"},
+{".tmux.conf", "Tmux Config", "Tmux terminal multiplexer configuration", "Configuration"},
+{".screenrc", "Screen Config", "GNU Screen configuration", "Configuration"},
+{".direnv", "Direnv", "Directory-specific environment", "Configuration"},
+{".envrc", "Direnv RC", "Direnv configuration file", "Configuration"},
+{".prof", "Profile", "Profiling information", "Configuration"},
+{".gcno", "GCC Coverage", "GCC coverage notes file", "Configuration"},
+{".gcda", "GCC Coverage Data", "GCC coverage data file", "Configuration"},
+{".la", "Libtool Archive", "Libtool library archive", "Domain-Specific"},
+{".lo", "Libtool Object", "Libtool object file", "Domain-Specific"},
+{".dll", "Dynamic Link Library", "Windows shared library", "Domain-Specific"},
+{".dylib", "Dynamic Library", "macOS shared library", "Domain-Specific"},
+{".jnilib", "JNI Library", "Java Native Interface library", "Domain-Specific"},
+{".node", "Node.js Addon", "Node.js native addon", "Domain-Specific"},
+{".user", "User Settings", "User-specific settings file", "Configuration"},
+{".pubxml", "Publish Profile", ".NET publish profile", "Configuration"},
+{".dbproj", "Database Project", "Database project file", "Configuration"},
+{".modelproj", "Model Project", "Modeling project file", "Configuration"},
+{".edmx", "Entity Data Model", "Entity Data Model XML file", "Domain-Specific"},
+{".tt", "Text Template", "T4 text template", "General-Purpose"},
+{".ttinclude", "T4 Include", "T4 text template include file", "General-Purpose"},
+{".vsixmanifest", "VSIX Manifest", "Visual Studio extension manifest", "Configuration"},
+{".vsct", "Visual Studio Command Table", "Visual Studio command table", "Configuration"},
+{".wxs", "WiX Source", "Windows Installer XML source file", "Configuration"},
+{".wxl", "WiX Localization", "Windows Installer XML localization file", "Configuration"},
+{".wxi", "WiX Include", "Windows Installer XML include file", "Configuration"},
+{".wixproj", "WiX Project", "Windows Installer XML project file", "Configuration"},
+{".wixobj", "WiX Object", "Windows Installer XML object file", "Configuration"},
+{".wxlib", "WiX Library", "Windows Installer XML library file", "Configuration"},
+{".csproj.user", "C# Project User", "C# project user settings", "Configuration"},
+{".shproj", "Shared Project", "Visual Studio shared project file", "Configuration"},
+{".jsproj", "JavaScript Project", "Visual Studio JavaScript project file", "Configuration"},
+{".sqlproj", "SQL Project", "SQL Server Database Project", "Configuration"},
+{".deployproj", "Deployment Project", "Deployment project file", "Configuration"},
+{".ccproj", "Cloud Project", "Azure Cloud Service project file", "Configuration"},
+{".sfproj", "Service Fabric Project", "Service Fabric project file", "Configuration"},
+{".ndproj", "Node.js Project", "Node.js project file", "Configuration"},
+{".xproj", "ASP.NET Core Project", "Legacy ASP.NET Core project file", "Configuration"},
+{".dtproj", "SSIS Project", "SQL Server Integration Services project", "Configuration"},
+{".rptproj", "Reporting Project", "SQL Server Reporting Services project", "Configuration"},
+{".dwproj", "Data Warehouse Project", "SQL Server Data Warehouse project", "Configuration"},
+{".xaml.cs", "XAML CodeBehind", "C# code-behind for XAML", "General-Purpose"},
+{".ascx.cs", "ASCX CodeBehind", "C# code-behind for ASCX", "General-Purpose"},
+{".aspx.cs", "ASPX CodeBehind", "C# code-behind for ASPX", "General-Purpose"},
+{".xaml.vb", "XAML CodeBehind", "VB code-behind for XAML", "General-Purpose"},
+{".ascx.vb", "ASCX CodeBehind", "VB code-behind for ASCX", "General-Purpose"},
+{".aspx.vb", "ASPX CodeBehind", "VB code-behind for ASPX", "General-Purpose"},
+{".master.cs", "Master CodeBehind", "C# code-behind for master page", "General-Purpose"},
+{".master.vb", "Master CodeBehind", "VB code-behind for master page", "General-Purpose"},
+{".browser", "Browser", "ASP.NET browser capabilities file", "Configuration"},
+{".datasource", "Data Source", ".NET data source file", "Configuration"},
+{".mdf", "SQL Server Database", "SQL Server database file", "Domain-Specific"},
+{".ldf", "SQL Server Log", "SQL Server transaction log file", "Domain-Specific"},
+{".ndf", "SQL Server Data", "SQL Server secondary data file", "Domain-Specific"},
+{".dacpac", "DACPAC", "Data-tier Application Package", "Domain-Specific"},
+{".bacpac", "BACPAC", "Backup Package for Azure SQL", "Domain-Specific"},
+{".pdc", "Database Diagram", "Visual Studio database diagram", "Domain-Specific"},
 
 // WEB DEVELOPMENT EXTENSIONS
-{".htc", {"HTML Component", "Internet Explorer HTML Component", "Markup"}},
-{".hta", {"HTML Application", "HTML-based desktop application", "Markup"}},
-{".crx", {"Chrome Extension", "Chrome browser extension", "Domain-Specific"}},
-{".xpi", {"Firefox Extension", "Firefox browser extension", "Domain-Specific"}},
-{".safariextz", {"Safari Extension", "Safari browser extension", "Domain-Specific"}},
-{".webapp", {"Web App", "Web application manifest", "Configuration"}},
-{".appcache", {"Application Cache", "HTML5 application cache manifest", "Configuration"}},
-{".webmanifest", {"Web Manifest", "Web application manifest", "Configuration"}},
-{".serviceworker", {"Service Worker", "Web service worker script", "Scripting"}},
-{".xht", {"XHTML", "Extensible HTML", "Markup"}},
-{".xslt", {"XSLT", "XML Stylesheet Language Transformation", "Markup"}},
-{".xul", {"XUL", "XML User Interface Language", "Markup"}},
-{".wasm", {"WebAssembly", "Binary instruction format for a stack-based virtual machine", "Domain-Specific"}},
-{".wat", {"WebAssembly Text", "Text format for WebAssembly", "Domain-Specific"}},
-{".map", {"Source Map", "Mapping between compiled code and source", "Configuration"}},
-{".jsx", {"JSX", "JavaScript XML syntax extension", "General-Purpose"}},
-{".tsx", {"TSX", "TypeScript JSX syntax", "General-Purpose"}},
-{".flow", {"Flow", "Flow type annotations for JavaScript", "General-Purpose"}},
-{".vue", {"Vue", "Vue.js single-file component", "Markup"}},
-{".svelte", {"Svelte", "Svelte component file", "Markup"}},
-{".astro", {"Astro", "Astro web framework component", "Markup"}},
-{".marko", {"Marko", "UI component-based library", "Markup"}},
-{".imba", {"Imba", "Programming language for web apps", "General-Purpose"}},
-{".dts", {"TypeScript Declaration", "TypeScript declaration file", "Configuration"}},
-{".webp", {"WebP", "WebP image format", "Configuration"}},
-{".manifest", {"Cache Manifest", "Application cache manifest", "Configuration"}},
-{".htaccess", {"Apache Config", "Apache HTTP server configuration", "Configuration"}},
-{".htpasswd", {"Apache Password", "Apache HTTP server password file", "Configuration"}},
-{".babelrc", {"Babel Config", "Babel JavaScript compiler config", "Configuration"}},
-{".cshtml", {"Razor", "Razor view template", "Markup"}},
-{".vbhtml", {"Razor", "Razor view template with VB syntax", "Markup"}},
-{".cms", {"CMS Template", "Content management system template", "Markup"}},
-{".eot", {"Embedded OpenType", "Embedded OpenType font", "Configuration"}},
-{".woff", {"Web Open Font Format", "Web Open Font Format", "Configuration"}},
-{".woff2", {"Web Open Font Format 2", "Web Open Font Format 2", "Configuration"}},
-{".swf", {"Shockwave Flash", "Adobe Flash file", "Domain-Specific"}},
-{".as", {"ActionScript", "ActionScript file for Flash", "General-Purpose"}},
-{".fla", {"Flash", "Adobe Flash authoring file", "Domain-Specific"}},
-{".xap", {"Silverlight", "Microsoft Silverlight package", "Domain-Specific"}},
-{".dart", {"Dart", "Dart programming language", "General-Purpose"}},
-{".dart.js", {"Dart JavaScript", "Compiled Dart to JavaScript", "General-Purpose"}},
-{".module", {"Drupal Module", "Drupal CMS module", "Scripting"}},
-{".theme", {"Theme", "Theme file for CMS", "Markup"}},
-{".hook", {"Hook", "Hook file for various systems", "Scripting"}},
-{".j2", {"Jinja2", "Jinja2 template", "Markup"}},
-{".njk", {"Nunjucks", "Nunjucks template", "Markup"}},
-{".cssnext", {"CSS Next", "Future CSS syntax", "Markup"}},
-{".proto", {"Protocol Buffers", "Protocol Buffers IDL", "Domain-Specific"}},
-{".graphql", {"GraphQL", "GraphQL schema definition", "Domain-Specific"}},
-{".graphqls", {"GraphQL Schema", "GraphQL schema definition", "Domain-Specific"}},
-{".mdx", {"MDX", "Markdown with JSX", "Markup"}},
-{".styl", {"Stylus", "Stylus CSS preprocessor", "Markup"}},
-{".sass", {"Sass", "Syntactically Awesome Stylesheets", "Markup"}},
-{".scss", {"SCSS", "Sassy CSS", "Markup"}},
-{".postcss", {"PostCSS", "Tool for transforming CSS with JavaScript", "Markup"}},
+{".crx", "Chrome Extension", "Chrome browser extension", "Domain-Specific"},
+{".xpi", "Firefox Extension", "Firefox browser extension", "Domain-Specific"},
+{".safariextz", "Safari Extension", "Safari browser extension", "Domain-Specific"},
+{".webapp", "Web App", "Web application manifest", "Configuration"},
+{".appcache", "Application Cache", "HTML5 application cache manifest", "Configuration"},
+{".serviceworker", "Service Worker", "Web service worker script", "Scripting"},
+{".xht", "XHTML", "Extensible HTML", "Markup"},
+{".xul", "XUL", "XML User Interface Language", "Markup"},
+{".flow", "Flow", "Flow type annotations for JavaScript", "General-Purpose"},
+{".marko", "Marko", "UI component-based library", "Markup"},
+{".cms", "CMS Template", "Content management system template", "Markup"},
+{".swf", "Shockwave Flash", "Adobe Flash file", "Domain-Specific"},
+{".fla", "Flash", "Adobe Flash authoring file", "Domain-Specific"},
+{".xap", "Silverlight", "Microsoft Silverlight package", "Domain-Specific"},
+{".dart.js", "Dart JavaScript", "Compiled Dart to JavaScript", "General-Purpose"},
+{".module", "Drupal Module", "Drupal CMS module", "Scripting"},
+{".theme", "Theme", "Theme file for CMS", "Markup"},
+{".hook", "Hook", "Hook file for various systems", "Scripting"},
+{".graphqls", "GraphQL Schema", "GraphQL schema definition", "Domain-Specific"},
+{".mdx", "MDX", "Markdown with JSX", "Markup"},
 
 // MOBILE AND EMBEDDED DEVELOPMENT
-{".apk", {"Android Package", "Android application package", "Domain-Specific"}},
-{".aab", {"Android App Bundle", "Android App Bundle", "Domain-Specific"}},
-{".ipa", {"iOS App", "iOS application archive", "Domain-Specific"}},
-{".xcodeproj", {"Xcode Project", "Xcode project file", "Configuration"}},
-{".xcworkspace", {"Xcode Workspace", "Xcode workspace file", "Configuration"}},
-{".pbxproj", {"Xcode Project", "Xcode project data", "Configuration"}},
-{".storyboard", {"Storyboard", "iOS storyboard UI", "Markup"}},
-{".xib", {"XIB", "iOS interface builder file", "Markup"}},
-{".plist", {"Property List", "Apple property list", "Configuration"}},
-{".entitlements", {"Entitlements", "iOS app entitlements", "Configuration"}},
-{".mobileprovision", {"Provisioning Profile", "iOS provisioning profile", "Configuration"}},
-{".swift", {"Swift", "Apple Swift programming language", "General-Purpose"}},
-{".swiftui", {"SwiftUI", "Swift UI framework code", "General-Purpose"}},
-{".m", {"Objective-C", "Objective-C implementation file", "General-Purpose"}},
-{".h", {"Objective-C Header", "Objective-C header file", "General-Purpose"}},
-{".mm", {"Objective-C++", "Objective-C++ implementation file", "General-Purpose"}},
-{".xcdatamodeld", {"Core Data Model", "Core Data model package", "Domain-Specific"}},
-{".xcdatamodel", {"Core Data Model", "Core Data model file", "Domain-Specific"}},
-{".xcassets", {"Asset Catalog", "Xcode asset catalog", "Configuration"}},
-{".strings", {"Strings", "Localized strings file", "Configuration"}},
-{".stringsdict", {"Strings Dictionary", "Localized strings dictionary", "Configuration"}},
-{".lproj", {"Localization", "Localization directory", "Configuration"}},
-{".gradle", {"Gradle", "Gradle build file", "Scripting"}},
-{".gradle.kts", {"Gradle Kotlin", "Gradle Kotlin DSL build file", "Scripting"}},
-{".properties", {"Properties", "Java properties file", "Configuration"}},
-{".kt", {"Kotlin", "Kotlin programming language", "General-Purpose"}},
-{".kts", {"Kotlin Script", "Kotlin script", "Scripting"}},
-{".dartlang", {"Dart", "Dart programming language", "General-Purpose"}},
-{".flutter", {"Flutter", "Flutter framework file", "Domain-Specific"}},
-{".podspec", {"CocoaPods", "CocoaPods specification", "Configuration"}},
-{".podfile", {"CocoaPods", "CocoaPods dependency file", "Configuration"}},
-{".jsbundle", {"React Native", "React Native JavaScript bundle", "General-Purpose"}},
-{".aar", {"Android Archive", "Android library archive", "Domain-Specific"}},
-{".smali", {"Smali", "Disassembled DEX code", "Domain-Specific"}},
-{".dex", {"Dalvik Executable", "Android Dalvik executable", "Domain-Specific"}},
-{".aidl", {"Android IDL", "Android Interface Definition Language", "Domain-Specific"}},
-{".arsc", {"Android Resources", "Android compiled resources", "Configuration"}},
-{".9.png", {"Nine-Patch", "Android Nine-Patch image", "Configuration"}},
-{".nib", {"Interface Builder", "Compiled Interface Builder file", "Domain-Specific"}},
-{".xctest", {"XCTest", "Xcode test bundle", "Domain-Specific"}},
-{".appex", {"App Extension", "iOS/macOS app extension", "Domain-Specific"}},
-{".framework", {"Framework", "macOS/iOS framework", "Domain-Specific"}},
-{".car", {"Compiled Asset Catalog", "Compiled Asset Catalog", "Configuration"}},
-{".playground", {"Swift Playground", "Swift interactive playground", "General-Purpose"}},
-{".xcappdata", {"App Data", "Xcode application data", "Configuration"}},
-{".intentdefinition", {"Intent Definition", "Siri intent definition", "Configuration"}},
-{".mlmodel", {"Core ML Model", "Core ML machine learning model", "Domain-Specific"}},
-{".mlpackage", {"ML Package", "Core ML model package", "Domain-Specific"}},
-{".scnassets", {"SceneKit Assets", "SceneKit 3D assets", "Domain-Specific"}},
-{".watchkit", {"WatchKit", "Apple Watch extension", "Domain-Specific"}},
-{".materialsettings", {"Material Settings", "SceneKit material settings", "Configuration"}},
-{".metal", {"Metal", "Metal shading language", "Domain-Specific"}},
-{".air", {"Adobe AIR", "Adobe AIR application", "Domain-Specific"}},
-{".haxe", {"Haxe", "Haxe cross-platform language", "General-Purpose"}},
-{".hxml", {"Haxe Build", "Haxe build configuration", "Configuration"}},
-{".ino", {"Arduino", "Arduino sketch", "Domain-Specific"}},
-{".esphome", {"ESPHome", "ESPHome configuration", "Configuration"}},
-{".rkt", {"Racket", "Racket programming language", "General-Purpose"}},
-{".mojo", {"Mojo", "Mojo programming language", "General-Purpose"}},
-{".zig", {"Zig", "Zig programming language", "General-Purpose"}},
-{".wren", {"Wren", "Wren scripting language", "Scripting"}},
-{".pony", {"Pony", "Pony programming language", "General-Purpose"}},
-{".monkey", {"Monkey", "Monkey programming language", "General-Purpose"}},
-{".monkey2", {"Monkey2", "Monkey2 programming language", "General-Purpose"}},
-{".v", {"V", "V programming language", "General-Purpose"}},
-{".odin", {"Odin", "Odin programming language", "General-Purpose"}},
-{".gmi", {"Gemini", "Gemini markup for Gemini protocol", "Markup"}},
-{".gql", {"GraphQL", "GraphQL query", "Domain-Specific"}},
-{".dhall", {"Dhall", "Dhall configuration language", "Configuration"}},
-{".circom", {"Circom", "Circuit compiler", "Domain-Specific"}},
-{".wgsl", {"WGSL", "WebGPU Shading Language", "Domain-Specific"}},
-{".apl", {"APL", "Array programming language", "General-Purpose"}},
-{".j", {"J", "Array programming language", "General-Purpose"}},
-{".k", {"K", "Array programming language", "General-Purpose"}},
-{".q", {"Q", "Database programming language", "Domain-Specific"}},
-{".kdb", {"KDB+", "KDB+ database", "Domain-Specific"}},
-{".factor", {"Factor", "Stack-based programming language", "General-Purpose"}},
-{".erl", {"Erlang", "Erlang programming language", "General-Purpose"}},
-{".drl", {"Drools", "Drools rule language", "Domain-Specific"}},
-{".bal", {"Ballerina", "Ballerina programming language", "General-Purpose"}},
-{".cr", {"Crystal", "Crystal programming language", "General-Purpose"}},
-{".mq4", {"MQL4", "MetaQuotes Language 4", "Domain-Specific"}},
-{".mq5", {"MQL5", "MetaQuotes Language 5", "Domain-Specific"}},
-{".mqh", {"MQL Header", "MetaQuotes Language header", "Domain-Specific"}},
-{".ex4", {"MQL4 Compiled", "Compiled MQL4 program", "Domain-Specific"}},
-{".ex5", {"MQL5 Compiled", "Compiled MQL5 program", "Domain-Specific"}},
-{".shader", {"Shader", "Generic shader program", "Domain-Specific"}},
-{".compute", {"Compute Shader", "Compute shader program", "Domain-Specific"}},
-{".cginc", {"CG Include", "CG shader include file", "Domain-Specific"}},
-{".usf", {"Unreal Shader", "Unreal Engine shader", "Domain-Specific"}},
-{".ush", {"Unreal Shader Header", "Unreal Engine shader header", "Domain-Specific"}},
-{".edl", {"Enclave Definition", "Intel SGX Enclave Definition Language", "Domain-Specific"}},
-{".rasi", {"Rofi", "Rofi configuration", "Configuration"}},
-{".xrns", {"Renoise", "Renoise music project", "Domain-Specific"}},
-{".flp", {"FL Studio", "FL Studio project", "Domain-Specific"}},
-{".als", {"Ableton Live", "Ableton Live Set", "Domain-Specific"}},
-{".logicx", {"Logic Pro", "Logic Pro project", "Domain-Specific"}},
-{".ptx", {"CUDA PTX", "CUDA Parallel Thread Execution", "Domain-Specific"}},
-{".cublin", {"cuBLIN", "CUDA BLIN kernel", "Domain-Specific"}},
-{".cu", {"CUDA", "CUDA C/C++ file", "Domain-Specific"}},
-{".cuh", {"CUDA Header", "CUDA C/C++ header file", "Domain-Specific"}},
+{".mobileprovision", "Provisioning Profile", "iOS provisioning profile", "Configuration"},
+{".swiftui", "SwiftUI", "Swift UI framework code", "General-Purpose"},
+{".xcdatamodeld", "Core Data Model", "Core Data model package", "Domain-Specific"},
+{".xcdatamodel", "Core Data Model", "Core Data model file", "Domain-Specific"},
+{".strings", "Strings", "Localized strings file", "Configuration"},
+{".stringsdict", "Strings Dictionary", "Localized strings dictionary", "Configuration"},
+{".lproj", "Localization", "Localization directory", "Configuration"},
+{".dartlang", "Dart", "Dart programming language", "General-Purpose"},
+{".podfile", "CocoaPods", "CocoaPods dependency file", "Configuration"},
+{".jsbundle", "React Native", "React Native JavaScript bundle", "General-Purpose"},
+{".aar", "Android Archive", "Android library archive", "Domain-Specific"},
+{".smali", "Smali", "Disassembled DEX code", "Domain-Specific"},
+{".arsc", "Android Resources", "Android compiled resources", "Configuration"},
+{".9.png", "Nine-Patch", "Android Nine-Patch image", "Configuration"},
+{".nib", "Interface Builder", "Compiled Interface Builder file", "Domain-Specific"},
+{".xctest", "XCTest", "Xcode test bundle", "Domain-Specific"},
+{".appex", "App Extension", "iOS/macOS app extension", "Domain-Specific"},
+{".car", "Compiled Asset Catalog", "Compiled Asset Catalog", "Configuration"},
+{".playground", "Swift Playground", "Swift interactive playground", "General-Purpose"},
+{".xcappdata", "App Data", "Xcode application data", "Configuration"},
+{".intentdefinition", "Intent Definition", "Siri intent definition", "Configuration"},
+{".mlmodel", "Core ML Model", "Core ML machine learning model", "Domain-Specific"},
+{".mlpackage", "ML Package", "Core ML model package", "Domain-Specific"},
+{".scnassets", "SceneKit Assets", "SceneKit 3D assets", "Domain-Specific"},
+{".materialsettings", "Material Settings", "SceneKit material settings", "Configuration"},
+{".air", "Adobe AIR", "Adobe AIR application", "Domain-Specific"},
+{".haxe", "Haxe", "Haxe cross-platform language", "General-Purpose"},
+{".esphome", "ESPHome", "ESPHome configuration", "Configuration"},
+{".mojo", "Mojo", "Mojo programming language", "General-Purpose"},
+{".wren", "Wren", "Wren scripting language", "Scripting"},
+{".pony", "Pony", "Pony programming language", "General-Purpose"},
+{".monkey", "Monkey", "Monkey programming language", "General-Purpose"},
+{".monkey2", "Monkey2", "Monkey2 programming language", "General-Purpose"},
+{".gmi", "Gemini", "Gemini markup for Gemini protocol", "Markup"},
+{".apl", "APL", "Array programming language", "General-Purpose"},
+{".j", "J", "Array programming language", "General-Purpose"},
+{".k", "K", "Array programming language", "General-Purpose"},
+{".q", "Q", "Database programming language", "Domain-Specific"},
+{".kdb", "KDB+", "KDB+ database", "Domain-Specific"},
+{".factor", "Factor", "Stack-based programming language", "General-Purpose"},
+{".drl", "Drools", "Drools rule language", "Domain-Specific"},
+{".bal", "Ballerina", "Ballerina programming language", "General-Purpose"},
+{".mq4", "MQL4", "MetaQuotes Language 4", "Domain-Specific"},
+{".mq5", "MQL5", "MetaQuotes Language 5", "Domain-Specific"},
+{".mqh", "MQL Header", "MetaQuotes Language header", "Domain-Specific"},
+{".ex4", "MQL4 Compiled", "Compiled MQL4 program", "Domain-Specific"},
+{".ex5", "MQL5 Compiled", "Compiled MQL5 program", "Domain-Specific"},
+{".edl", "Enclave Definition", "Intel SGX Enclave Definition Language", "Domain-Specific"},
+{".rasi", "Rofi", "Rofi configuration", "Configuration"},
+{".xrns", "Renoise", "Renoise music project", "Domain-Specific"},
+{".flp", "FL Studio", "FL Studio project", "Domain-Specific"},
+{".als", "Ableton Live", "Ableton Live Set", "Domain-Specific"},
+{".logicx", "Logic Pro", "Logic Pro project", "Domain-Specific"},
+{".ptx", "CUDA PTX", "CUDA Parallel Thread Execution", "Domain-Specific"},
+{".cublin", "cuBLIN", "CUDA BLIN kernel", "Domain-Specific"},
 
 //Additional
-{".el", {"Emacs Lisp", "Extensible text editor scripting language"}},
-{".elc", {"Compiled Emacs Lisp", "Compiled bytecode for Emacs Lisp"}},
-{".ac", {"Autoconf", "GNU build system configuration scripts"}},
-{".m4", {"M4", "Macro processing language used in build systems"}},
-{".po", {"PO File", "Portable Object localization file"}},
-{".pot", {"POT File", "Portable Object Template for translations"}},
-{".xrc", {"XRC Resource", "XML-based resource file for wxWidgets"}},
-{".l", {"Lex/Flex", "Lexical analyzer specification"}},
-{".y", {"Yacc/Bison", "Parser generator grammar specification"}},
-{".swig", {"SWIG", "Simplified Wrapper and Interface Generator"}},
-{".happy", {"Happy", "Parser generator for Haskell"}},
-{".hc", {"HolyC", "Temple OS programming language"}},
-{".zsh", {"Zsh Script", "Z shell scripting language"}},
-{".ebuild", {"Ebuild", "Gentoo Linux package build script"}},
-{".cmake", {"CMake", "Cross-platform build system configuration"}},
-{".am", {"Automake", "GNU build system makefile template"}},
-{".resource", {"Windows Resource", "Windows resource definition file"}},
-{".xsl", {"XSL", "Extensible Stylesheet Language transformation"}},
-{".xslt", {"XSLT", "XML stylesheet transformation language"}},
-{".erb", {"ERB", "Embedded Ruby template"}},
-{".m", {"Objective-C", "Apple's object-oriented C extension"}},
-{".make", {"Makefile", "Build automation script"}},
-{".rake", {"Rake", "Ruby build automation file"}},
-{".diff", {"Diff", "File difference specification"}},
-{".patch", {"Patch", "Source code patch file"}},
-{".haml", {"Haml", "HTML abstraction markup language"}},
-{".groovy", {"Groovy", "JVM-based dynamic scripting language"}},
-{".vue", {"Vue", "Single-file Vue.js component"}},
-{".lua", {"Lua", "Lightweight scripting language"}},
-{".d", {"D", "Systems programming language"}},
-{".ml", {"OCaml", "Functional programming language"}},
-{".mli", {"OCaml Interface", "OCaml module interface file"}},
-{".rs", {"Rust", "Systems programming language"}},
-{".go", {"Go", "Google's statically typed language"}},
-{".ts", {"TypeScript", "JavaScript with static typing"}},
-{".swift", {"Swift", "Apple's programming language"}},
-{".r", {"R", "Statistical computing language"}},
-{".dart", {"Dart", "Google's client-optimized language"}},
-{".nim", {"Nim", "Efficient and expressive programming language"}},
-{".kt", {"Kotlin", "JVM-based language by JetBrains"}},
-{".scala", {"Scala", "Functional JVM language"}},
-{".clj", {"Clojure", "Lisp dialect for the JVM"}},
-{".f", {"Fortran", "Scientific computing language"}},
-{".f77", {"Fortran 77", "Older Fortran version"}},
-{".f90", {"Fortran 90", "Modern Fortran version"}},
-{".f95", {"Fortran 95", "Enhanced Fortran standard"}},
-{".for", {"Fortran", "Alternative Fortran extension"}},
-{".smk", {"Snakemake", "Python-based workflow language"}}
-
-};
+{".el", "Emacs Lisp", "Extensible text editor scripting language"},
+{".elc", "Compiled Emacs Lisp", "Compiled bytecode for Emacs Lisp"},
+{".ac", "Autoconf", "GNU build system configuration scripts"},
+{".m4", "M4", "Macro processing language used in build systems"},
+{".po", "PO File", "Portable Object localization file"},
+{".pot", "POT File", "Portable Object Template for translations"},
+{".xrc", "XRC Resource", "XML-based resource file for wxWidgets"},
+{".y", "Yacc/Bison", "Parser generator grammar specification"},
+{".swig", "SWIG", "Simplified Wrapper and Interface Generator"},
+{".happy", "Happy", "Parser generator for Haskell"},
+{".hc", "HolyC", "Temple OS programming language"},
+{".ebuild", "Ebuild", "Gentoo Linux package build script"},
+{".am", "Automake", "GNU build system makefile template"},
+{".resource", "Windows Resource", "Windows resource definition file"},
+{".make", "Makefile", "Build automation script"},
+{".f77", "Fortran 77", "Older Fortran version"},
+{".for", "Fortran", "Alternative Fortran extension"},
+{".smk", "Snakemake", "Python-based workflow language"},
+
+    // EXACT FILE NAMES (matched case-sensitively; names whose extension already classifies them are not repeated)
+    {"CMakeLists.txt", "CMake", "CMake project definition", "Scripting"},
+    {"Makefile", "Makefile", "Build automation file defining targets and dependencies", "Scripting"},
+    {"GNUmakefile", "Makefile", "Build automation file defining targets and dependencies", "Scripting"},
+    {"makefile", "Makefile", "Build automation file defining targets and dependencies", "Scripting"},
+    {"Dockerfile", "Dockerfile", "Instructions for building a Docker container image", "Configuration"},
+    {"Containerfile", "Dockerfile", "Instructions for building an OCI container image", "Configuration"},
+    {"Jenkinsfile", "Jenkinsfile", "Pipeline definition for Jenkins CI/CD", "Scripting"},
+    {"Vagrantfile", "Ruby", "Vagrant machine definition in Ruby", "Configuration"},
+    {"Gemfile", "Ruby Gemfile", "Ruby dependency manifest file", "Configuration"},
+    {"Rakefile", "Rakefile", "Ruby Rake build definition file", "Scripting"},
+    {"WORKSPACE", "Bazel", "Bazel workspace root", "Scripting"},
+    {"meson.build", "Meson", "Meson project definition", "Scripting"},
+    {"LICENSE", "License", "Software license file", "Configuration"},
+    {"LICENSE.txt", "License", "Software license file", "Configuration"},
+    {"LICENSE.md", "License", "Software license file", "Configuration"},
+    {"COPYING", "License", "Software license file", "Configuration"},
+    {"README", "Text", "Plain text document", "Markup"},
+    };
+
+    constexpr size_t ENTRY_COUNT = std::size(sources);
+    constexpr size_t BUCKET_COUNT = ENTRY_COUNT / 4 + 1;  // ~4 keys per displacement seed
+    constexpr size_t SLOT_COUNT = [] {                    // Power of two, at most half full
+        size_t n = 1;
+        while (n < ENTRY_COUNT * 2) n <<= 1;
+        return n;
+    }();
+    static_assert(ENTRY_COUNT < UINT16_MAX, "slot indexes are 16-bit");
+
+    constexpr char fold(char c) { return c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c; }
+
+    constexpr uint32_t mix(uint32_t h) {  // murmur3 finalizer
+        h ^= h >> 16; h *= 0x85ebca6bu;
+        h ^= h >> 13; h *= 0xc2b2ae35u;
+        return h ^ (h >> 16);
+    }
+
+    constexpr bool is_extension(std::string_view key) { return !key.empty() && key[0] == '.'; }
+
+    // FNV-1a, case-folded for ".ext" keys only: the single pass over the key, bucket and slot
+    // are both derived from it, and "Makefile"/"makefile" stay distinct exact names
+    constexpr uint32_t hash(std::string_view key) {
+        bool folded = is_extension(key);
+        uint32_t h = 2166136261u;
+        for (char c : key) h = (h ^ static_cast<unsigned char>(folded ? fold(c) : c)) * 16777619u;
+        return mix(h);
+    }
+
+    constexpr uint32_t slot_of(uint32_t h, uint16_t seed) {
+        return mix(h + seed * 0x9e3779b9u) & (SLOT_COUNT - 1);
+    }
+
+    constexpr std::string_view extension_of(std::string_view filename) {  // Same rules as FileUtils::extension_of
+        size_t dot = filename.rfind('.');
+        if (dot == std::string_view::npos || dot == 0 || filename == "..") return {};
+        return filename.substr(dot);
+    }
+
+    // Dense language IDs in first-appearance order, "Other" is always 0
+    struct NameSet {
+        std::array<std::string_view, SLOT_COUNT> names{};  // Open addressing by name hash
+        std::array<LanguageId, SLOT_COUNT> ids{};
+        size_t count = 0;
+
+        constexpr LanguageId id_of(std::string_view name) {
+            for (uint32_t slot = hash(name) & (SLOT_COUNT - 1);; slot = (slot + 1) & (SLOT_COUNT - 1)) {
+                if (names[slot].empty()) {
+                    names[slot] = name;
+                    ids[slot] = static_cast<LanguageId>(count++);
+                    return ids[slot];
+                }
+                if (names[slot] == name) return ids[slot];
+            }
+        }
+    };
+
+    constexpr size_t LANGUAGE_COUNT = [] {
+        NameSet set;
+        set.id_of("Other");
+        for (const Source& s : sources) set.id_of(s.name);
+        return set.count;
+    }();
+
+    struct Table {
+        std::array<LanguageInfo, ENTRY_COUNT> infos{};  // Hot fields only, descriptions live apart
+        std::array<std::string_view, LANGUAGE_COUNT> languages{};  // Name of each language ID
+        std::array<uint16_t, BUCKET_COUNT> seeds{};     // Displacement per bucket
+        std::array<uint16_t, SLOT_COUNT> slots{};       // Entry index + 1, 0 when empty
+    };
+
+    constexpr const LanguageInfo* probe(const Table& table, std::string_view key, uint32_t h) {
+        uint16_t slot = table.slots[slot_of(h, table.seeds[h % BUCKET_COUNT])];
+        if (slot == 0) return nullptr;
+        const LanguageInfo& info = table.infos[slot - 1];
+        if (info.key.size() != key.size()) return nullptr;
+        bool folded = is_extension(info.key);  // Extensions ignore case, exact names do not
+        for (size_t i = 0; i < key.size(); ++i) {
+            if ((folded ? fold(key[i]) : key[i]) != info.key[i]) return nullptr;
+        }
+        return &info;
+    }
+
+    // Hash-and-displace perfect hash, built by the compiler: largest buckets pick a seed first,
+    // a seed is accepted once every key of the bucket lands in its own free slot.
+    // Malformed tables (duplicate or upper-case keys) stop the build via throw in a constant expression
+    constexpr Table build() {
+        Table table{};
+        std::array<uint32_t, ENTRY_COUNT> hashes{};
+        std::array<uint16_t, BUCKET_COUNT> sizes{};
+        NameSet names;
+        table.languages[names.id_of("Other")] = "Other";
+        for (size_t i = 0; i < ENTRY_COUNT; ++i) {
+            const Source& s = sources[i];
+            if (s.key.empty() || s.name.empty()) throw "empty key or language name in extension table";
+            if (is_extension(s.key)) {
+                for (char c : s.key) if (fold(c) != c) throw "extension keys must be lower case";
+            }
+            LanguageId id = names.id_of(s.name);
+            table.languages[id] = s.name;
+            table.infos[i] = {s.key, s.name, s.category, id, false};
+            hashes[i] = hash(s.key);
+            ++sizes[hashes[i] % BUCKET_COUNT];
+        }
+
+        // Members grouped by bucket (counting sort), then buckets ordered by size, largest first
+        std::array<uint16_t, BUCKET_COUNT + 1> starts{};
+        for (size_t b = 0; b < BUCKET_COUNT; ++b) starts[b + 1] = starts[b] + sizes[b];
+        std::array<uint16_t, ENTRY_COUNT> members{};
+        std::array<uint16_t, BUCKET_COUNT> fill{};
+        for (size_t i = 0; i < ENTRY_COUNT; ++i) {
+            size_t b = hashes[i] % BUCKET_COUNT;
+            members[starts[b] + fill[b]++] = static_cast<uint16_t>(i);
+        }
+        uint16_t largest = 0;
+        for (uint16_t size : sizes) largest = size > largest ? size : largest;
+
+        for (int size = largest; size > 0; --size) {
+            for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+                if (sizes[b] != size) continue;
+                for (int i = starts[b]; i < starts[b + 1]; ++i) {  // Equal keys always share a bucket
+                    for (int j = starts[b]; j < i; ++j) {
+                        if (sources[members[i]].key == sources[members[j]].key) throw "duplicate key in extension table";
+                        if (hashes[members[i]] == hashes[members[j]]) throw "32-bit hash collision, change the hash";
+                    }
+                }
+
+                uint16_t seed = 0;
+                while (true) {
+                    bool fits = true;
+                    for (int i = starts[b]; i < starts[b + 1] && fits; ++i) {
+                        uint32_t slot = slot_of(hashes[members[i]], seed);
+                        fits = table.slots[slot] == 0;
+                        for (int j = starts[b]; j < i && fits; ++j) fits = slot_of(hashes[members[j]], seed) != slot;
+                    }
+                    if (fits) break;
+                    if (++seed == UINT16_MAX) throw "no perfect-hash seed found, change the hash";
+                }
+                table.seeds[b] = seed;
+                for (int i = starts[b]; i < starts[b + 1]; ++i) {
+                    table.slots[slot_of(hashes[members[i]], seed)] = static_cast<uint16_t>(members[i] + 1);
+                }
+            }
+        }
+
+        // Extensions shared with an exact name ("CMakeLists.txt") need the second probe
+        for (const Source& s : sources) {
+            std::string_view ext = extension_of(s.key);
+            if (is_extension(s.key) || ext.empty()) continue;
+            const LanguageInfo* info = probe(table, ext, hash(ext));
+            if (info) table.infos[info - table.infos.data()].has_names = true;
+        }
+        return table;
+    }
+
+    constexpr Table table = build();
+
+    constexpr auto descriptions = [] {  // Cold storage, only read by description()
+        std::array<std::string_view, ENTRY_COUNT> result{};
+        for (size_t i = 0; i < ENTRY_COUNT; ++i) result[i] = sources[i].description;
+        return result;
+    }();
+
+    static_assert(probe(table, ".cpp", hash(".cpp")) && probe(table, ".CPP", hash(".CPP")));
+    static_assert(probe(table, "Makefile", hash("Makefile")) && !probe(table, "MAKEFILE", hash("MAKEFILE")));
+    static_assert(probe(table, ".cc", hash(".cc"))->language == probe(table, ".cpp", hash(".cpp"))->language);
+
+    constexpr size_t MAX_INTERNED = 1024;  // Room for linguist-language names missing from the table
+
+    std::mutex intern_mutex;                                  // Guards the two members below
+    std::unordered_map<std::string, LanguageId> by_lowercase; // "c++" -> ID of "C++"
+    std::deque<std::string> interned;                         // Names of IDs past the table, stable storage
+
+    std::string lowercase(std::string_view str) {
+        std::string result(str);
+        std::transform(result.begin(), result.end(), result.begin(), ::tolower);
+        return result;
+    }
+}
+
+namespace LanguageMap {
+    const LanguageInfo* find(std::string_view filename) {
+        std::string_view ext = extension_of(filename);
+        if (!ext.empty()) {
+            const LanguageInfo* info = probe(table, ext, hash(ext));
+            if (info && !info->has_names) return info;  // Common case: one hash, one compare
+            if (const LanguageInfo* named = probe(table, filename, hash(filename))) return named;
+            return info;
+        }
+        const LanguageInfo* named = probe(table, filename, hash(filename));
+        return named && !is_extension(named->key) ? named : nullptr;  // ".gitignore" is a dotfile, not an extension
+    }
+
+    const LanguageInfo* find_extension(std::string_view ext) {
+        if (!is_extension(ext)) return nullptr;
+        return probe(table, ext, hash(ext));
+    }
+
+    std::string_view description(const LanguageInfo& info) {
+        return descriptions[&info - table.infos.data()];
+    }
+
+    std::span<const LanguageInfo> entries() {
+        return table.infos;
+    }
+
+    LanguageId intern(std::string_view name) {
+        std::lock_guard<std::mutex> lock(intern_mutex);
+        if (by_lowercase.empty()) {  // Canonical spellings from the table
+            for (size_t id = 0; id < LANGUAGE_COUNT; ++id) {
+                by_lowercase.emplace(lowercase(table.languages[id]), static_cast<LanguageId>(id));
+            }
+        }
+        auto it = by_lowercase.find(lowercase(name));
+        if (it != by_lowercase.end()) return it->second;
+        if (interned.size() == MAX_INTERNED) return OTHER;  // Absurd attribute files: stop growing
+
+        interned.emplace_back(name);  // Unknown language: keep the user's spelling
+        LanguageId id = static_cast<LanguageId>(LANGUAGE_COUNT + interned.size() - 1);
+        by_lowercase.emplace(lowercase(name), id);
+        return id;
+    }
 
+    std::string_view name_of(LanguageId id) {
+        if (id < LANGUAGE_COUNT) return table.languages[id];
+        std::lock_guard<std::mutex> lock(intern_mutex);
+        return id - LANGUAGE_COUNT < interned.size() ? std::string_view(interned[id - LANGUAGE_COUNT]) : "Other";
+    }
 
+    size_t capacity() {
+        return LANGUAGE_COUNT + MAX_INTERNED;
+    }
+}
@@ -1,14 +1,30 @@
 #pragma once
-#include <string>
-#include <unordered_map>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
 
+using LanguageId = uint16_t;  // Dense language number, assigned when the table is compiled
 
+// Classification of one extension (".cpp") or exact file name ("Makefile"), stored in a
+// compile-time perfect-hash table: lookups never allocate and nothing is built at startup
 struct LanguageInfo {
-    std::string name;        
-    std::string description; 
-    std::string category;
+    std::string_view key;       // Lowercase extension with its dot, or exact file name
+    std::string_view name;      // Display name, e.g. "C++"
+    std::string_view category;  // "General-Purpose", "Scripting"... (may be empty)
+    LanguageId language = 0;    // ID shared by every key of the same language
+    bool has_names = false;     // Some exact file name with this extension maps elsewhere
 };
 
-extern const std::unordered_map<std::string, LanguageInfo> extension_to_language;
+namespace LanguageMap {
+    constexpr LanguageId OTHER = 0;  // Unknown language, also "no override"
 
+    const LanguageInfo* find(std::string_view filename);       // By exact name or extension, null if unknown
+    const LanguageInfo* find_extension(std::string_view ext);  // Case-insensitive ".ext" lookup
+    std::string_view description(const LanguageInfo& info);    // Long description (cold storage)
+    std::span<const LanguageInfo> entries();                   // Every entry, in table order
 
+    LanguageId intern(std::string_view name);  // Case-insensitive name lookup, unknown names get a new ID
+    std::string_view name_of(LanguageId id);   // Display name, only needed when printing
+    size_t capacity();                         // Upper bound of every ID intern() can return
+}
@@ -40,7 +40,7 @@ std::string GitModule::exec_command(const std::string& cmd) const {
 }
 
 // Placeholder method for file processing (unused in current implementation)
-void GitModule::process_file(const fs::path& file_path) {
+void GitModule::process_file(const FileView& /*file*/, size_t /*worker*/) {
     // No operation - all logic is in print_stats()
 }
 
@@ -21,7 +21,7 @@ public:
     ~GitModule() = default;
 
     // Processes a single file at given path (override from base class)
-    void process_file(const fs::path& file_path) override;
+    void process_file(const FileView& file, size_t worker) override;
     
     // Prints collected statistics (override from base class)
     void print_stats() const override;
@@ -11,7 +11,10 @@ private:
 
 public:
     LanguageStatsModule(size_t languages_count);
-    void process_file(const fs::path& file_path) override;   // Process file implementation
+    FileAccess access() const override { return FileAccess::Lines; }
+    void prepare(size_t workers) override { stats.prepare(workers); }
+    void process_file(const FileView& file, size_t worker) override;   // Process file implementation
+    void merge() override { stats.merge(); }
     void print_stats() const override;  // Declaration for compatibility with the base module (unused)
     void print_stats(size_t languages_count) const;  // Implementation of print statistics with an argument
 };
@@ -7,22 +7,37 @@
 #include "language_stats_lib.hpp"
 #include "file_extension_to_language_map.hpp"
 
-// Add file with line count to stats
-void LanguageStats::add_file(const fs::path& file_path, size_t lines) {  
-    std::string language = detect_language(file_path);  // Get language from file extension
-    language_lines[language] += lines;                  // Update language line count
-    total_lines += lines;                               // Update total lines
+// Add file with line count to the worker's shard
+void LanguageStats::add_file(std::string_view filename, LanguageId override_language, const LineTally& lines,
+    size_t worker) {
+    std::vector<LineTally>& shard = shards[worker];
+    if (shard.empty()) shard.resize(LanguageMap::capacity());            // Every ID intern() can return
+    LanguageId language = detect_language(filename, override_language);  // Get language from file extension
+    shard[language] += lines;                                            // Update language line split
+}
+
+// Sum the shards per language in worker order
+void LanguageStats::merge() {
+    language_lines.assign(LanguageMap::capacity(), LineTally{});
+    total_lines = 0;
+    for (size_t worker = 0; worker < shards.size(); ++worker) {
+        const std::vector<LineTally>& shard = shards[worker];
+        for (size_t id = 0; id < shard.size(); ++id) {
+            language_lines[id] += shard[id];
+            total_lines += shard[id].lines();
+        }
+    }
 }
 
 void LanguageStats::print_stats() const {               // Print language distribution
     std::cout << "\nLanguages:\n";
 
     // Get sorted statistics
-    std::vector<std::pair<std::string, size_t>> sorted_stats = get_sorted_stats(); 
+    std::vector<std::pair<std::string, LineTally>> sorted_stats = get_sorted_stats(); 
 
     for (const auto& [language, lines] : sorted_stats) {  // Structured binding for stat pairs
         // Calculate percentage
-        double percentage = (static_cast<double>(lines) / total_lines) * 100.0;  
+        double percentage = (static_cast<double>(lines.lines()) / total_lines) * 100.0;  
         if (percentage >= 1.0) {  // Only show languages with ≥1% share
             // Format output with aligned columns
             std::cout << std::setw(20) << std::left << language
@@ -32,24 +47,23 @@ void LanguageStats::print_stats() const {               // Print language distri
 }
 
 // Get sorted statistics for languages
-std::vector<std::pair<std::string, size_t>> LanguageStats::get_sorted_stats() const {
-    // Copy to vector
-    std::vector<std::pair<std::string, size_t>> sorted_stats(language_lines.begin(), language_lines.end());  
+std::vector<std::pair<std::string, LineTally>> LanguageStats::get_sorted_stats() const {
+    // Copy used languages to vector, resolving names only now
+    std::vector<std::pair<std::string, LineTally>> sorted_stats;
+    for (size_t id = 0; id < language_lines.size(); ++id) {
+        const LineTally& lines = language_lines[id];
+        if (lines.lines() > 0) sorted_stats.emplace_back(LanguageMap::name_of(static_cast<LanguageId>(id)), lines);
+    }
     // Sort by line count using lambda
     std::sort(sorted_stats.begin(), sorted_stats.end(),
-              [](const auto& a, const auto& b) { return a.second > b.second; });
+              [](const auto& a, const auto& b) { return a.second.lines() > b.second.lines(); });
     return sorted_stats;
 }
 
 // Detect language from file extension
-std::string LanguageStats::detect_language(const fs::path& file_path) const { 
-   
-    std::string ext = file_path.extension().string();  // Get file extension
-    std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower); // Convert to lowercase
-
-    auto it = extension_to_language.find(ext);  // Look up language
-    if (it != extension_to_language.end()) {    // Return mapped language or "Other"
-        return it->second.name;
-    }
-    return "Other";
+LanguageId LanguageStats::detect_language(std::string_view filename, LanguageId language) const { 
+    if (language != LanguageMap::OTHER) return language;  // linguist-language from .gitattributes wins
+
+    const LanguageInfo* info = LanguageMap::find(filename);  // Exact name or extension, any case
+    return info ? info->language : LanguageMap::OTHER;       // Return mapped language or "Other"
 }
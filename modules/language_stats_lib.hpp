@@ -1,22 +1,30 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <filesystem>
-#include <unordered_map>
+
+#include "file_extension_to_language_map.hpp"
+#include "../src/line_classifier.hpp"
+#include "../src/sharded.hpp"
 
 namespace fs = std::filesystem; 
 
 class LanguageStats {
 public:
-    void add_file(const fs::path& file_path, size_t lines); // Add file to statistics
+    void prepare(size_t workers) { shards.resize(workers); }  // One shard per worker, before they start
+    // Add file to the worker's shard, language may override
+    void add_file(std::string_view filename, LanguageId language, const LineTally& lines, size_t worker);
+    void merge();                                           // Fold the shards, after the workers joined
     void print_stats() const;                               // Print language statistics
-    std::vector<std::pair<std::string, size_t>> get_sorted_stats() const;  // Get sorted statistics
+    std::vector<std::pair<std::string, LineTally>> get_sorted_stats() const;  // Sorted by total lines
     size_t get_total_lines() const { return total_lines; }  // Getter for total lines
 
 private:
-    std::unordered_map<std::string, size_t> language_lines; // Hash map for language line counts
-    size_t total_lines = 0;                                 // Total lines counter with in-class init
+    Sharded<std::vector<LineTally>> shards;  // Per worker: split per LanguageId, sized on first use
+    std::vector<LineTally> language_lines;   // Merged split per LanguageId, names resolved when printing
+    size_t total_lines = 0;                  // Total lines, valid after merge()
 
-    std::string detect_language(const fs::path& file_path) const; // Detect file language
+    LanguageId detect_language(std::string_view filename, LanguageId language) const; // Detect file language
 };
@@ -1,32 +1,50 @@
-#include <fstream>
-#include <sstream>
-
 #include "license_detect.hpp"
 #include "../src/output_formatter.hpp"
 
-void LicenseModule::process_file(const fs::path &file_path) { // Process potential license file
-    std::string filename = file_path.filename().string();     // Get filename from path
-    if (filename == "LICENSE" || filename == "LICENSE.txt" || 
-        filename == "LICENSE.md" || filename == "COPYING" || 
-        filename == "README.md" || filename == "README") {    // Check for license files
-        std::ifstream file(file_path);                        // Open file using path
-        if (file.is_open()) {
-            // Read entire file content using iterators
-            std::string content((std::istreambuf_iterator<char>(file)),
-                               std::istreambuf_iterator<char>());
-            detect_license(content);                          // Analyze content for license
+namespace {
+    // License files first, READMEs only as a fallback; 0 for any other name
+    int license_file_rank(std::string_view filename) {
+        if (filename == "LICENSE" || filename == "LICENSE.txt" || filename == "LICENSE.md") return 1;
+        if (filename == "COPYING") return 2;
+        if (filename == "README.md" || filename == "README") return 3;
+        return 0;
+    }
+}
+
+void LicenseModule::process_file(const FileView &file, size_t worker) {  // Process potential license file
+    int rank = license_file_rank(file.name());                // Entry name, no path decomposition
+    if (rank == 0) return;                                    // Not a license file
+
+    Candidate& best = shards[worker];
+    if (best.rank != 0 && best.rank < rank) return;           // This worker already has a better file
+    std::string license = detect_license(file.bytes());       // Mapping shared with the line counters
+    if (license.empty()) return;
+
+    std::string path = file.c_path();
+    if (best.rank == rank && best.path <= path) return;       // Same preference: smallest path wins
+    best = {rank, std::move(path), std::move(license)};
+}
+
+void LicenseModule::merge() {  // Same rule across workers as within one
+    const Candidate* best = nullptr;
+    for (size_t worker = 0; worker < shards.size(); ++worker) {
+        const Candidate& candidate = shards[worker];
+        if (candidate.rank == 0) continue;
+        if (!best || candidate.rank < best->rank || (candidate.rank == best->rank && candidate.path < best->path)) {
+            best = &candidate;
         }
     }
+    if (best) detected_license = best->license;
 }
 
-void LicenseModule::detect_license(const std::string &content) { // Detect license type from content
+std::string LicenseModule::detect_license(std::string_view content) const { // Detect license type from content
     // Structured binding for pattern matching
     for (const auto &[license, pattern] : license_patterns) {
-        if (std::regex_search(content, pattern)) {  // Search for license pattern
-            detected_license = license;             // Store detected license
-            return;
+        if (std::regex_search(content.begin(), content.end(), pattern)) {  // Search for license pattern
+            return license;                         // Report detected license
         }
     }
+    return {};
 }
 
 void LicenseModule::print_stats() const {  // Print license information
@@ -1,13 +1,21 @@
 #pragma once
 
 #include "codefetch_module_interface.hpp"
+#include "../src/sharded.hpp"
 #include <string>
 #include <unordered_map>
 #include <regex>
 
 class LicenseModule : public CodeFetchModule {
 private:
-    std::string detected_license; // Store detected license type
+    struct Candidate {             // License found in one file
+        int rank = 0;              // Preference of the file name, lower wins; 0 when nothing was found
+        std::string path;          // Tie-breaker, so the pick never depends on scheduling
+        std::string license;
+    };
+
+    Sharded<Candidate> shards;    // Best candidate seen by each worker
+    std::string detected_license; // Store detected license type, picked by merge()
 
     // Map of license patterns using regex
     std::unordered_map<std::string, std::regex> license_patterns = { 
@@ -30,10 +38,12 @@ private:
     };
 
 public:
-    void process_file(const fs::path& file_path) override; // Process file implementation
+    void prepare(size_t workers) override { shards.resize(workers); }
+    void process_file(const FileView& file, size_t worker) override; // Process file implementation (metadata; content of license files only)
+    void merge() override;                                 // Best candidate across the workers
     void print_stats() const override;                     // Print statistics implementation
 
 private:
-    void detect_license(const std::string& content);       // License detection helper method
+    std::string detect_license(std::string_view content) const;  // License detection helper method, empty if none
 };
 
@@ -1,20 +1,24 @@
 #include <iostream>
-#include <algorithm>
 
 #include "metabuild_system.hpp"
 #include "../src/output_formatter.hpp"
 
-void MetabuildSystemModule::process_file(const fs::path& file_path) { // Process file for build system detection
-    std::string full_path = fs::canonical(file_path).string();        // Get canonical path as string
-    std::replace(full_path.begin(), full_path.end(), '\\', '/');  // Normalize path separators
+void MetabuildSystemModule::process_file(const FileView& file, size_t worker) {  // Process file for build system detection
+    std::string_view name = file.name();  // Patterns are anchored at a path separator, the entry name is enough
 
     for (const auto& [system, pattern] : build_system_patterns) {  // Structured binding for pattern matching
-        if (std::regex_search(full_path, pattern)) {  // Search for build system pattern
-            detected_systems.insert(system);          // Add detected build system
+        if (std::regex_search(name.begin(), name.end(), pattern)) {  // Search for build system pattern
+            shards[worker].insert(system);            // Add detected build system
         }
     }
 }
 
+void MetabuildSystemModule::merge() {  // Union of what the workers saw
+    for (size_t worker = 0; worker < shards.size(); ++worker) {
+        detected_systems.insert(shards[worker].begin(), shards[worker].end());
+    }
+}
+
 void MetabuildSystemModule::print_stats() const {  // Print build system information
     if (!detected_systems.empty()) {               // Only print if systems were detected
         std::vector<std::pair<std::string, std::string>> items = {  // Format items for output
@@ -3,12 +3,15 @@
 #include <string>
 #include <regex>
 #include <unordered_map>
+#include <set>
 #include <unordered_set>
 #include "codefetch_module_interface.hpp"
+#include "../src/sharded.hpp"
 
 class MetabuildSystemModule : public CodeFetchModule {
 private:
-    std::unordered_set<std::string> detected_systems; // Store unique detected build systems
+    Sharded<std::unordered_set<std::string>> shards;  // Systems seen by each worker
+    std::set<std::string> detected_systems;           // Union of the shards, ordered for a stable pick
 
     // Map of build system patterns using regex
     std::unordered_map<std::string, std::regex> build_system_patterns = {
@@ -19,7 +22,9 @@ private:
     };
 
 public:
-    void process_file(const fs::path& file_path) override; // Process file implementation
+    void prepare(size_t workers) override { shards.resize(workers); }
+    void process_file(const FileView& file, size_t worker) override; // Process file implementation (name only)
+    void merge() override;                                 // Union of the worker shards
     void print_stats() const override;                     // Print statistics implementation
     bool has_detected_systems() const { return !detected_systems.empty(); }  // Check if systems were detected
 };
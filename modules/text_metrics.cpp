@@ -0,0 +1,70 @@
+#include "text_metrics.hpp"
+#include "file_extension_to_language_map.hpp"
+#include "../src/output_formatter.hpp"
+
+#include <algorithm>
+#include <format>  // std::format (C++20)
+
+namespace {
+    // One line of the report: size, line lengths, indentation and trailing whitespace
+    std::string summary(const LineTally& tally) {
+        const TextMetrics& metrics = tally.metrics;
+        double mean = tally.lines() ? static_cast<double>(metrics.line_length) / tally.lines() : 0.0;
+        return std::format("{} KiB, {} code points, longest {}, mean {:.1f}, indent {} tab / {} space, {} trailing",
+                           OutputFormatter::format_large_number(metrics.bytes / 1024),
+                           OutputFormatter::format_large_number(metrics.code_points),
+                           OutputFormatter::format_large_number(metrics.longest_line), mean,
+                           OutputFormatter::format_large_number(metrics.tab_indented),
+                           OutputFormatter::format_large_number(metrics.space_indented),
+                           OutputFormatter::format_large_number(metrics.trailing_whitespace));
+    }
+}
+
+TextMetricsModule::TextMetricsModule(size_t languages_count) : languages_count(languages_count) {}
+
+// Add the file's metrics, measured while its lines were classified, to the worker's shard
+void TextMetricsModule::process_file(const FileView& file, size_t worker) {
+    std::vector<LineTally>& shard = shards[worker];
+    if (shard.empty()) shard.resize(LanguageMap::capacity());  // Every ID intern() can return
+    LanguageId language = file.language();
+    if (language == LanguageMap::OTHER) {                      // Same fallback as the language statistics
+        const LanguageInfo* info = LanguageMap::find(file.name());
+        if (info) language = info->language;
+    }
+    shard[language] += file.lines();
+}
+
+// Sum the shards per language in worker order
+void TextMetricsModule::merge() {
+    language_tallies.assign(LanguageMap::capacity(), LineTally{});
+    total = {};
+    for (size_t worker = 0; worker < shards.size(); ++worker) {
+        const std::vector<LineTally>& shard = shards[worker];
+        for (size_t id = 0; id < shard.size(); ++id) {
+            language_tallies[id] += shard[id];
+            total += shard[id];
+        }
+    }
+}
+
+void TextMetricsModule::print_stats() const {
+    OutputFormatter::print_section("Text Metrics", "▤", {{"all files", summary(total)}});
+
+    std::vector<size_t> ids;  // Languages with any bytes, largest first
+    for (size_t id = 0; id < language_tallies.size(); ++id) {
+        if (language_tallies[id].metrics.bytes) ids.push_back(id);
+    }
+    std::sort(ids.begin(), ids.end(), [this](size_t a, size_t b) {  // Ties by name: same order every run
+        size_t left = language_tallies[a].metrics.bytes, right = language_tallies[b].metrics.bytes;
+        return left != right ? left > right
+            : LanguageMap::name_of(static_cast<LanguageId>(a)) < LanguageMap::name_of(static_cast<LanguageId>(b));
+    });
+    if (ids.size() > languages_count) ids.resize(languages_count);
+
+    std::vector<std::pair<std::string, std::string>> items;
+    for (size_t id : ids) {
+        std::string name(LanguageMap::name_of(static_cast<LanguageId>(id)));
+        items.emplace_back(OutputFormatter::truncate(name, 10), summary(language_tallies[id]));
+    }
+    OutputFormatter::print_section("Metrics by Language", "▤", items);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <vector>
+
+#include "codefetch_module_interface.hpp"
+#include "../src/sharded.hpp"
+
+class TextMetricsModule : public CodeFetchModule {  // Size, line lengths and whitespace style per language
+private:
+    Sharded<std::vector<LineTally>> shards;   // Per worker: per LanguageId, sized on first use
+    std::vector<LineTally> language_tallies;  // Merged per LanguageId, valid after merge()
+    LineTally total;                          // Sum over all languages
+    size_t languages_count;                   // Languages listed, largest first
+
+public:
+    TextMetricsModule(size_t languages_count);
+    FileAccess access() const override { return FileAccess::Metrics; }  // Measured in the line counting pass
+    void prepare(size_t workers) override { shards.resize(workers); }
+    void process_file(const FileView& file, size_t worker) override;
+    void merge() override;
+    void print_stats() const override;
+};
@@ -5,19 +5,39 @@
 #include <format>  // std::format (C++20)
 
 // Process single file for line counting
-void LineCounterModule::process_file(const fs::path& file_path) {  
-    counter.count_lines(file_path);  // Count lines in file
+void LineCounterModule::process_file(const FileView& file, size_t worker) {  
+    counter.count_lines(file, worker);  // Count lines in file
 }
 
 // Print line counting statistics
 void LineCounterModule::print_stats() const {      
     const auto& total_count = counter.get_total_count();     // Get total line counts
-    size_t total = total_count.code + total_count.comments;  // Calculate total lines
+    size_t total = total_count.code + total_count.comments + total_count.blanks;  // Calculate total lines
 
     // Create string with results for "Total Lines" section
-    std::string total_result_str = std::format("{}\n",
-                                 OutputFormatter::format_large_number(total));
+    std::string total_result_str = std::format("{}  ({} code, {} comments, {} blanks)\n",
+                                 OutputFormatter::format_large_number(total),
+                                 OutputFormatter::format_large_number(total_count.code),
+                                 OutputFormatter::format_large_number(total_count.comments),
+                                 OutputFormatter::format_large_number(total_count.blanks));
 
     std::cout << "⚑ Total Lines" << std::setw(30) << "[incl: All Extensions]" << std::endl;
     std::cout << "╰─ " << total_result_str  << std::endl;
+
+    // Encodings and line endings, only when something other than UTF-8 with LF was seen
+    const auto& formats = counter.get_formats();
+    if (formats.unusual()) {
+        std::vector<std::pair<std::string, std::string>> items;
+        for (size_t i = 0; i < formats.encodings.size(); ++i) {
+            if (formats.encodings[i]) {
+                items.emplace_back(name_of(static_cast<Encoding>(i)), OutputFormatter::format_large_number(formats.encodings[i]) + " files");
+            }
+        }
+        for (size_t i = 0; i < formats.endings.size(); ++i) {
+            if (formats.endings[i]) {
+                items.emplace_back(name_of(static_cast<LineEnding>(i)), OutputFormatter::format_large_number(formats.endings[i]) + " files");
+            }
+        }
+        OutputFormatter::print_section("Text Formats", "¶", items);
+    }
 }
@@ -8,7 +8,10 @@ private:
     LineCounter counter;                            // Line counter instance
 
 public:
-    void process_file(const fs::path& file_path) override; // Process file implementation
+    FileAccess access() const override { return FileAccess::Lines; }
+    void prepare(size_t workers) override { counter.prepare(workers); }
+    void process_file(const FileView& file, size_t worker) override; // Process file implementation
+    void merge() override { counter.merge(); }
     void print_stats() const override;              // Print statistics implementation
 };
 
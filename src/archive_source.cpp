@@ -0,0 +1,631 @@
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>       // For memcpy/memcmp/strnlen
+#include <memory>
+#include <mutex>
+#include <new>           // For placement and nothrow new
+#include <fcntl.h>       // For open
+#include <sys/mman.h>    // For mmap
+#include <sys/stat.h>    // For fstat
+#include <unistd.h>      // For pread/read/close
+
+#ifdef CODEFETCH_WITH_ZLIB
+#include <zlib.h>
+#endif
+#ifdef CODEFETCH_WITH_ZSTD
+#include <zstd.h>
+#endif
+
+#include "archive_source.hpp"
+#include "language_detector.hpp"
+#include "path_arena.hpp"
+
+namespace {
+    enum class Format { None, Tar, Gzip, Zstd, Zip };
+
+    constexpr size_t TAR_BLOCK = 512;
+    constexpr size_t INPUT_CHUNK = 256 * 1024;  // Compressed bytes read from the archive per refill
+    constexpr size_t MEMBER_CHUNK = 1024 * 1024;  // First allocation of a streamed member, doubled as its bytes arrive
+    constexpr uint64_t MAX_DEFLATE_RATIO = 1032;  // Deflate cannot expand data further: larger claimed sizes are corrupt
+    constexpr uint64_t MAX_NAME_RECORD = 1024 * 1024;  // 'L' and 'x' records above this are skipped unread
+
+    std::atomic<size_t> unsupported_members{0};  // Also counts members too large to allocate
+
+    // Bytes of Streamed members queued or in processing, bounded by BUDGET
+    std::mutex budget_mutex;
+    std::condition_variable budget_freed;
+    size_t in_flight = 0;
+
+    void reserve(size_t bytes) {  // A member larger than the whole budget waits for an empty pipeline
+        std::unique_lock<std::mutex> lock(budget_mutex);
+        budget_freed.wait(lock, [bytes] { return in_flight == 0 || in_flight + bytes <= ArchiveSource::BUDGET; });
+        in_flight += bytes;
+    }
+
+    void unreserve(size_t bytes) {
+        {
+            std::lock_guard<std::mutex> lock(budget_mutex);
+            in_flight -= bytes;
+        }
+        budget_freed.notify_one();
+    }
+
+    uint16_t u16(const char* p) {
+        auto b = reinterpret_cast<const unsigned char*>(p);
+        return static_cast<uint16_t>(b[0] | b[1] << 8);
+    }
+
+    uint32_t u32(const char* p) {
+        return u16(p) | static_cast<uint32_t>(u16(p + 2)) << 16;
+    }
+
+    uint64_t u64(const char* p) {
+        return u32(p) | static_cast<uint64_t>(u32(p + 4)) << 32;
+    }
+
+    bool fits(uint64_t pos, uint64_t length, size_t size) {  // [pos, pos + length) lies inside the archive
+        return length <= size && pos <= size - length;
+    }
+
+    // Octal field, or base-256 when its first byte has the high bit set (GNU, sizes of 8 GiB and up)
+    uint64_t tar_number(const char* field, size_t width) {
+        auto bytes = reinterpret_cast<const unsigned char*>(field);
+        uint64_t value = 0;
+        if (bytes[0] & 0x80) {
+            for (size_t i = 1; i < width; ++i) value = value << 8 | bytes[i];
+            return value;
+        }
+        size_t i = 0;
+        while (i < width && bytes[i] == ' ') ++i;
+        for (; i < width && bytes[i] >= '0' && bytes[i] <= '7'; ++i) value = value << 3 | (bytes[i] - '0');
+        return value;
+    }
+
+    // Header checksum: all bytes summed with the checksum field read as spaces
+    bool tar_header(const char* block) {
+        auto bytes = reinterpret_cast<const unsigned char*>(block);
+        uint64_t sum = 0;
+        for (size_t i = 0; i < TAR_BLOCK; ++i) sum += i >= 148 && i < 156 ? ' ' : bytes[i];
+        return sum == tar_number(block + 148, 8);
+    }
+
+    bool zero_block(const char* block) {
+        return std::all_of(block, block + TAR_BLOCK, [](char c) { return c == 0; });
+    }
+
+    // Member path of a ustar header: prefix, then name, neither necessarily NUL-terminated
+    std::string tar_name(const char* header) {
+        std::string name(header, strnlen(header, 100));
+        if (std::memcmp(header + 257, "ustar", 5) == 0 && header[345]) {
+            return std::string(header + 345, strnlen(header + 345, 155)) + "/" + name;
+        }
+        return name;
+    }
+
+    // "path" record of a pax extended header ("<length> path=<value>\n" records), empty when absent
+    std::string pax_path(std::string_view records) {
+        while (!records.empty()) {
+            size_t space = records.find(' ');
+            size_t length = 0;
+            for (size_t i = 0; i < space && i < records.size(); ++i) length = length * 10 + (records[i] - '0');
+            if (space == std::string_view::npos || length <= space + 1 || length > records.size()) break;
+            std::string_view record = records.substr(space + 1, length - space - 2);  // Without the newline
+            if (record.substr(0, 5) == "path=") return std::string(record.substr(5));
+            records.remove_prefix(length);
+        }
+        return {};
+    }
+
+    Format format_of(const char* head, size_t size) {
+        if (size >= 2 && std::memcmp(head, "\x1f\x8b", 2) == 0) return Format::Gzip;
+        if (size >= 4 && std::memcmp(head, "\x28\xb5\x2f\xfd", 4) == 0) return Format::Zstd;
+        if (size >= 4 && (std::memcmp(head, "PK\x03\x04", 4) == 0 || std::memcmp(head, "PK\x05\x06", 4) == 0)) {
+            return Format::Zip;
+        }
+        if (size >= TAR_BLOCK && !zero_block(head) && tar_header(head)) return Format::Tar;  // ustar and v7 alike
+        return Format::None;
+    }
+
+    // Whole archive mapped for the rest of the run: Stored and Deflated members point into it, and
+    // drop their pages once processed, so resident memory stays bounded as with windowed files
+    bool map_archive(int fd, const char*& data, size_t& size) {
+        struct stat st;
+        if (fstat(fd, &st) == -1 || st.st_size <= 0) return false;
+        size = static_cast<size_t>(st.st_size);
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) return false;
+        madvise(mapped, size, MADV_SEQUENTIAL);  // Members are read in about archive order
+        data = static_cast<const char*>(mapped);
+        return true;
+    }
+
+    // Turns member paths into queued SourceFiles. Directories become DirHandle roots named
+    // "<archive>/<dir>" (fd -1), as for --files-from; ignore files inside archives are not read
+    class Feeder {
+    private:
+        ThreadSafeQueue& file_queue;
+        std::atomic<size_t>& total_files;
+        const TraversalOptions& options;
+        std::string root;                      // Archive path
+        StringViewMap<const DirHandle*> dirs;  // By directory inside the archive
+
+    public:
+        size_t unsupported = 0;  // Encrypted members, or compressed in a way this build cannot read
+
+        Feeder(ThreadSafeQueue& file_queue, std::atomic<size_t>& total_files, const TraversalOptions& options,
+               std::string root)
+            : file_queue(file_queue), total_files(total_files), options(options), root(std::move(root)) {}
+
+        // Classify a member by its path; false when it is not counted, and nothing needs to be read
+        bool accepts(std::string_view path, SourceFile& file) {
+            while (path.substr(0, 2) == "./") path.remove_prefix(2);
+            while (!path.empty() && path[0] == '/') path.remove_prefix(1);
+            if (path.empty() || path.back() == '/') return false;  // Directory member
+            size_t slash = path.rfind('/');
+            std::string_view name = slash == std::string_view::npos ? path : path.substr(slash + 1);
+            LanguageDetector::Verdict verdict = LanguageDetector::classify(name);
+            if (!verdict.accepted) return false;
+            if (options.filter && !options.filter->accepts_path(path)) return false;
+
+            std::string_view dir = slash == std::string_view::npos ? std::string_view() : path.substr(0, slash);
+            auto it = dirs.find(dir);
+            if (it == dirs.end()) {
+                std::string full = dir.empty() ? root : root + "/" + std::string(dir);
+                it = dirs.emplace(std::string(dir), DirHandle::create(nullptr, PathArena::store(full), -1)).first;
+            }
+            file = SourceFile{it->second, PathArena::store(name)};
+            file.language = verdict.language;
+            file.detect = verdict.needs_content;
+            return true;
+        }
+
+        void push(SourceFile& file, const ArchiveEntry& entry) {
+            file.entry = new (PathArena::allocate(sizeof(ArchiveEntry), alignof(ArchiveEntry))) ArchiveEntry(entry);
+            file.size = entry.size;
+            file_queue.push(file);
+            total_files.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    // Plain tar: members are views into the mapping, nothing is copied
+    class MappedInput {
+    private:
+        const char* data;
+        size_t size;
+        size_t pos = 0;
+
+    public:
+        MappedInput(const char* data, size_t size) : data(data), size(size) {}
+
+        bool read(char* out, size_t n) {
+            if (size - pos < n) return false;
+            std::memcpy(out, data + pos, n);
+            pos += n;
+            return true;
+        }
+
+        bool skip(uint64_t n) {
+            if (size - pos < n) return false;
+            pos += n;
+            return true;
+        }
+
+        bool member(ArchiveEntry& entry, bool& kept) {
+            if (size - pos < entry.size) return false;
+            kept = true;
+            entry.data = data + pos;
+            entry.method = ArchiveEntry::Method::Stored;
+            pos += entry.size;
+            return true;
+        }
+    };
+
+    // Compressed tar: the decoder is the only reader of the stream, so each counted member is
+    // copied out into its own buffer, which lives until a worker releases it
+    template <typename Decoder>
+    class StreamInput {
+    private:
+        Decoder decoder;
+
+    public:
+        explicit StreamInput(int fd) : decoder(fd) {}
+
+        bool read(char* out, uint64_t n) {
+            return decoder.read(out, n) == n;
+        }
+
+        bool skip(uint64_t n) {
+            char scratch[64 * 1024];
+            while (n > 0) {
+                size_t step = static_cast<size_t>(std::min<uint64_t>(n, sizeof scratch));
+                if (!read(scratch, step)) return false;
+                n -= step;
+            }
+            return true;
+        }
+
+        // The header's size is not trusted with one allocation: the buffer grows as the decoder
+        // delivers bytes, so a corrupt size costs no more memory than the data that is really there.
+        // A member that cannot be allocated is skipped, kept false
+        bool member(ArchiveEntry& entry, bool& kept) {
+            reserve(entry.size);
+            std::unique_ptr<char[]> buffer;
+            uint64_t capacity = 0;
+            uint64_t done = 0;
+            while (done < entry.size) {
+                if (done == capacity) {
+                    capacity = std::min<uint64_t>(entry.size, std::max<uint64_t>(capacity * 2, MEMBER_CHUNK));
+                    std::unique_ptr<char[]> grown(new (std::nothrow) char[capacity]);
+                    if (!grown) {
+                        unreserve(entry.size);
+                        kept = false;
+                        return skip(entry.size - done);
+                    }
+                    if (done > 0) std::memcpy(grown.get(), buffer.get(), done);
+                    buffer = std::move(grown);
+                }
+                uint64_t step = capacity - done;
+                if (!read(buffer.get() + done, step)) {
+                    unreserve(entry.size);
+                    return false;
+                }
+                done += step;
+            }
+            entry.data = buffer.release();
+            entry.method = ArchiveEntry::Method::Streamed;
+            kept = true;
+            return true;
+        }
+    };
+
+#ifdef CODEFETCH_WITH_ZLIB
+    // gzip stream, possibly several members back to back (pigz, concatenated archives)
+    class GzipDecoder {
+    private:
+        int fd;
+        z_stream z{};
+        std::unique_ptr<Bytef[]> input{new Bytef[INPUT_CHUNK]};
+        bool ok;
+
+    public:
+        explicit GzipDecoder(int fd) : fd(fd) { ok = inflateInit2(&z, 15 + 32) == Z_OK; }  // +32: gzip or zlib header
+        ~GzipDecoder() { inflateEnd(&z); }
+
+        size_t read(char* out, uint64_t n) {  // Fewer than n bytes only at the end of the stream or on corrupt data
+            uint64_t done = 0;
+            while (ok && done < n) {
+                if (z.avail_in == 0) {
+                    ssize_t got = ::read(fd, input.get(), INPUT_CHUNK);
+                    if (got <= 0) break;
+                    z.next_in = input.get();
+                    z.avail_in = static_cast<uInt>(got);
+                }
+                uInt room = static_cast<uInt>(std::min<uint64_t>(n - done, 1u << 30));
+                z.next_out = reinterpret_cast<Bytef*>(out + done);
+                z.avail_out = room;
+                int status = inflate(&z, Z_NO_FLUSH);
+                done += room - z.avail_out;
+                if (status == Z_STREAM_END) ok = inflateReset(&z) == Z_OK;  // Next member, if any
+                else if (status != Z_OK && status != Z_BUF_ERROR) ok = false;
+            }
+            return static_cast<size_t>(done);
+        }
+    };
+
+    // Raw deflate data of a zip member, inflated in as many steps as the caller asks for
+    class Inflater {
+    private:
+        z_stream z{};
+        const char* next;  // Compressed bytes not handed to zlib yet
+        uint64_t left;
+        bool ok;
+
+    public:
+        explicit Inflater(const ArchiveEntry& entry) : next(entry.data), left(entry.packed) {
+            ok = inflateInit2(&z, -15) == Z_OK;  // Negative: no zlib header, as in zip
+        }
+        ~Inflater() { inflateEnd(&z); }
+
+        size_t fill(char* out, size_t n) {  // Fewer than n bytes only at the end of the member or on corrupt data
+            size_t done = 0;
+            while (ok && done < n) {
+                if (z.avail_in == 0) {
+                    if (left == 0) break;
+                    z.avail_in = static_cast<uInt>(std::min<uint64_t>(left, 1u << 30));
+                    z.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(next));
+                    next += z.avail_in;
+                    left -= z.avail_in;
+                }
+                uInt room = static_cast<uInt>(std::min<size_t>(n - done, 1u << 30));
+                z.next_out = reinterpret_cast<Bytef*>(out + done);
+                z.avail_out = room;
+                int status = inflate(&z, Z_NO_FLUSH);
+                done += room - z.avail_out;
+                if (status == Z_STREAM_END) break;
+                if (status != Z_OK && status != Z_BUF_ERROR) ok = false;
+            }
+            return done;
+        }
+    };
+#endif
+
+#ifdef CODEFETCH_WITH_ZSTD
+    // zstd stream, any number of frames
+    class ZstdDecoder {
+    private:
+        int fd;
+        ZSTD_DStream* stream = ZSTD_createDStream();
+        std::unique_ptr<char[]> input{new char[INPUT_CHUNK]};
+        ZSTD_inBuffer in{nullptr, 0, 0};
+        bool ok;
+
+    public:
+        explicit ZstdDecoder(int fd) : fd(fd) { ok = stream && !ZSTD_isError(ZSTD_initDStream(stream)); }
+        ~ZstdDecoder() { ZSTD_freeDStream(stream); }
+
+        size_t read(char* out, uint64_t n) {
+            ZSTD_outBuffer target{out, static_cast<size_t>(n), 0};
+            while (ok && target.pos < target.size) {
+                if (in.pos == in.size) {
+                    ssize_t got = ::read(fd, input.get(), INPUT_CHUNK);
+                    if (got <= 0) break;
+                    in = {input.get(), static_cast<size_t>(got), 0};
+                }
+                ok = !ZSTD_isError(ZSTD_decompressStream(stream, &target, &in));
+            }
+            return target.pos;
+        }
+    };
+#endif
+
+    // Members of a tar stream, in archive order. GNU long names ('L') and pax path records ('x')
+    // name the member that follows them; links, devices and directories are skipped
+    template <typename Input>
+    bool walk_tar(Input& in, Feeder& feeder, std::string& error) {
+        char header[TAR_BLOCK];
+        std::string long_name;
+        for (bool first = true;; first = false) {
+            if (!in.read(header, TAR_BLOCK) || zero_block(header)) return true;  // End blocks, or a cut-off archive
+            if (!tar_header(header)) {
+                error = first ? "not a tar archive" : "corrupt tar header";
+                return false;
+            }
+            uint64_t size = tar_number(header + 124, 12);
+            uint64_t padding = (TAR_BLOCK - size % TAR_BLOCK) % TAR_BLOCK;
+            char type = header[156];
+
+            if ((type == 'L' || type == 'x') && size > MAX_NAME_RECORD) {  // Corrupt, or no path worth reading
+                if (!in.skip(size + padding)) break;
+                continue;
+            }
+            if (type == 'L' || type == 'x') {
+                std::string data(size, '\0');
+                if (!in.read(data.data(), size) || !in.skip(padding)) break;
+                if (type == 'L') long_name = data.c_str();  // NUL-terminated
+                else if (std::string path = pax_path(data); !path.empty()) long_name = path;
+                continue;
+            }
+
+            std::string path = long_name.empty() ? tar_name(header) : std::move(long_name);
+            long_name.clear();
+            SourceFile file;
+            if ((type == '0' || type == '\0' || type == '7') && feeder.accepts(path, file)) {  // '7': contiguous file
+                ArchiveEntry entry;
+                entry.size = entry.packed = size;
+                bool kept;
+                if (!in.member(entry, kept)) break;
+                if (kept) feeder.push(file, entry);
+                else ++feeder.unsupported;
+                if (!in.skip(padding)) return true;  // Last member, padding cut off
+            } else if (!in.skip(size + padding)) {
+                break;
+            }
+        }
+        error = "truncated tar archive";
+        return false;
+    }
+
+    // Members listed by the central directory, ZIP64 included; data is located through each local header.
+    // Symbolic links are skipped, as the directory walk does by default
+    bool walk_zip(const char* data, size_t size, Feeder& feeder, std::string& error) {
+        constexpr size_t EOCD = 22;  // End of central directory record, without its comment
+        size_t eocd = std::string_view::npos;
+        size_t lowest = size > EOCD + 0xffff ? size - EOCD - 0xffff : 0;  // Comments are at most 64K
+        for (size_t pos = size >= EOCD ? size - EOCD + 1 : 0; pos-- > lowest;) {
+            if (std::memcmp(data + pos, "PK\x05\x06", 4) == 0) {
+                eocd = pos;
+                break;
+            }
+        }
+        if (eocd == std::string_view::npos) {
+            error = "zip end of central directory not found";
+            return false;
+        }
+
+        uint64_t count = u16(data + eocd + 10);
+        uint64_t directory = u32(data + eocd + 16);
+        if (eocd >= 20 && std::memcmp(data + eocd - 20, "PK\x06\x07", 4) == 0) {  // ZIP64 locator
+            uint64_t record = u64(data + eocd - 20 + 8);
+            if (fits(record, 56, size) && std::memcmp(data + record, "PK\x06\x06", 4) == 0) {
+                count = u64(data + record + 32);
+                directory = u64(data + record + 48);
+            }
+        }
+
+        uint64_t pos = directory;
+        for (uint64_t i = 0; i < count; ++i) {
+            if (!fits(pos, 46, size) || std::memcmp(data + pos, "PK\x01\x02", 4) != 0) {
+                error = "corrupt zip central directory";
+                return false;
+            }
+            const char* record = data + pos;
+            bool unix_host = u16(record + 4) >> 8 == 3;  // "Made by" a Unix zip: mode bits in the external attributes
+            bool symlink = unix_host && (u32(record + 38) >> 16 & 0170000) == 0120000;
+            uint16_t flags = u16(record + 8);
+            uint16_t method = u16(record + 10);
+            uint64_t packed = u32(record + 20);
+            uint64_t unpacked = u32(record + 24);
+            size_t name_length = u16(record + 28);
+            size_t extra_length = u16(record + 30);
+            uint64_t local = u32(record + 42);
+            pos += 46 + name_length + extra_length + u16(record + 32);
+            if (pos > size) {
+                error = "corrupt zip central directory";
+                return false;
+            }
+
+            // ZIP64 extra field: 64-bit values for exactly the fields saturated above, in this order
+            for (const char* extra = record + 46 + name_length; extra + 4 <= record + 46 + name_length + extra_length;) {
+                uint16_t id = u16(extra);
+                const char* value = extra + 4;
+                const char* end = value + u16(extra + 2);
+                if (id == 0x0001) {
+                    if (unpacked == 0xffffffff && value + 8 <= end) { unpacked = u64(value); value += 8; }
+                    if (packed == 0xffffffff && value + 8 <= end) { packed = u64(value); value += 8; }
+                    if (local == 0xffffffff && value + 8 <= end) local = u64(value);
+                }
+                extra = end;
+            }
+
+            SourceFile file;
+            if (symlink || !feeder.accepts(std::string_view(record + 46, name_length), file)) continue;  // Links hold their target
+            bool readable = !(flags & 1) && (method == 0 || method == 8);  // Bit 0: encrypted
+#ifndef CODEFETCH_WITH_ZLIB
+            readable = readable && method == 0;
+#endif
+            bool sized = method == 0 ? packed == unpacked : unpacked / MAX_DEFLATE_RATIO <= packed;
+            if (!readable || !sized) {
+                ++feeder.unsupported;
+                continue;
+            }
+            if (!fits(local, 30, size) || std::memcmp(data + local, "PK\x03\x04", 4) != 0) {
+                error = "corrupt zip local header";
+                return false;
+            }
+            uint64_t start = local + 30 + u16(data + local + 26) + u16(data + local + 28);
+            if (!fits(start, packed, size)) {
+                error = "truncated zip archive";
+                return false;
+            }
+            ArchiveEntry entry;
+            entry.data = data + start;
+            entry.packed = packed;
+            entry.size = unpacked;
+            entry.method = method == 8 ? ArchiveEntry::Method::Deflated : ArchiveEntry::Method::Stored;
+            feeder.push(file, entry);
+        }
+        return true;
+    }
+}
+
+namespace ArchiveSource {
+    bool recognizes(const std::string& path) {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) return false;
+        char head[TAR_BLOCK];
+        ssize_t n = pread(fd, head, sizeof head, 0);
+        close(fd);
+        return n > 0 && format_of(head, static_cast<size_t>(n)) != Format::None;
+    }
+
+    bool read(const std::string& path, ThreadSafeQueue& file_queue, std::atomic<size_t>& total_files,
+              const TraversalOptions& options, std::string& error) {
+        int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
+            error = "cannot open " + path;
+            return false;
+        }
+        char head[TAR_BLOCK];
+        ssize_t n = pread(fd, head, sizeof head, 0);
+        Format format = n > 0 ? format_of(head, static_cast<size_t>(n)) : Format::None;
+        Feeder feeder(file_queue, total_files, options, path);
+
+        bool ok = false;
+        const char* data = nullptr;
+        size_t size = 0;
+        switch (format) {
+        case Format::Tar:
+        case Format::Zip:
+            if (!map_archive(fd, data, size)) {
+                error = "cannot map " + path;
+                break;
+            }
+            if (format == Format::Tar) {
+                MappedInput in(data, size);
+                ok = walk_tar(in, feeder, error);
+            } else {
+                ok = walk_zip(data, size, feeder, error);
+            }
+            break;
+        case Format::Gzip:
+#ifdef CODEFETCH_WITH_ZLIB
+            {
+                auto in = std::make_unique<StreamInput<GzipDecoder>>(fd);
+                ok = walk_tar(*in, feeder, error);
+            }
+#else
+            error = "built without zlib, cannot read gzip-compressed " + path;
+#endif
+            break;
+        case Format::Zstd:
+#ifdef CODEFETCH_WITH_ZSTD
+            {
+                auto in = std::make_unique<StreamInput<ZstdDecoder>>(fd);
+                ok = walk_tar(*in, feeder, error);
+            }
+#else
+            error = "built without zstd, cannot read zstd-compressed " + path;
+#endif
+            break;
+        case Format::None:
+            error = "unsupported archive " + path;
+            break;
+        }
+        close(fd);  // A mapping outlives its descriptor
+
+        unsupported_members.fetch_add(feeder.unsupported, std::memory_order_relaxed);
+        return ok;
+    }
+
+    bool load(const ArchiveEntry& entry, FileBuffer& buffer, const HeadCheck& check) {
+        if (entry.size == 0) return false;  // Like empty files on disk
+        if (entry.method != ArchiveEntry::Method::Deflated) {
+            std::string_view bytes(entry.data, entry.size);
+            if (check && !check(bytes.substr(0, FileBuffer::HEAD), entry.size)) return false;
+            buffer.hold(bytes);
+            return true;
+        }
+#ifdef CODEFETCH_WITH_ZLIB
+        char first[FileBuffer::HEAD];
+        Inflater inflater(entry);
+        size_t head = inflater.fill(first, std::min<size_t>(entry.size, FileBuffer::HEAD));  // A rejected member is not inflated further
+        if (check && !check({first, head}, entry.size)) return false;
+        std::unique_ptr<char[]> bytes(new (std::nothrow) char[entry.size]);  // Only once the head was accepted
+        if (!bytes) {
+            unsupported_members.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        std::memcpy(bytes.get(), first, head);
+        size_t done = head + inflater.fill(bytes.get() + head, entry.size - head);
+        if (done != entry.size) return false;  // Corrupt member
+        std::string_view view(bytes.get(), entry.size);
+        buffer.hold(view, std::move(bytes));
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    size_t unsupported() {
+        return unsupported_members.load(std::memory_order_relaxed);
+    }
+
+    void release(const ArchiveEntry& entry) {
+        if (entry.method != ArchiveEntry::Method::Streamed) {
+            FileIo::release(entry.data, entry.packed);  // Whole pages only, neighbours keep theirs
+            return;
+        }
+        delete[] entry.data;
+        unreserve(entry.size);
+    }
+}
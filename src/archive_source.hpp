@@ -0,0 +1,42 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "file_io.hpp"
+#include "file_utils.hpp"
+#include "source_file.hpp"
+#include "thread_safe_queue.hpp"
+
+// One member of an archive, handed to the workers in place of a file on disk (SourceFile::entry).
+// Plain tar members and stored zip members are views into the mapped archive, deflated zip members
+// are inflated by the worker that processes them, members of a compressed tar stream were already
+// decompressed by the reader into a buffer of their own
+struct ArchiveEntry {
+    enum class Method : uint8_t { Stored, Deflated, Streamed };
+
+    const char* data = nullptr;  // Member bytes as stored in the archive
+    uint64_t packed = 0;         // Bytes at data
+    uint64_t size = 0;           // Content size
+    Method method = Method::Stored;
+};
+
+// Archives scanned without extracting them: tar, tar.gz, tar.zst and zip, recognized by their
+// first bytes. tar.gz and tar.zst need the program built with zlib and zstd, zip's deflate zlib
+namespace ArchiveSource {
+    bool recognizes(const std::string& path);  // Regular file that starts like a supported archive
+
+    // Feed the members of the archive at path, named "<path>/<member>"; false with error set when
+    // it cannot be read. Compressed tar streams are decompressed here, at most BUDGET bytes of
+    // members waiting for a worker at a time
+    bool read(const std::string& path, ThreadSafeQueue& file_queue, std::atomic<size_t>& total_files,
+              const TraversalOptions& options, std::string& error);
+    constexpr size_t BUDGET = 256 * 1024 * 1024;
+
+    // Content of a member into buffer, inflating it when needed; check sees its head first
+    bool load(const ArchiveEntry& entry, FileBuffer& buffer, const HeadCheck& check = nullptr);
+    void release(const ArchiveEntry& entry);  // Processing done: a Streamed member's buffer is freed
+    size_t unsupported();  // Members skipped: encrypted, unsupported compression, or too large to allocate
+}
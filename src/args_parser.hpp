@@ -12,6 +12,8 @@ private:
     std::string program_name;            // Program name storage
     std::string directory;               // Directory path storage
     std::map<std::string, bool*> flags;  // Flag pointers map
+    std::map<std::string, std::string*> options;  // Value option pointers map
+    std::map<std::string, std::vector<std::string>*> lists;  // Repeatable option pointers map
     std::string version;                 // Version string
     
 public:
@@ -23,6 +25,14 @@ public:
         flags[name] = value;
     }
 
+    void add_option(const std::string& name, std::string* value) {  // Add option taking a value
+        options[name] = value;
+    }
+
+    void add_list_option(const std::string& name, std::vector<std::string>* values) {  // Repeatable, comma-separated
+        lists[name] = values;
+    }
+
     void parse(int argc, char* argv[]) {  // Parse command line arguments
         std::vector<std::string> args(argv + 1, argv + argc);  // Convert to vector
         
@@ -35,17 +45,63 @@ public:
             }
 
             if (arg == "-h" || arg == "--help") {  // Handle help flag
-                std::cout << "-t, --total-lines        Show total lines (Code + Comments) "<< std::endl;
+                std::cout << "-t, --total-lines        Show total lines (Code, Comments, Blanks)"<< std::endl;
                 std::cout << "-l, --languages          Show language statistics"<< std::endl;
                 std::cout << "-g, --git-statistics     Show git statistics information"<< std::endl;
                 std::cout << "-m, --metabuild_system   Show metabuild system information"<< std::endl;
                 std::cout << "-i, --license            Show license information"<< std::endl;
+                std::cout << "-x, --metrics            Show size, line lengths and indentation per language"<< std::endl;
+                std::cout << "-d, --debt-markers       Show TODO/FIXME/HACK/XXX comments per language and directory"<< std::endl;
+                std::cout << "    --marker TAG         Also count TAG as a debt marker (repeatable, up to 8 tags)"<< std::endl;
+                std::cout << "    --no-ignore          Don't respect .gitignore/.ignore files"<< std::endl;
+                std::cout << "    --no-git-index       Walk the filesystem instead of reading .git/index"<< std::endl;
+                std::cout << "    --untracked          With .git/index, also count untracked unignored files"<< std::endl;
+                std::cout << "    --no-gitattributes   Ignore linguist-vendored/-generated/-language"<< std::endl;
+                std::cout << "    --follow-symlinks    Follow symbolic links (each file/dir still counted once)"<< std::endl;
+                std::cout << "    --one-file-system    Don't cross filesystem boundaries"<< std::endl;
+                std::cout << "    --files-from FILE    Read NUL/newline-separated file list (- for stdin)"<< std::endl;
+                std::cout << "    --include GLOB       Only count matching files (repeatable, comma-separated)"<< std::endl;
+                std::cout << "    --exclude GLOB       Skip matching files and directories (repeatable)"<< std::endl;
+                std::cout << "    --queue-capacity N   Max files buffered between traversal and workers"<< std::endl;
+                std::cout << "    --duplicates         Count byte-identical files once, report the copies"<< std::endl;
+                std::cout << "    --keep-generated     Count binary, minified and generated files too"<< std::endl;
+                std::cout << "    --pread-limit SIZE   Read files up to SIZE with pread, map larger ones (default 128K)"<< std::endl;
+                std::cout << "    --window-limit SIZE  Scan files from SIZE through a sliding mmap window (default 64M)"<< std::endl;
+                std::cout << "    --window SIZE        Bytes a sliding window keeps resident (default 16M)"<< std::endl;
+                std::cout << "    --split-limit SIZE   Scan files from SIZE in parallel chunks (default 32M)"<< std::endl;
+                std::cout << "    --profile            Show SIMD kernel and read strategy counts"<< std::endl;
                 std::cout << "-v, --version            Show version information"<< std::endl;
+                std::cout << "Instead of a directory, PATH may be a tar, tar.gz, tar.zst or zip archive"<< std::endl;
                 std::exit(0);
             }
             
-            if (arg.substr(0, 2) == "--") {  // Handle long flags
+            if (arg.substr(0, 2) == "--") {  // Handle long flags and options
                 std::string flag = arg.substr(2);
+                size_t eq = flag.find('=');   // "--name=value" form
+                auto list = lists.find(flag.substr(0, eq));
+                if (list != lists.end()) {
+                    if (eq == std::string::npos && i + 1 >= args.size()) {
+                        throw std::invalid_argument("missing value for --" + flag);
+                    }
+                    std::string value = eq != std::string::npos ? flag.substr(eq + 1) : args[++i];
+                    for (size_t start = 0, end; start <= value.size(); start = end + 1) {
+                        end = value.find(',', start);
+                        if (end == std::string::npos) end = value.size();
+                        if (end > start) list->second->push_back(value.substr(start, end - start));
+                    }
+                    continue;
+                }
+                auto opt = options.find(flag.substr(0, eq));
+                if (opt != options.end()) {
+                    if (eq != std::string::npos) {
+                        *opt->second = flag.substr(eq + 1);
+                    } else if (i + 1 < args.size()) {
+                        *opt->second = args[++i];  // "--name value" form
+                    } else {
+                        throw std::invalid_argument("missing value for --" + flag);
+                    }
+                    continue;
+                }
                 auto it = flags.find(flag);
                 if (it != flags.end()) {
                     *it->second = true;
@@ -0,0 +1,364 @@
+#include <cstdint>
+#include <cstring>  // For memcpy
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define BYTE_COUNT_X86 1
+#endif
+
+#include "byte_count.hpp"
+
+namespace {
+    using Kernel = size_t (*)(const char* data, size_t size, char byte);
+    using BlockKernel = ByteCount::BlockMasks (*)(const char* block, const ByteCount::ByteSet& set);
+    using WideKernel = ByteCount::BlockMasks (*)(const char* block, size_t units, size_t width, bool big_endian,
+                                                 const ByteCount::ByteSet& set);
+
+    // Portable fallback: eight bytes per step, zero bytes of (word ^ pattern) are the matches
+    size_t count_swar(const char* data, size_t size, char byte) {
+        constexpr uint64_t ONES = 0x0101010101010101ull;
+        constexpr uint64_t LOW7 = 0x7f7f7f7f7f7f7f7full;
+        const uint64_t pattern = ONES * static_cast<unsigned char>(byte);
+
+        size_t total = 0;
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            uint64_t word;
+            std::memcpy(&word, data + i, 8);
+            uint64_t x = word ^ pattern;
+            uint64_t zero = ~(((x & LOW7) + LOW7) | x | LOW7);  // High bit set exactly in zero bytes
+            total += ((zero >> 7) * ONES) >> 56;                // Horizontal byte sum, no popcnt needed
+        }
+        for (; i < size; ++i) total += data[i] == byte;
+        return total;
+    }
+
+    ByteCount::BlockMasks scan_scalar(const char* block, const ByteCount::ByteSet& set) {
+        ByteCount::BlockMasks masks{};
+        for (size_t i = 0; i < ByteCount::BLOCK; ++i) {
+            unsigned char c = static_cast<unsigned char>(block[i]);
+            uint64_t bit = 1ull << i;
+            if ((c & 0xc0) == 0x80) masks.continuations |= bit;
+            if (c == '\t') masks.tabs |= bit;
+            if (c == '\n') masks.newlines |= bit;
+            else if (c == '\r') masks.returns |= bit;
+            else if (c != ' ' && (c < '\t' || c > '\r')) masks.visible |= bit;
+            for (size_t k = 0; k < set.size; ++k) {
+                if (c == static_cast<unsigned char>(set.bytes[k])) masks.hits |= bit;
+            }
+        }
+        return masks;
+    }
+
+    uint32_t load_unit(const char* p, size_t width, bool big_endian) {
+        const unsigned char* u = reinterpret_cast<const unsigned char*>(p);
+        if (width == 2) return big_endian ? (u[0] << 8 | u[1]) : (u[1] << 8 | u[0]);
+        return big_endian ? (static_cast<uint32_t>(u[0]) << 24 | u[1] << 16 | u[2] << 8 | u[3])
+                          : (static_cast<uint32_t>(u[3]) << 24 | u[2] << 16 | u[1] << 8 | u[0]);
+    }
+
+    ByteCount::BlockMasks scan_wide_scalar(const char* block, size_t units, size_t width, bool big_endian,
+                                           const ByteCount::ByteSet& set) {
+        ByteCount::BlockMasks masks{};
+        for (size_t i = 0; i < ByteCount::BLOCK && i < units; ++i) {
+            uint32_t c = load_unit(block + i * width, width, big_endian);
+            uint64_t bit = 1ull << i;
+            if (width == 2 && (c & 0xfc00) == 0xdc00) masks.continuations |= bit;  // Low surrogate
+            if (c == '\t') masks.tabs |= bit;
+            if (c == '\n') masks.newlines |= bit;
+            else if (c == '\r') masks.returns |= bit;
+            else if (c != ' ' && (c < '\t' || c > '\r')) masks.visible |= bit;
+            for (size_t k = 0; k < set.size; ++k) {
+                if (c == static_cast<unsigned char>(set.bytes[k])) masks.hits |= bit;
+            }
+        }
+        return masks;
+    }
+
+#ifdef BYTE_COUNT_X86
+    // Match bitmask of one vector (lambdas would not inherit the target attribute)
+    __attribute__((target("sse2")))
+    inline uint32_t match_mask_sse2(const char* p, __m128i pattern) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, pattern)));
+    }
+
+    __attribute__((target("avx2")))
+    inline uint32_t match_mask_avx2(const char* p, __m256i pattern) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, pattern)));
+    }
+
+    // Per-byte masks of one vector, as in BlockMasks; \t..\r become 0..4 after subtracting \t
+    struct VectorMasks {
+        uint32_t newlines, returns, hits, blank, tabs, continuations;
+    };
+
+    __attribute__((target("sse2")))
+    inline VectorMasks scan_sse2(const char* p, const ByteCount::ByteSet& set) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i any = _mm_cmpeq_epi8(chunk, _mm_set1_epi8(set.bytes[0]));
+        for (size_t k = 1; k < 8; ++k) any = _mm_or_si128(any, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(set.bytes[k])));
+        __m128i shifted = _mm_sub_epi8(chunk, _mm_set1_epi8('\t'));
+        __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(4)), shifted);
+        __m128i trailing = _mm_cmpeq_epi8(_mm_and_si128(chunk, _mm_set1_epi8(static_cast<char>(0xc0))), _mm_set1_epi8(static_cast<char>(0x80)));
+        return {static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')))),
+                static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\r')))),
+                static_cast<uint32_t>(_mm_movemask_epi8(any)),
+                static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(control, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' '))))),
+                static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\t')))),
+                static_cast<uint32_t>(_mm_movemask_epi8(trailing))};
+    }
+
+    __attribute__((target("avx2")))
+    inline VectorMasks scan_avx2(const char* p, const ByteCount::ByteSet& set) {
+        __m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i any = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(set.bytes[0]));
+        for (size_t k = 1; k < 8; ++k) any = _mm256_or_si256(any, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(set.bytes[k])));
+        __m256i shifted = _mm256_sub_epi8(chunk, _mm256_set1_epi8('\t'));
+        __m256i control = _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8(4)), shifted);
+        __m256i trailing = _mm256_cmpeq_epi8(_mm256_and_si256(chunk, _mm256_set1_epi8(static_cast<char>(0xc0))), _mm256_set1_epi8(static_cast<char>(0x80)));
+        return {static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')))),
+                static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\r')))),
+                static_cast<uint32_t>(_mm256_movemask_epi8(any)),
+                static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(control, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' '))))),
+                static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\t')))),
+                static_cast<uint32_t>(_mm256_movemask_epi8(trailing))};
+    }
+
+    __attribute__((target("sse2")))
+    ByteCount::BlockMasks scan_block_sse2(const char* block, const ByteCount::ByteSet& set) {
+        uint64_t newlines = 0, returns = 0, hits = 0, blank = 0, tabs = 0, continuations = 0;
+        for (size_t i = 0; i < ByteCount::BLOCK; i += 16) {
+            VectorMasks m = scan_sse2(block + i, set);
+            newlines |= static_cast<uint64_t>(m.newlines) << i;
+            returns |= static_cast<uint64_t>(m.returns) << i;
+            hits |= static_cast<uint64_t>(m.hits) << i;
+            blank |= static_cast<uint64_t>(m.blank) << i;
+            tabs |= static_cast<uint64_t>(m.tabs) << i;
+            continuations |= static_cast<uint64_t>(m.continuations) << i;
+        }
+        return {newlines, returns, hits & ~newlines, ~blank, tabs, continuations};  // Unused set slots hold '\n'
+    }
+
+    __attribute__((target("avx2")))
+    ByteCount::BlockMasks scan_block_avx2(const char* block, const ByteCount::ByteSet& set) {
+        VectorMasks low = scan_avx2(block, set);
+        VectorMasks high = scan_avx2(block + 32, set);
+        auto join = [](uint32_t l, uint32_t h) { return l | (static_cast<uint64_t>(h) << 32); };  // No intrinsics inside
+        uint64_t newlines = join(low.newlines, high.newlines);
+        return {newlines, join(low.returns, high.returns), join(low.hits, high.hits) & ~newlines,
+                ~join(low.blank, high.blank), join(low.tabs, high.tabs), join(low.continuations, high.continuations)};
+    }
+
+    __attribute__((target("avx512f,avx512bw")))
+    ByteCount::BlockMasks scan_block_avx512(const char* block, const ByteCount::ByteSet& set) {
+        __m512i chunk = _mm512_loadu_si512(block);
+        __mmask64 hits = 0;
+        for (size_t k = 0; k < 8; ++k) hits |= _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(set.bytes[k]));
+        __mmask64 newlines = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('\n'));
+        __mmask64 returns = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('\r'));
+        __mmask64 control = _mm512_cmple_epu8_mask(_mm512_sub_epi8(chunk, _mm512_set1_epi8('\t')), _mm512_set1_epi8(4));
+        __mmask64 blank = control | _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8(' '));
+        __mmask64 tabs = _mm512_cmpeq_epi8_mask(chunk, _mm512_set1_epi8('\t'));
+        __mmask64 continuations = _mm512_cmpeq_epi8_mask(_mm512_and_si512(chunk, _mm512_set1_epi8(static_cast<char>(0xc0))),
+                                                         _mm512_set1_epi8(static_cast<char>(0x80)));
+        return {newlines, returns, hits & ~newlines, ~blank, tabs, continuations};
+    }
+
+    // Code units of one vector in host order: big-endian input gets its bytes swapped first
+    __attribute__((target("sse2")))
+    inline __m128i load_units_sse2(const char* p, size_t width, bool big_endian) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        if (!big_endian) return v;
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));                 // Bytes of each 16-bit half
+        if (width == 4) v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1);  // Halves of each 32-bit unit
+        return v;
+    }
+
+    // All-ones lanes where a unit is '\n', '\r', a set member, whitespace, '\t' or a low surrogate
+    struct WideLanes {
+        __m128i newlines, returns, hits, blank, tabs, continuations;
+    };
+
+    // Signed compares: \t..\r become 0..4 after subtracting \t, units at or above the sign bit go negative
+    __attribute__((target("sse2")))
+    inline WideLanes compare16_sse2(__m128i units, const ByteCount::ByteSet& set) {
+        __m128i any = _mm_cmpeq_epi16(units, _mm_set1_epi16(static_cast<unsigned char>(set.bytes[0])));
+        for (size_t k = 1; k < 8; ++k) {
+            any = _mm_or_si128(any, _mm_cmpeq_epi16(units, _mm_set1_epi16(static_cast<unsigned char>(set.bytes[k]))));
+        }
+        __m128i shifted = _mm_sub_epi16(units, _mm_set1_epi16('\t'));
+        __m128i control = _mm_andnot_si128(_mm_cmplt_epi16(shifted, _mm_setzero_si128()), _mm_cmplt_epi16(shifted, _mm_set1_epi16(5)));
+        __m128i surrogate = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xfc00))),
+                                            _mm_set1_epi16(static_cast<short>(0xdc00)));
+        return {_mm_cmpeq_epi16(units, _mm_set1_epi16('\n')), _mm_cmpeq_epi16(units, _mm_set1_epi16('\r')), any,
+                _mm_or_si128(control, _mm_cmpeq_epi16(units, _mm_set1_epi16(' '))),
+                _mm_cmpeq_epi16(units, _mm_set1_epi16('\t')), surrogate};
+    }
+
+    __attribute__((target("sse2")))
+    inline WideLanes compare32_sse2(__m128i units, const ByteCount::ByteSet& set) {
+        __m128i any = _mm_cmpeq_epi32(units, _mm_set1_epi32(static_cast<unsigned char>(set.bytes[0])));
+        for (size_t k = 1; k < 8; ++k) {
+            any = _mm_or_si128(any, _mm_cmpeq_epi32(units, _mm_set1_epi32(static_cast<unsigned char>(set.bytes[k]))));
+        }
+        __m128i shifted = _mm_sub_epi32(units, _mm_set1_epi32('\t'));
+        __m128i control = _mm_andnot_si128(_mm_cmplt_epi32(shifted, _mm_setzero_si128()), _mm_cmplt_epi32(shifted, _mm_set1_epi32(5)));
+        return {_mm_cmpeq_epi32(units, _mm_set1_epi32('\n')), _mm_cmpeq_epi32(units, _mm_set1_epi32('\r')), any,
+                _mm_or_si128(control, _mm_cmpeq_epi32(units, _mm_set1_epi32(' '))),
+                _mm_cmpeq_epi32(units, _mm_set1_epi32('\t')), _mm_setzero_si128()};  // Every UTF-32 unit is a code point
+    }
+
+    // Saturating packs keep lane order and turn all-ones/zero lanes into 0xff/0 bytes, one per unit
+    __attribute__((target("sse2")))
+    inline WideLanes narrow16_sse2(const WideLanes& a, const WideLanes& b) {
+        return {_mm_packs_epi16(a.newlines, b.newlines), _mm_packs_epi16(a.returns, b.returns),
+                _mm_packs_epi16(a.hits, b.hits), _mm_packs_epi16(a.blank, b.blank),
+                _mm_packs_epi16(a.tabs, b.tabs), _mm_packs_epi16(a.continuations, b.continuations)};
+    }
+
+    __attribute__((target("sse2")))
+    inline WideLanes narrow32_sse2(const WideLanes& a, const WideLanes& b) {
+        return {_mm_packs_epi32(a.newlines, b.newlines), _mm_packs_epi32(a.returns, b.returns),
+                _mm_packs_epi32(a.hits, b.hits), _mm_packs_epi32(a.blank, b.blank),
+                _mm_packs_epi32(a.tabs, b.tabs), _mm_packs_epi32(a.continuations, b.continuations)};
+    }
+
+    // UTF-16/32 has no wider tier: such files are rare, and SSE2 already compares 8 or 4 units at once
+    __attribute__((target("sse2")))
+    ByteCount::BlockMasks scan_wide_sse2(const char* block, size_t units, size_t width, bool big_endian,
+                                         const ByteCount::ByteSet& set) {
+        if (units < ByteCount::BLOCK) return scan_wide_scalar(block, units, width, big_endian, set);  // Tail
+        uint64_t newlines = 0, returns = 0, hits = 0, blank = 0, tabs = 0, continuations = 0;
+        for (size_t i = 0; i < ByteCount::BLOCK; i += 16) {  // 16 units per step
+            const char* p = block + i * width;
+            WideLanes lanes;
+            if (width == 2) {
+                lanes = narrow16_sse2(compare16_sse2(load_units_sse2(p, 2, big_endian), set),
+                                      compare16_sse2(load_units_sse2(p + 16, 2, big_endian), set));
+            } else {
+                WideLanes low = narrow32_sse2(compare32_sse2(load_units_sse2(p, 4, big_endian), set),
+                                              compare32_sse2(load_units_sse2(p + 16, 4, big_endian), set));
+                WideLanes high = narrow32_sse2(compare32_sse2(load_units_sse2(p + 32, 4, big_endian), set),
+                                               compare32_sse2(load_units_sse2(p + 48, 4, big_endian), set));
+                lanes = narrow16_sse2(low, high);
+            }
+            newlines |= static_cast<uint64_t>(_mm_movemask_epi8(lanes.newlines)) << i;
+            returns |= static_cast<uint64_t>(_mm_movemask_epi8(lanes.returns)) << i;
+            hits |= static_cast<uint64_t>(_mm_movemask_epi8(lanes.hits)) << i;
+            blank |= static_cast<uint64_t>(_mm_movemask_epi8(lanes.blank)) << i;
+            tabs |= static_cast<uint64_t>(_mm_movemask_epi8(lanes.tabs)) << i;
+            continuations |= static_cast<uint64_t>(_mm_movemask_epi8(lanes.continuations)) << i;
+        }
+        return {newlines, returns, hits & ~newlines, ~blank, tabs, continuations};
+    }
+
+    __attribute__((target("sse2,popcnt")))
+    size_t count_sse2(const char* data, size_t size, char byte) {
+        const __m128i pattern = _mm_set1_epi8(byte);
+        size_t total = 0;
+        size_t i = 0;
+        for (; i + 64 <= size; i += 64) {  // Four independent compares per step keep the ports busy
+            const char* p = data + i;
+            uint64_t low = match_mask_sse2(p, pattern) | (match_mask_sse2(p + 16, pattern) << 16);
+            uint64_t high = match_mask_sse2(p + 32, pattern) | (match_mask_sse2(p + 48, pattern) << 16);
+            total += _mm_popcnt_u64(low | (high << 32));
+        }
+        for (; i + 16 <= size; i += 16) total += _mm_popcnt_u32(match_mask_sse2(data + i, pattern));
+        for (; i < size; ++i) total += data[i] == byte;
+        return total;
+    }
+
+    __attribute__((target("avx2,popcnt")))
+    size_t count_avx2(const char* data, size_t size, char byte) {
+        const __m256i pattern = _mm256_set1_epi8(byte);
+        size_t total = 0;
+        size_t i = 0;
+        for (; i + 128 <= size; i += 128) {
+            const char* p = data + i;
+            uint64_t low = match_mask_avx2(p, pattern) | (static_cast<uint64_t>(match_mask_avx2(p + 32, pattern)) << 32);
+            uint64_t high = match_mask_avx2(p + 64, pattern) | (static_cast<uint64_t>(match_mask_avx2(p + 96, pattern)) << 32);
+            total += _mm_popcnt_u64(low) + _mm_popcnt_u64(high);
+        }
+        for (; i + 32 <= size; i += 32) total += _mm_popcnt_u32(match_mask_avx2(data + i, pattern));
+        for (; i < size; ++i) total += data[i] == byte;
+        return total;
+    }
+
+    __attribute__((target("avx512f,avx512bw,popcnt")))
+    size_t count_avx512(const char* data, size_t size, char byte) {
+        const __m512i pattern = _mm512_set1_epi8(byte);
+        size_t total = 0;
+        size_t i = 0;
+        for (; i + 128 <= size; i += 128) {  // Compares yield 64-bit masks directly, no movemask needed
+            __m512i a = _mm512_loadu_si512(data + i);
+            __m512i b = _mm512_loadu_si512(data + i + 64);
+            total += _mm_popcnt_u64(_mm512_cmpeq_epi8_mask(a, pattern));
+            total += _mm_popcnt_u64(_mm512_cmpeq_epi8_mask(b, pattern));
+        }
+        for (; i < size; i += 64) {  // Masked loads cover the tail without touching bytes past the end
+            size_t left = size - i;
+            __mmask64 valid = left >= 64 ? ~0ull : (1ull << left) - 1;
+            __m512i chunk = _mm512_maskz_loadu_epi8(valid, data + i);
+            total += _mm_popcnt_u64(_mm512_mask_cmpeq_epi8_mask(valid, chunk, pattern));
+        }
+        return total;
+    }
+#endif
+
+    struct Selected {
+        Kernel kernel;
+        BlockKernel block_kernel;
+        WideKernel wide_kernel;
+        const char* name;
+    };
+
+    Selected select_kernel() {
+#ifdef BYTE_COUNT_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("popcnt")) {
+            if (__builtin_cpu_supports("avx512bw")) return {count_avx512, scan_block_avx512, scan_wide_sse2, "avx512bw"};
+            if (__builtin_cpu_supports("avx2")) return {count_avx2, scan_block_avx2, scan_wide_sse2, "avx2"};
+            if (__builtin_cpu_supports("sse2")) return {count_sse2, scan_block_sse2, scan_wide_sse2, "sse2"};
+        }
+#endif
+        return {count_swar, scan_scalar, scan_wide_scalar, "swar"};
+    }
+
+    const Selected& selected() {
+        static const Selected choice = select_kernel();  // CPUID is queried once
+        return choice;
+    }
+}
+
+namespace ByteCount {
+    size_t count(const char* data, size_t size, char byte) {
+        return selected().kernel(data, size, byte);
+    }
+
+    const char* kernel_name() {
+        return selected().name;
+    }
+
+    bool ByteSet::add(char byte) {
+        for (size_t k = 0; k < size; ++k) {
+            if (bytes[k] == byte) return true;
+        }
+        if (size == 8) return false;
+        bytes[size++] = byte;
+        return true;
+    }
+
+    BlockMasks scan_block(const char* data, size_t size, const ByteSet& set) {
+        if (size >= BLOCK) return selected().block_kernel(data, set);
+        char padded[BLOCK];  // Tail of a buffer: never read past its end
+        std::memcpy(padded, data, size);
+        std::memset(padded + size, ' ', BLOCK - size);
+        return selected().block_kernel(padded, set);
+    }
+
+    BlockMasks scan_block_wide(const char* data, size_t units, size_t width, bool big_endian, const ByteSet& set) {
+        return selected().wide_kernel(data, units, width, big_endian, set);
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Vectorized byte counting (compare, movemask, popcount) and block scanning for the line
+// classifier. The widest kernels the CPU supports (AVX-512BW, AVX2, SSE2, portable SWAR)
+// are picked once from CPUID on first use
+namespace ByteCount {
+    size_t count(const char* data, size_t size, char byte);  // Occurrences of byte in data[0, size)
+    const char* kernel_name();                               // Selected kernel, for diagnostics
+
+    constexpr size_t BLOCK = 64;  // Bytes described by one BlockMasks
+
+    // Bytes a scanner stops at, besides '\n'. Unused slots repeat '\n' so kernels compare a fixed count
+    struct ByteSet {
+        char bytes[8] = {'\n', '\n', '\n', '\n', '\n', '\n', '\n', '\n'};
+        size_t size = 0;
+        bool add(char byte);  // False when the set is full; adding a member again is a no-op
+    };
+
+    // Bit i describes byte i of a BLOCK-sized window
+    struct BlockMasks {
+        uint64_t newlines;  // '\n'
+        uint64_t returns;   // '\r'
+        uint64_t hits;      // Member of the ByteSet
+        uint64_t visible;   // Anything but space, \t, \n, \v, \f, \r
+        uint64_t tabs;      // '\t'
+        uint64_t continuations;  // Units that do not start a code point: UTF-8 10xxxxxx, UTF-16 low surrogates
+    };
+
+    // Masks of data[0, BLOCK); shorter tails are padded with spaces, which set no bit
+    BlockMasks scan_block(const char* data, size_t size, const ByteSet& set);
+
+    // Same masks for BLOCK code units of width 2 or 4 bytes (UTF-16/32), compared as numbers so
+    // units above 0x7f never match the ASCII set; fewer than BLOCK units left: the rest sets no bit
+    BlockMasks scan_block_wide(const char* data, size_t units, size_t width, bool big_endian, const ByteSet& set);
+}
@@ -0,0 +1,95 @@
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "chunked_scan.hpp"
+#include "file_io.hpp"
+#include "thread_safe_queue.hpp"
+
+namespace {
+    ThreadSafeQueue* pool = nullptr;
+
+    struct Job {
+        const CommentSyntax* syntax;
+        LineClassifier::Release release;
+        LineClassifier::Options options;              // Window and release unused per chunk
+        std::vector<std::string_view> chunks;
+        std::vector<LineTally> tallies;               // Per chunk, scanned from the code state
+        std::vector<LineClassifier::ScanState> ends;  // State each chunk ended in
+        std::atomic<size_t> next{0};                  // First chunk nobody claimed yet
+        size_t finished = 0;                          // Guarded by mutex
+        std::mutex mutex;
+        std::condition_variable all_done;
+
+        // Claim and scan one chunk, false when none is left (late tasks return at once)
+        bool run_one() {
+            size_t i = next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= chunks.size()) return false;
+
+            LineClassifier::ScanState state;
+            tallies[i] = LineClassifier::classify(chunks[i], syntax, state, options);
+            ends[i] = state;
+            if (release) release(chunks[i].data(), chunks[i].size());
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++finished == chunks.size()) all_done.notify_all();
+            return true;
+        }
+    };
+
+    // Pieces of about chunk bytes, each ending right after a newline (the last one excepted)
+    std::vector<std::string_view> split(std::string_view text, size_t chunk) {
+        std::vector<std::string_view> chunks;
+        while (text.size() > chunk) {
+            size_t cut = text.find('\n', chunk - 1);
+            if (cut == std::string_view::npos || cut + 1 >= text.size()) break;
+            chunks.push_back(text.substr(0, cut + 1));
+            text.remove_prefix(cut + 1);
+        }
+        chunks.push_back(text);
+        return chunks;
+    }
+}
+
+namespace ChunkedScan {
+    void attach(ThreadSafeQueue& queue) {
+        pool = &queue;
+    }
+
+    bool applies(size_t size) {
+        return pool && size >= FileIo::options().split_limit;
+    }
+
+    LineTally classify(std::string_view text, const CommentSyntax* syntax, const LineClassifier::Options& options) {
+        auto job = std::make_shared<Job>();  // Shared with tasks that may run after we return
+        job->syntax = syntax;
+        job->release = options.release;
+        job->options = options;
+        job->chunks = split(text, FileIo::options().chunk);
+        job->tallies.resize(job->chunks.size());
+        job->ends.resize(job->chunks.size());
+
+        for (size_t i = 1; i < job->chunks.size(); ++i) {
+            pool->push_task([job] { job->run_one(); });
+        }
+        while (job->run_one()) {}  // The owner scans too, then waits for chunks others claimed
+        {
+            std::unique_lock<std::mutex> lock(job->mutex);
+            job->all_done.wait(lock, [&job] { return job->finished == job->chunks.size(); });
+        }
+
+        LineTally total;
+        LineClassifier::ScanState state;  // State at the start of chunk i
+        for (size_t i = 0; i < job->chunks.size(); ++i) {
+            if (state == LineClassifier::ScanState{}) {  // Guess held: take the parallel result
+                total += job->tallies[i];
+                state = job->ends[i];
+            } else {
+                total += LineClassifier::classify(job->chunks[i], syntax, state, options);  // Rescan from the real state
+            }
+        }
+        return total;
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "line_classifier.hpp"
+
+class ThreadSafeQueue;
+
+// Line classification of one very large file spread over the worker pool. The text is cut right
+// after newlines into chunks that idle workers scan as tasks, each assuming it starts in code;
+// a chunk whose predecessor ended elsewhere (inside a block comment or a string) is rescanned
+// from the right state when the results are combined, so splitting never changes the tally
+namespace ChunkedScan {
+    void attach(ThreadSafeQueue& pool);  // Queue whose workers run chunk tasks, before they start
+    bool applies(size_t size);           // A pool is attached and size reaches the split limit
+
+    // A release callback gets each chunk back once it was scanned (windowed mappings); the window is not used
+    LineTally classify(std::string_view text, const CommentSyntax* syntax, const LineClassifier::Options& options);
+}
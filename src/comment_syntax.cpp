@@ -0,0 +1,111 @@
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+
+#include "comment_syntax.hpp"
+
+namespace {
+    // Comment families shared by many languages
+    constexpr CommentSyntax C_STYLE{.line = {"//"}, .block_open = "/*", .block_close = "*/", .quotes = "\"'"};
+    constexpr CommentSyntax C_TEMPLATES{.line = {"//"}, .block_open = "/*", .block_close = "*/",
+        .quotes = "\"'`", .multiline_quotes = "`"};  // JavaScript/Go raw and template strings
+    constexpr CommentSyntax C_NESTED{.line = {"//"}, .block_open = "/*", .block_close = "*/", .nested = true,
+        .quotes = "\""};  // No ' quotes: Rust lifetimes and Scala symbols would open strings
+    constexpr CommentSyntax CSS{.block_open = "/*", .block_close = "*/", .quotes = "\"'"};
+    constexpr CommentSyntax HASH{.line = {"#"}, .quotes = "\"'"};
+    constexpr CommentSyntax HASH_C_STYLE{.line = {"#", "//"}, .block_open = "/*", .block_close = "*/", .quotes = "\"'"};
+    constexpr CommentSyntax PYTHON{.line = {"#"}, .quotes = "\"'", .doc_strings = true};
+    constexpr CommentSyntax CMAKE{.line = {"#"}, .block_open = "#[[", .block_close = "]]", .quotes = "\""};
+    constexpr CommentSyntax JULIA{.line = {"#"}, .block_open = "#=", .block_close = "=#", .nested = true, .quotes = "\""};
+    constexpr CommentSyntax POWERSHELL{.line = {"#"}, .block_open = "<#", .block_close = "#>", .quotes = "\"'"};
+    constexpr CommentSyntax COFFEE{.line = {"#"}, .block_open = "###", .block_close = "###", .quotes = "\"'"};
+    constexpr CommentSyntax SQL{.line = {"--"}, .block_open = "/*", .block_close = "*/", .quotes = "'\""};
+    constexpr CommentSyntax DASH{.line = {"--"}, .quotes = "\""};
+    constexpr CommentSyntax LUA{.line = {"--"}, .block_open = "--[[", .block_close = "]]", .quotes = "\"'"};
+    constexpr CommentSyntax HASKELL{.line = {"--"}, .block_open = "{-", .block_close = "-}", .nested = true, .quotes = "\""};
+    constexpr CommentSyntax LEAN{.line = {"--"}, .block_open = "/-", .block_close = "-/", .nested = true, .quotes = "\""};
+    constexpr CommentSyntax ML{.block_open = "(*", .block_close = "*)", .nested = true, .quotes = "\""};
+    constexpr CommentSyntax ML_SLASHES{.line = {"//"}, .block_open = "(*", .block_close = "*)", .nested = true, .quotes = "\""};
+    constexpr CommentSyntax APPLESCRIPT{.line = {"--", "#"}, .block_open = "(*", .block_close = "*)", .nested = true, .quotes = "\""};
+    constexpr CommentSyntax MARKUP{.block_open = "<!--", .block_close = "-->"};
+    constexpr CommentSyntax LISP{.line = {";"}, .block_open = "#|", .block_close = "|#", .nested = true, .quotes = "\""};
+    constexpr CommentSyntax SEMICOLON{.line = {";"}, .quotes = "\""};
+    constexpr CommentSyntax INI{.line = {";", "#"}};
+    constexpr CommentSyntax ASSEMBLY{.line = {";", "#"}, .block_open = "/*", .block_close = "*/", .quotes = "\""};
+    constexpr CommentSyntax PERCENT{.line = {"%"}, .quotes = "\""};
+    constexpr CommentSyntax MATLAB{.line = {"%"}, .block_open = "%{", .block_close = "%}", .quotes = "\""};
+    constexpr CommentSyntax PROLOG{.line = {"%"}, .block_open = "/*", .block_close = "*/", .quotes = "\""};
+    constexpr CommentSyntax FORTRAN{.line = {"!"}, .quotes = "\"'"};
+    constexpr CommentSyntax BASIC{.line = {"'"}, .quotes = "\""};
+    constexpr CommentSyntax TEMPLATE{.block_open = "{#", .block_close = "#}"};  // Jinja, Twig
+    constexpr CommentSyntax M4{.line = {"dnl", "#"}};
+
+    // Languages of each family, by an extension key of theirs or, without a leading dot, by name
+    struct Family {
+        const CommentSyntax* syntax;
+        std::initializer_list<std::string_view> keys;
+    };
+
+    const Family families[] = {
+        {&C_STYLE, {".c", ".cpp", ".h", ".hpp", ".tcc", ".inl", ".inc", ".tpp", ".cu", ".cuh", ".java", ".cs",
+            ".groovy", ".gradle", ".proto", ".glsl", ".hlsl", ".vert", ".frag", ".wgsl", ".metal", ".fx", ".shader",
+            ".cginc", ".usf", ".ush", ".scss", ".less", ".d", ".zig", ".v", ".sv", ".svh", ".jsonc", ".json5",
+            ".hjson", ".vala", ".hx", ".ceylon", ".ino", ".pde", ".y", ".odin", ".jai", ".gleam", ".prisma",
+            ".thrift", "Objective-C", "Jenkinsfile"}},
+        {&C_TEMPLATES, {".js", ".mjs", ".cjs", ".jsx", ".ts", ".tsx", ".go"}},
+        {&C_NESTED, {".rs", ".swift", ".kt", ".kts", ".scala", ".sc", ".dart", ".re", ".rei", ".res"}},
+        {&CSS, {".css"}},
+        {&HASH, {".sh", ".bash", ".zsh", ".ksh", ".fish", ".pl", ".pm", ".rb", ".rake", ".gemspec", ".podspec", ".r",
+            ".yaml", ".yml", ".toml", ".mk", ".tcl", ".awk", ".ex", ".exs", ".nim", ".cr", ".properties", ".bzl",
+            ".dockerfile", ".cfg", ".conf", ".graphql", ".gd", ".am", ".in", "Ruby Gemfile", "Rakefile", "Meson"}},
+        {&HASH_C_STYLE, {".php", ".tf", ".hcl", ".jsonnet"}},
+        {&PYTHON, {".py", ".pyw", ".pyi", ".pyx", ".mojo"}},
+        {&CMAKE, {".cmake"}},
+        {&JULIA, {".jl"}},
+        {&POWERSHELL, {".ps1"}},
+        {&COFFEE, {".coffee"}},
+        {&SQL, {".sql"}},
+        {&DASH, {".vhd", ".ada"}},
+        {&LUA, {".lua"}},
+        {&HASKELL, {".hs", ".elm", ".purs", ".idr", ".agda"}},
+        {&LEAN, {".lean"}},
+        {&ML, {".ml", ".mli", ".mly", ".mll"}},
+        {&ML_SLASHES, {".fs", ".fsx", ".fsi", ".pas"}},
+        {&APPLESCRIPT, {".applescript"}},
+        {&MARKUP, {".html", ".xml", ".xhtml", ".svg", ".vue", ".md"}},
+        {&LISP, {".lisp", ".cl", ".el", ".scm", ".rkt"}},
+        {&SEMICOLON, {".clj", ".cljs", ".cljc", ".edn", ".nasm"}},
+        {&INI, {".ini"}},
+        {&ASSEMBLY, {".s", ".asm"}},
+        {&PERCENT, {".tex", ".sty", ".erl", ".hrl"}},
+        {&MATLAB, {".m"}},
+        {&PROLOG, {"Prolog"}},
+        {&FORTRAN, {".f", ".f90", ".f95", ".for"}},
+        {&BASIC, {".vb", ".vbs"}},
+        {&TEMPLATE, {".jinja", ".j2", ".twig"}},
+        {&M4, {".m4", ".ac"}},
+    };
+
+    LanguageId language_of(std::string_view key) {
+        if (key.front() != '.') return LanguageMap::intern(key);
+        const LanguageInfo* info = LanguageMap::find_extension(key);
+        return info ? info->language : LanguageMap::OTHER;
+    }
+
+    // Syntax per LanguageId, resolved from the families once
+    std::unique_ptr<const CommentSyntax*[]> build_index() {
+        std::unique_ptr<const CommentSyntax*[]> index(new const CommentSyntax*[LanguageMap::capacity()]());
+        for (const Family& family : families) {
+            for (std::string_view key : family.keys) {
+                LanguageId language = language_of(key);
+                if (language != LanguageMap::OTHER) index[language] = family.syntax;
+            }
+        }
+        return index;
+    }
+}
+
+const CommentSyntax* CommentSyntax::of(LanguageId language) {
+    static const std::unique_ptr<const CommentSyntax*[]> index = build_index();
+    return language < LanguageMap::capacity() ? index[language] : nullptr;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string_view>
+
+#include "../modules/file_extension_to_language_map.hpp"
+
+// How one language writes comments and the string literals that can hide comment markers
+struct CommentSyntax {
+    std::string_view line[2]{};       // Line comment markers ("//", "#"), empty when unused
+    std::string_view block_open{};    // Block comment markers ("/*", "*/"), empty when unused
+    std::string_view block_close{};
+    bool nested = false;              // Block comments nest (Rust, Haskell, OCaml...)
+    std::string_view quotes{};        // String delimiters; quoted text is code
+    std::string_view multiline_quotes{};  // Subset of quotes whose strings may span lines (`)
+    bool doc_strings = false;         // Python: triple-quoted strings span lines, one opening a line is a comment
+
+    // Syntax of a language, null for languages without comments (Text, JSON) or unknown ones
+    static const CommentSyntax* of(LanguageId language);
+};
@@ -0,0 +1,41 @@
+#include <cstring>  // For memcpy
+
+#include "content_hash.hpp"
+
+namespace {
+    constexpr uint64_t SECRET[4] = {0xa0761d6478bd642fULL, 0xe7037ed1a0b428dbULL,
+                                    0x8ebc6af09c88c6e3ULL, 0x589965cc75374cc3ULL};
+
+    inline uint64_t read64(const char* p) {
+        uint64_t value;
+        std::memcpy(&value, p, 8);
+        return value;
+    }
+
+    // Both halves of the full product folded together
+    inline uint64_t mum(uint64_t a, uint64_t b) {
+        __uint128_t product = static_cast<__uint128_t>(a) * b;
+        return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+    }
+}
+
+namespace ContentHash {
+    Digest hash(std::string_view data) {
+        const char* p = data.data();
+        size_t left = data.size();
+        uint64_t a = SECRET[0] ^ data.size();
+        uint64_t b = SECRET[1] ^ (static_cast<uint64_t>(data.size()) << 32);
+
+        for (; left >= 32; p += 32, left -= 32) {  // The chains do not depend on each other
+            a = mum(read64(p) ^ SECRET[2], read64(p + 8) ^ a);
+            b = mum(read64(p + 16) ^ SECRET[3], read64(p + 24) ^ b);
+        }
+        if (left) {  // Zero-padded tail; the length seeded above tells paddings apart
+            char tail[32] = {};
+            std::memcpy(tail, p, left);
+            a = mum(read64(tail) ^ SECRET[2], read64(tail + 8) ^ a);
+            b = mum(read64(tail + 16) ^ SECRET[3], read64(tail + 24) ^ b);
+        }
+        return {mum(a ^ SECRET[0], b ^ SECRET[3]), mum(b ^ SECRET[1], a ^ SECRET[2])};
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+// 128-bit non-cryptographic digest of file contents, for telling identical files apart
+struct Digest {
+    uint64_t low = 0;
+    uint64_t high = 0;
+
+    bool operator==(const Digest&) const = default;
+};
+
+// Multiply-fold hashing in the wyhash/xxh3 family: two independent 64x64->128 bit multiply
+// chains consume 32 bytes per step, so the loop runs at several bytes per cycle
+namespace ContentHash {
+    Digest hash(std::string_view data);
+}
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "content_sniffer.hpp"
+#include "byte_count.hpp"
+#include "file_io.hpp"
+#include "text_format.hpp"
+#include "output_formatter.hpp"
+
+namespace {
+    bool sniffing = true;
+
+    constexpr size_t MIN_MINIFIED = 2048;  // Shorter heads never look minified
+    constexpr size_t LONG_LINE = 500;      // Average line length of a minified head, in bytes
+    constexpr size_t MARKER_LINES = 8;     // Generator banners sit in the first lines
+
+    // Signatures of formats that can carry a source extension by accident or by design. Most also
+    // hold a NUL early on; PE's "MZ" and bzip2's "BZh" are left to that check, they read like words
+    constexpr std::string_view MAGIC[] = {
+        "\x7f" "ELF",                // ELF objects and executables
+        "\xcf\xfa\xed\xfe",          // Mach-O 64-bit
+        "\xca\xfe\xba\xbe",          // Mach-O universal, Java class
+        "\x89" "PNG",
+        "GIF8",
+        "\xff\xd8\xff",              // JPEG
+        "%PDF-",
+        "PK\x03\x04",                // Zip, jar, docx
+        "\x1f\x8b",                  // gzip
+        "\x28\xb5\x2f\xfd",          // zstd
+        "\xfd" "7zXZ",               // xz
+        "!<arch>\n",                 // ar archives, static libraries
+    };
+
+    // Banners code generators put at the top of their output
+    constexpr std::string_view MARKERS[] = {
+        "@generated",
+        "DO NOT EDIT",
+        "Code generated by",
+        "<auto-generated",
+        "Autogenerated by",
+        "autogenerated by",
+        "Generated by the protocol buffer compiler",
+    };
+
+    struct KindCounters {
+        std::atomic<size_t> files{0};
+        std::atomic<size_t> bytes{0};
+    };
+    KindCounters counters[4];  // Indexed by ContentKind
+
+    bool is_generated(std::string_view head) {
+        size_t end = 0;
+        for (size_t line = 0; line < MARKER_LINES && end < head.size(); ++line) {
+            size_t newline = head.find('\n', end);
+            end = newline == std::string_view::npos ? head.size() : newline + 1;
+        }
+        std::string_view top = head.substr(0, end);
+        for (std::string_view marker : MARKERS) {
+            if (top.find(marker) != std::string_view::npos) return true;
+        }
+        return false;
+    }
+}
+
+namespace ContentSniffer {
+    void configure(bool enabled) {
+        sniffing = enabled;
+    }
+
+    bool enabled() {
+        return sniffing;
+    }
+
+    ContentKind sniff(std::string_view head, size_t size) {
+        head = head.substr(0, FileBuffer::HEAD);
+        for (std::string_view magic : MAGIC) {
+            if (head.substr(0, magic.size()) == magic) return ContentKind::Binary;
+        }
+        if (TextFormat::detect(head).width() != 1) return ContentKind::Source;  // UTF-16/32: NULs are expected
+        if (std::memchr(head.data(), '\0', head.size())) return ContentKind::Binary;
+        if (is_generated(head)) return ContentKind::Generated;
+
+        // One 30 MB line or a few very long ones: judged on the head when the file goes on past it
+        if (head.size() >= MIN_MINIFIED && size > head.size()) {
+            size_t lines = std::max(ByteCount::count(head.data(), head.size(), '\n'),
+                                    ByteCount::count(head.data(), head.size(), '\r')) + 1;  // LF, CRLF or CR-only
+            if (head.size() / lines >= LONG_LINE) return ContentKind::Minified;
+        }
+        return ContentKind::Source;
+    }
+
+    void record(ContentKind kind, size_t size) {
+        auto& counter = counters[static_cast<size_t>(kind)];
+        counter.files.fetch_add(1, std::memory_order_relaxed);
+        counter.bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    std::vector<std::pair<std::string, std::string>> report() {
+        constexpr const char* names[] = {"", "binary", "minified", "generated"};
+        std::vector<std::pair<std::string, std::string>> items;
+        for (size_t i = 1; i < 4; ++i) {
+            size_t files = counters[i].files.load(std::memory_order_relaxed);
+            if (files == 0) continue;
+            size_t bytes = counters[i].bytes.load(std::memory_order_relaxed);
+            items.emplace_back(names[i], OutputFormatter::format_large_number(files) + " files, "
+                + OutputFormatter::format_large_number(bytes / 1024) + " KiB");
+        }
+        return items;
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// What a file with a source extension really holds, judged from its first bytes only
+enum class ContentKind : uint8_t { Source, Binary, Minified, Generated };
+
+// Cheap verdict on the head of a file: NUL bytes and well-known magic numbers mean binary, very
+// long lines mean minified, tool markers near the top mean generated. Files judged anything but
+// Source are left unread past their head and reported apart instead of being counted
+namespace ContentSniffer {
+    void configure(bool enabled);  // Before any worker starts; disabled: everything is Source
+    bool enabled();
+
+    ContentKind sniff(std::string_view head, size_t size);  // First FileBuffer::HEAD bytes count; size of the whole file
+    void record(ContentKind kind, size_t size);             // A file skipped for its kind
+
+    // Files and bytes skipped per kind, empty when nothing was skipped
+    std::vector<std::pair<std::string, std::string>> report();
+}
@@ -0,0 +1,67 @@
+#include <dirent.h>        // For DT_* constants
+#include <fcntl.h>         // For AT_SYMLINK_NOFOLLOW
+#include <sys/stat.h>      // For fstatat
+#include <sys/syscall.h>   // For SYS_getdents64
+#include <unistd.h>        // For syscall
+
+#include "dir_scanner.hpp"
+
+namespace {
+    constexpr size_t BUFFER_SIZE = 64 * 1024;  // Enough for ~2000 entries per syscall
+
+    struct linux_dirent64 {  // Kernel record layout (not exported by glibc headers)
+        uint64_t d_ino;
+        int64_t d_off;
+        unsigned short d_reclen;
+        unsigned char d_type;
+        char d_name[];
+    };
+
+    EntryType from_mode(mode_t mode) {  // Map stat mode to entry type
+        if (S_ISDIR(mode)) return EntryType::Directory;
+        if (S_ISREG(mode)) return EntryType::Regular;
+        if (S_ISLNK(mode)) return EntryType::Symlink;
+        return EntryType::Other;
+    }
+}
+
+DirScanner::DirScanner() : buffer(BUFFER_SIZE) {}
+
+void DirScanner::reset(int dir_fd) {
+    fd = dir_fd;
+    offset = 0;
+    filled = 0;
+}
+
+bool DirScanner::next(DirEntry& entry) {
+    while (true) {
+        if (offset >= filled) {  // Refill from the kernel
+            long n = syscall(SYS_getdents64, fd, buffer.data(), buffer.size());
+            if (n <= 0) return false;  // End of directory or error
+            filled = static_cast<size_t>(n);
+            offset = 0;
+        }
+
+        auto* record = reinterpret_cast<const linux_dirent64*>(buffer.data() + offset);
+        offset += record->d_reclen;
+
+        std::string_view name(record->d_name);
+        if (name == "." || name == "..") continue;
+
+        entry.name = name;
+        entry.inode = record->d_ino;
+        switch (record->d_type) {
+            case DT_DIR: entry.type = EntryType::Directory; break;
+            case DT_REG: entry.type = EntryType::Regular; break;
+            case DT_LNK: entry.type = EntryType::Symlink; break;
+            case DT_UNKNOWN: {  // Filesystem without d_type support: the only case that stats
+                struct stat st;
+                if (fstatat(fd, record->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) continue;
+                entry.type = from_mode(st.st_mode);
+                break;
+            }
+            default: entry.type = EntryType::Other; break;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Entry kinds reported by the scanner
+enum class EntryType : uint8_t { Directory, Regular, Symlink, Other };
+
+struct DirEntry {
+    std::string_view name;  // Points into the scanner buffer, valid until the next call
+    EntryType type;         // Resolved from d_type, fstatat only for DT_UNKNOWN
+    uint64_t inode;         // d_ino from the kernel record
+};
+
+// Linux-native directory reader: raw getdents64 batches, no per-entry stat
+class DirScanner {
+private:
+    std::vector<char> buffer;  // getdents64 record buffer, reused across directories
+    int fd = -1;               // Directory being scanned
+    size_t offset = 0;         // Read position inside buffer
+    size_t filled = 0;         // Bytes returned by the last getdents64 call
+
+public:
+    DirScanner();
+    void reset(int dir_fd);     // Start scanning a new directory (fd stays owned by caller)
+    bool next(DirEntry& entry); // Next entry except "." and "..", false at end or on error
+};
@@ -0,0 +1,220 @@
+#include <thread>
+#include <fcntl.h>     // For open/openat and O_* flags
+#include <sys/stat.h>  // For fstatat on symlinks
+#include <unistd.h>    // For close
+
+#include "directory_walker.hpp"
+#include "file_utils.hpp"
+#include "language_detector.hpp"
+#include "path_arena.hpp"
+
+DirectoryWalker::DirectoryWalker(ThreadSafeQueue& file_queue, std::atomic<size_t>& total_files,
+    const TraversalOptions& options, unsigned int num_threads)
+    : file_queue(file_queue), total_files(total_files), options(options),
+      deques(num_threads == 0 ? 1 : num_threads) {}
+
+void DirectoryWalker::walk(const fs::path& root) {
+    const std::string& root_path = root.native();
+    root_length = root_path.size() + (!root_path.empty() && root_path.back() == '/' ? 0 : 1);
+
+    struct stat root_st;  // Device the walk may not leave with --one-file-system
+    root_dev = stat(root_path.c_str(), &root_st) == 0 ? root_st.st_dev : 0;
+
+    std::shared_ptr<const IgnoreScope> ignore;  // Global excludes sit below every .gitignore
+    if (options.respect_ignore_files) ignore = IgnoreScope::load_global(root);
+
+    std::shared_ptr<const AttributeScope> attributes;  // .git/info/attributes: chain root, highest precedence
+    if (options.respect_git_attributes) attributes = AttributeScope::load_global(root);
+
+    push_dir({nullptr, PathArena::store(root_path), std::move(ignore), std::move(attributes)}, 0);  // Others start by stealing
+
+    std::vector<std::thread> threads;  // Walker threads
+    threads.reserve(deques.size() - 1);
+    for (size_t i = 1; i < deques.size(); ++i) {
+        threads.emplace_back(&DirectoryWalker::worker, this, i);
+    }
+    worker(0);  // Calling thread takes part in the walk
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void DirectoryWalker::push_dir(PendingDir dir, size_t index) {
+    pending.fetch_add(1);  // Count before publishing so pending never drops to zero early
+    {
+        std::lock_guard<std::mutex> lock(deques[index].mutex);
+        deques[index].dirs.push_back(std::move(dir));
+    }
+    queued.fetch_add(1);
+
+    if (sleepers.load() > 0) {  // Wake an idle walker only when someone is actually waiting
+        { std::lock_guard<std::mutex> lock(idle_mutex); }
+        idle_cond.notify_one();
+    }
+}
+
+bool DirectoryWalker::take_dir(size_t index, PendingDir& dir) {
+    {
+        auto& own = deques[index];  // Own deque first, newest directory (depth-first)
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.dirs.empty()) {
+            dir = std::move(own.dirs.back());
+            own.dirs.pop_back();
+            queued.fetch_sub(1);
+            return true;
+        }
+    }
+
+    for (size_t i = 1; i < deques.size(); ++i) {  // Steal oldest (largest subtree) from victims
+        auto& victim = deques[(index + i) % deques.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.dirs.empty()) {
+            dir = std::move(victim.dirs.front());
+            victim.dirs.pop_front();
+            queued.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void DirectoryWalker::worker(size_t index) {
+    PendingDir dir;      // Directory currently being expanded
+    DirScanner scanner;  // Per-thread getdents64 buffer
+    while (true) {
+        if (take_dir(index, dir)) {
+            expand(dir, scanner, index);
+            if (pending.fetch_sub(1) == 1) {  // Last directory finished: release everyone
+                { std::lock_guard<std::mutex> lock(idle_mutex); }
+                idle_cond.notify_all();
+                return;
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(idle_mutex);
+        sleepers.fetch_add(1);
+        idle_cond.wait(lock, [this] { return queued.load() > 0 || pending.load() == 0; });
+        sleepers.fetch_sub(1);
+        if (pending.load() == 0) return;  // Walk complete
+    }
+}
+
+void DirectoryWalker::expand(const PendingDir& dir, DirScanner& scanner, size_t index) {
+    const DirHandle* parent = dir.parent;
+    thread_local std::string dir_path;  // Full path, rebuilt from parent links without allocating
+    dir_path.clear();
+    if (parent) {
+        parent->append_path(dir_path);
+        if (!dir_path.empty() && dir_path.back() != '/') dir_path += '/';
+    }
+    dir_path += dir.name;
+
+    int flags = O_RDONLY | O_DIRECTORY | O_CLOEXEC | (dir.via_symlink ? 0 : O_NOFOLLOW);
+    int fd = parent && parent->fd != -1
+        ? openat(parent->fd, dir.name.data(), flags)
+        : open(dir_path.c_str(), flags & ~O_NOFOLLOW);
+    if (parent) parent->release();  // Parent fd no longer needed by this child
+    if (fd == -1) return;           // Unreadable directory
+
+    // Each (dev, inode) is expanded once: stops symlink cycles, bind mounts and repeated trees
+    struct stat dir_st;
+    if (fstat(fd, &dir_st) == -1
+        || (options.one_file_system && static_cast<uint64_t>(dir_st.st_dev) != root_dev)
+        || !visited.insert(dir_st.st_dev, dir_st.st_ino)) {
+        close(fd);
+        return;
+    }
+
+    // Keep the fd for openat() by children only while the handle budget allows it
+    bool keep_fd = DirHandle::reserve_fd();
+    const DirHandle* handle = DirHandle::create(parent, dir.name, keep_fd ? fd : -1);
+    uint32_t handed_out = 0;  // Holds passed on to queued files and subdirectories
+
+    // Directory path relative to the root, entry paths are built next to it without allocating
+    std::string_view rel_dir = dir_path.size() > root_length
+        ? std::string_view(dir_path).substr(root_length) : std::string_view();
+    thread_local std::string rel_path;
+
+    auto ignore = dir.ignore;
+    if (options.respect_ignore_files) ignore = IgnoreScope::load(ignore, fd, rel_dir);
+    auto attributes = dir.attributes;
+    if (options.respect_git_attributes) attributes = AttributeScope::load(attributes, fd, rel_dir);
+
+    auto entry_path = [&](std::string_view name) -> std::string_view {
+        rel_path.assign(rel_dir);
+        if (!rel_path.empty()) rel_path += '/';
+        rel_path += name;
+        return rel_path;
+    };
+
+    // Ignore rules, --exclude and vendored/generated "dir/**" attributes prune directories unopened
+    auto dir_wanted = [&](std::string_view name) {
+        if (!ignore && !options.filter && !attributes) return true;
+        std::string_view path = entry_path(name);
+        return !(ignore && ignore->is_ignored(path, name, true))
+            && !(options.filter && !options.filter->accepts_dir(path, name))
+            && !(attributes && attributes->excludes_dir(path));
+    };
+
+    LanguageDetector::Verdict verdict;  // Name-based language of the last accepted file
+    auto file_wanted = [&](std::string_view name) {
+        verdict = LanguageDetector::classify(name);
+        if (!verdict.accepted && !attributes) return false;
+        if (!ignore && !options.filter && !options.skip_files && !attributes) return true;
+
+        std::string_view path = entry_path(name);
+        if (attributes) {  // Vendored/generated files are dropped unread, overrides admit any extension
+            LinguistAttributes attrs = attributes->lookup(path, name);
+            if (attrs.vendored || attrs.generated || (!verdict.accepted && attrs.language == LanguageMap::OTHER)) return false;
+            if (attrs.language != LanguageMap::OTHER) verdict = {true, false, attrs.language};
+        }
+        return !(ignore && ignore->is_ignored(path, name, false))
+            && !(options.filter && !options.filter->accepts_file(path, name))
+            && !(options.skip_files && options.skip_files->contains(path));  // Already delivered by the git index
+    };
+
+    DirEntry entry;
+    scanner.reset(fd);
+    while (scanner.next(entry)) {
+        if (entry.type == EntryType::Directory) {
+            if (options.respect_ignore_files && entry.name == ".git") continue;  // Repository internals
+            if (!dir_wanted(entry.name)) continue;
+            push_dir({handle, PathArena::store(entry.name), ignore, attributes}, index);  // May be stolen
+            ++handed_out;
+            continue;
+        }
+
+        bool regular = entry.type == EntryType::Regular;
+        uint64_t file_dev = dir_st.st_dev;  // Identity used to count each file once when following links
+        uint64_t file_ino = entry.inode;
+        if (entry.type == EntryType::Symlink) {  // Skipped unless --follow-symlinks
+            struct stat st;
+            if (!options.follow_symlinks || fstatat(fd, entry.name.data(), &st, 0) == -1) continue;
+            if (S_ISDIR(st.st_mode)) {  // Cycles are caught by the visited check when it is expanded
+                if (!dir_wanted(entry.name)) continue;
+                push_dir({handle, PathArena::store(entry.name), ignore, attributes, true}, index);
+                ++handed_out;
+                continue;
+            }
+            regular = S_ISREG(st.st_mode)
+                && !(options.one_file_system && static_cast<uint64_t>(st.st_dev) != root_dev);
+            file_dev = st.st_dev;
+            file_ino = st.st_ino;
+        }
+
+        if (regular && file_wanted(entry.name)
+            && !(options.follow_symlinks && !visited.insert(file_dev, file_ino))) {
+            SourceFile file{handle, PathArena::store(entry.name)};
+            file.language = verdict.language;
+            file.detect = verdict.needs_content;
+            file_queue.push(file);  // Hand file to consumers immediately
+            ++handed_out;
+            total_files.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (keep_fd) handle->release(DirHandle::HOLD_BIAS - handed_out);  // fd closes with the last entry
+    else close(fd);                                                     // Children fall back to full paths
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "dir_scanner.hpp"
+#include "file_utils.hpp"
+#include "git_attributes.hpp"
+#include "ignore_rules.hpp"
+#include "inode_set.hpp"
+#include "source_file.hpp"
+#include "thread_safe_queue.hpp"
+
+namespace fs = std::filesystem;
+
+// Parallel directory traversal: every thread owns a deque of pending directories,
+// expands its own work LIFO (explicit stack, no recursion) and steals FIFO from others
+class DirectoryWalker {
+private:
+    struct PendingDir {                          // Directory waiting to be opened
+        const DirHandle* parent = nullptr;       // Opened parent (null for the root), holds one hold on it
+        std::string_view name;                   // Arena name inside parent, full path for the root
+        std::shared_ptr<const IgnoreScope> ignore; // Ignore rules inherited from the parent
+        std::shared_ptr<const AttributeScope> attributes; // .gitattributes rules inherited from the parent
+        bool via_symlink = false;                // Reached through a followed symlink
+    };
+
+    struct alignas(64) WorkDeque {    // Padded to keep neighbouring deques off one cache line
+        std::mutex mutex;             // Guards dirs (owner and thieves contend rarely)
+        std::deque<PendingDir> dirs;  // Pending directories, owner uses back, thieves use front
+    };
+
+    ThreadSafeQueue& file_queue;      // Consumer queue fed while the walk is still running
+    std::atomic<size_t>& total_files; // Shared counter of discovered source files
+    const TraversalOptions& options;  // Ignore/filter policy
+    size_t root_length = 0;           // Prefix length stripped to get root-relative paths
+    uint64_t root_dev = 0;            // Device of the root for --one-file-system
+    InodeSet visited;                 // Directories expanded (and files seen when following links)
+    std::vector<WorkDeque> deques;    // One deque per walker thread
+
+    std::atomic<size_t> queued{0};    // Directories sitting in deques
+    std::atomic<size_t> pending{0};   // Directories queued or currently being expanded
+    std::atomic<size_t> sleepers{0};  // Walker threads waiting for work
+    std::mutex idle_mutex;            // Mutex for idle_cond
+    std::condition_variable idle_cond;// Wakes idle walkers on new work or completion
+
+    void worker(size_t index);                      // Walker thread main loop
+    void expand(const PendingDir& dir, DirScanner& scanner, size_t index); // List one directory
+    void push_dir(PendingDir dir, size_t index);    // Queue directory on own deque
+    bool take_dir(size_t index, PendingDir& dir);   // Pop own work or steal from others
+
+public:
+    DirectoryWalker(ThreadSafeQueue& file_queue, std::atomic<size_t>& total_files,
+        const TraversalOptions& options, unsigned int num_threads);
+    void walk(const fs::path& root);  // Traverse whole tree, returns when every directory is expanded
+};
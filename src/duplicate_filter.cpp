@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <fcntl.h>       // For open
+#include <sys/mman.h>    // For mmap
+#include <sys/stat.h>    // For fstat
+#include <unistd.h>      // For close
+
+#include "duplicate_filter.hpp"
+#include "line_classifier.hpp"
+#include "output_formatter.hpp"
+
+namespace {
+    // Digest of a file other than the one being processed. Opened by path: its directory may have
+    // closed its fd already. Mapped rather than read through FileBuffer, whose per-thread pread
+    // buffer may hold the current file
+    bool hash_file(const SourceFile& file, uint64_t size, Digest& digest) {
+        int fd = open(file.c_path(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) return false;
+        struct stat st;
+        void* mapped = fstat(fd, &st) == 0 && static_cast<uint64_t>(st.st_size) == size
+            ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        close(fd);
+        if (mapped == MAP_FAILED) return false;
+        digest = ContentHash::hash({static_cast<const char*>(mapped), size});
+        munmap(mapped, size);
+        return true;
+    }
+
+    std::string describe(size_t files, size_t bytes, size_t lines) {
+        return OutputFormatter::format_large_number(files) + " files, " + OutputFormatter::format_large_number(bytes / 1024)
+            + " KiB, " + OutputFormatter::format_large_number(lines) + " lines";
+    }
+}
+
+bool DuplicateFilter::is_duplicate(const FileView& file, size_t worker) {
+    std::string_view bytes = file.bytes();
+    uint64_t size = bytes.size();
+    if (size == 0) return false;  // Empty or unreadable: nothing to waste
+    Shard& shard = shards[(size * 0x9e3779b97f4a7c15ULL >> 32) % SHARD_COUNT];
+
+    bool member = file.file.entry != nullptr;  // Archive members cannot be read again: hashed on first sight
+    Digest digest{};
+    if (member) digest = ContentHash::hash(bytes);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.sizes.try_emplace(size, FirstOfSize{file.file, member ? State::Hashed : State::Unhashed}).second) {  // Unique size so far
+            if (member) shard.digests.insert({size, digest});
+            return false;
+        }
+    }
+
+    if (!member) digest = ContentHash::hash(bytes);  // Bytes already in memory, outside the lock
+    bool duplicate;
+    {
+        std::unique_lock<std::mutex> lock(shard.mutex);
+        FirstOfSize& first = shard.sizes[size];  // Node references survive rehashing
+        if (first.state == State::Unhashed) {  // Second file of this size: the first one is hashed now
+            first.state = State::Hashing;  // Files of this size wait for it, other sizes in the shard go on
+            SourceFile handle = first.file;
+            lock.unlock();
+            Digest first_digest;
+            bool hashed = hash_file(handle, size, first_digest);
+            lock.lock();
+            if (hashed) shard.digests.insert({size, first_digest});
+            first.state = State::Hashed;
+            shard.hashed.notify_all();
+        } else {  // Nobody checks against the set before the first digest is in
+            shard.hashed.wait(lock, [&first] { return first.state != State::Hashing; });
+        }
+        duplicate = !shard.digests.insert({size, digest}).second;
+    }
+
+    if (duplicate) {
+        Waste& dir = waste[worker][file.file.dir];
+        ++dir.files;
+        dir.bytes += size;
+        dir.lines += LineClassifier::classify(bytes, file.format(), nullptr).lines();  // CR, CRLF and UTF-16/32 as in the line pass
+    }
+    return duplicate;
+}
+
+void DuplicateFilter::merge() {
+    std::unordered_map<const DirHandle*, Waste> merged;
+    for (size_t worker = 0; worker < waste.size(); ++worker) {
+        for (const auto& [dir, counts] : waste[worker]) {
+            Waste& sum = merged[dir];
+            sum.files += counts.files;
+            sum.bytes += counts.bytes;
+            sum.lines += counts.lines;
+        }
+    }
+    by_directory.clear();
+    total = {};
+    for (const auto& [dir, counts] : merged) {
+        by_directory.emplace_back(dir->path().string(), counts);
+        total.files += counts.files;
+        total.bytes += counts.bytes;
+        total.lines += counts.lines;
+    }
+    std::sort(by_directory.begin(), by_directory.end(), [](const auto& a, const auto& b) {
+        return a.second.bytes != b.second.bytes ? a.second.bytes > b.second.bytes : a.first < b.first;
+    });
+}
+
+std::vector<std::pair<std::string, std::string>> DuplicateFilter::report(size_t directories) const {
+    std::vector<std::pair<std::string, std::string>> items;
+    if (total.files == 0) return items;
+    items.emplace_back("total", describe(total.files, total.bytes, total.lines));
+    for (size_t i = 0; i < by_directory.size() && i < directories; ++i) {
+        const auto& [path, counts] = by_directory[i];
+        items.emplace_back(path, describe(counts.files, counts.bytes, counts.lines));
+    }
+    return items;
+}
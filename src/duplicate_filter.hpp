@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "content_hash.hpp"
+#include "file_view.hpp"
+#include "sharded.hpp"
+
+// Byte-identical files found while the workers run. A file is only hashed once another file
+// of the same size shows up: the first file of each size is remembered unhashed and hashed
+// (re-read, outside the shard lock) only then, so files with unique sizes never pay for a digest.
+// Later copies are reported with the bytes and lines they add, per directory, and are skipped by the modules.
+// The copy that is counted is whichever a worker reaches first: totals do not change between runs, but
+// which directory a copy is reported under, and the language of copies with different names, can
+class DuplicateFilter {
+private:
+    struct Key {
+        uint64_t size;
+        Digest digest;
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const { return static_cast<size_t>(key.digest.low ^ key.size); }
+    };
+
+    enum class State : uint8_t { Unhashed, Hashing, Hashed };  // Hashed: its digest is in the digests set
+
+    struct FirstOfSize {
+        SourceFile file;  // Arena-owned handle, reopened by path
+        State state = State::Unhashed;
+    };
+
+    static constexpr size_t SHARD_COUNT = 64;
+
+    struct alignas(64) Shard {  // Picked by size, padded against false sharing between shards
+        std::mutex mutex;
+        std::condition_variable hashed;  // A first file's digest was published
+        std::unordered_map<uint64_t, FirstOfSize> sizes;
+        std::unordered_set<Key, KeyHash> digests;
+    };
+
+    struct Waste {
+        size_t files = 0;
+        size_t bytes = 0;
+        size_t lines = 0;  // Newlines in the copies
+    };
+
+    std::array<Shard, SHARD_COUNT> shards;
+    Sharded<std::unordered_map<const DirHandle*, Waste>> waste;  // Per worker, by directory of the copy
+    std::vector<std::pair<std::string, Waste>> by_directory;     // Merged, most bytes first
+    Waste total;
+
+public:
+    void prepare(size_t workers) { waste.resize(workers); }  // Before the workers start
+    bool is_duplicate(const FileView& file, size_t worker);  // True when an identical file came earlier
+    void merge();                                            // After the workers joined
+
+    // Total and the directories wasting most bytes, empty when no duplicate was found
+    std::vector<std::pair<std::string, std::string>> report(size_t directories) const;
+};
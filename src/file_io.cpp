@@ -0,0 +1,122 @@
+#include <atomic>
+#include <memory>
+#include <sys/mman.h>    // For mmap/madvise
+#include <sys/stat.h>    // For fstat
+#include <unistd.h>      // For pread, sysconf
+
+#include "file_io.hpp"
+#include "output_formatter.hpp"
+
+namespace {
+    IoOptions io_options;
+
+    constexpr size_t HUGE_PAGE = 2 * 1024 * 1024;  // Below this a hugepage hint cannot apply
+
+    struct StrategyCounters {
+        std::atomic<size_t> files{0};
+        std::atomic<size_t> bytes{0};
+    };
+    StrategyCounters counters[5];  // Indexed by IoStrategy
+
+    void record(IoStrategy strategy, size_t bytes) {
+        auto& counter = counters[static_cast<size_t>(strategy)];
+        counter.files.fetch_add(1, std::memory_order_relaxed);
+        counter.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    // Reused by every small file this worker reads; a view never outlives the next load
+    char* read_buffer() {
+        thread_local std::unique_ptr<char[]> buffer(new char[io_options.pread_limit]);
+        return buffer.get();
+    }
+
+    size_t page_size() {
+        static const size_t size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        return size;
+    }
+}
+
+FileBuffer::~FileBuffer() {
+    if (used == IoStrategy::Mmap || used == IoStrategy::Window) munmap(const_cast<char*>(data), length);
+}
+
+bool FileBuffer::load(int fd, const HeadCheck& check) {
+    struct stat st;
+    if (fstat(fd, &st) == -1 || st.st_size <= 0) return false;  // Empty files are never read
+    size_t size = static_cast<size_t>(st.st_size);
+
+    if (size <= io_options.pread_limit) {
+        char* buffer = read_buffer();
+        size_t done = 0;
+        while (done < size) {  // Short reads only end at EOF or on error
+            ssize_t n = pread(fd, buffer + done, size - done, static_cast<off_t>(done));
+            if (n <= 0) break;
+            done += static_cast<size_t>(n);
+        }
+        if (check && !check({buffer, done}, size)) return false;  // Already read: nothing left to save
+        data = buffer;
+        length = done;
+        used = IoStrategy::Pread;
+        record(used, length);
+        return true;
+    }
+
+    if (check) {  // A rejected file costs one small read instead of a mapping
+        char head[HEAD];
+        ssize_t n = pread(fd, head, sizeof head, 0);
+        if (n > 0 && !check({head, static_cast<size_t>(n)}, size)) return false;
+    }
+
+    bool windowed = size >= io_options.window_limit;
+    bool split = size >= io_options.split_limit;  // Chunk scans fault their own pages in parallel
+    int flags = MAP_PRIVATE | (windowed || split ? 0 : MAP_POPULATE);  // Prefault now instead of one fault per page
+    void* mapped = mmap(nullptr, size, PROT_READ, flags, fd, 0);
+    if (mapped == MAP_FAILED) return false;
+
+    madvise(mapped, size, MADV_SEQUENTIAL);  // Aggressive readahead, pages behind are cheap to reclaim
+#ifdef MADV_HUGEPAGE
+    if (size >= HUGE_PAGE) madvise(mapped, size, MADV_HUGEPAGE);  // Honored where file THP is enabled
+#endif
+    data = static_cast<const char*>(mapped);
+    length = size;
+    used = windowed ? IoStrategy::Window : IoStrategy::Mmap;
+    record(used, length);
+    return true;
+}
+
+void FileBuffer::hold(std::string_view bytes, std::unique_ptr<char[]> owner) {
+    data = bytes.data();
+    length = bytes.size();
+    owned = std::move(owner);
+    used = IoStrategy::Archive;
+    record(used, length);
+}
+
+namespace FileIo {
+    void configure(const IoOptions& options) {
+        io_options = options;
+    }
+
+    const IoOptions& options() {
+        return io_options;
+    }
+
+    void release(const char* begin, size_t length) {
+        size_t page = page_size();
+        uintptr_t first = (reinterpret_cast<uintptr_t>(begin) + page - 1) & ~(page - 1);
+        uintptr_t last = (reinterpret_cast<uintptr_t>(begin) + length) & ~(page - 1);
+        if (last > first) madvise(reinterpret_cast<void*>(first), last - first, MADV_DONTNEED);
+    }
+
+    std::vector<std::pair<std::string, std::string>> profile() {
+        constexpr const char* names[] = {"", "pread", "mmap", "window", "archive"};
+        std::vector<std::pair<std::string, std::string>> items;
+        for (size_t i = 1; i < 5; ++i) {
+            size_t files = counters[i].files.load(std::memory_order_relaxed);
+            size_t bytes = counters[i].bytes.load(std::memory_order_relaxed);
+            items.emplace_back(names[i], OutputFormatter::format_large_number(files) + " files, "
+                + OutputFormatter::format_large_number(bytes / 1024) + " KiB");
+        }
+        return items;
+    }
+}
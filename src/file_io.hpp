@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// How one file's bytes were brought into memory, chosen per file by size; Archive: member of an archive
+enum class IoStrategy : uint8_t { None, Pread, Mmap, Window, Archive };
+
+struct IoOptions {
+    size_t pread_limit = 128 * 1024;         // Up to this size: pread into a reusable per-thread buffer
+    size_t window_limit = 64 * 1024 * 1024;  // From this size: lazy mapping released behind a sliding window
+    size_t window = 16 * 1024 * 1024;        // Bytes a windowed scan keeps resident behind its position
+    size_t split_limit = 32 * 1024 * 1024;   // From this size: scanned in chunks by the whole worker pool
+    size_t chunk = 4 * 1024 * 1024;          // Target chunk size of a split file
+};
+
+// Sees the first bytes of a file (and its size) before the rest is read; false leaves it unread
+using HeadCheck = std::function<bool(std::string_view head, size_t size)>;
+
+// Content of one file. Small files avoid mmap/munmap (and the TLB shootdowns of concurrent
+// munmaps) entirely; mid-sized ones are mapped with MAP_POPULATE and a hugepage hint; huge
+// ones are mapped lazily and dropped page by page as a scan passes them, so RSS stays bounded
+class FileBuffer {
+public:
+    FileBuffer() = default;
+    ~FileBuffer();
+    FileBuffer(const FileBuffer&) = delete;
+    FileBuffer& operator=(const FileBuffer&) = delete;
+
+    bool load(int fd, const HeadCheck& check = nullptr);  // Read or map the whole file; the caller still owns fd
+    void hold(std::string_view bytes, std::unique_ptr<char[]> owner = nullptr);  // Bytes already in memory, kept alive by owner
+    static constexpr size_t HEAD = 4096;  // Bytes a check sees of files too large for a single pread
+    std::string_view bytes() const { return {data, length}; }
+    IoStrategy strategy() const { return used; }
+
+private:
+    const char* data = nullptr;
+    size_t length = 0;
+    IoStrategy used = IoStrategy::None;
+    std::unique_ptr<char[]> owned;  // Inflated archive member
+};
+
+namespace FileIo {
+    void configure(const IoOptions& options);  // Before any worker starts
+    const IoOptions& options();
+
+    void release(const char* begin, size_t length);  // Drop whole pages of a Window mapping inside [begin, begin+length)
+
+    // Files and bytes per strategy so far, for --profile
+    std::vector<std::pair<std::string, std::string>> profile();
+}
@@ -1,84 +1,230 @@
 #include <string>     
-#include <unordered_set> 
-#include <mutex>          // For std::once_flag
-#include <functional>     // For std::function and std::bind
-#include <algorithm>      // For std::transform
+#include <cstring>        // For memchr/memmove
+#include <cerrno>         // For EINTR
+#include <fstream>        // For reading .git files
+#include <thread>         // For std::thread::hardware_concurrency
+#include <functional>     // For std::function
+#include <algorithm>      // For std::stable_sort/find_if
+#include <vector>
+#include <fcntl.h>        // For open
+#include <unistd.h>       // For read/close
 
 #include "file_utils.hpp"
+#include "directory_walker.hpp"
+#include "git_attributes.hpp"
+#include "git_index.hpp"
+#include "language_detector.hpp"
+#include "path_arena.hpp"
 #include "../modules/file_extension_to_language_map.hpp" // Extension to language mapping
 
 namespace FileUtils {
-    // Static cache for file extensions to avoid repeated processing
-    static std::unordered_set<std::string> extension_cache;
-    // Flag to ensure thread-safe one-time initialization of the cache
-    static std::once_flag cache_flag;
-    
-    // Initializes the extension cache with values from the mapping
-    void init_cache() {
-        // Iterate through all extensions in the global mapping
-        for (const auto& [ext, _] : extension_to_language) {
-            extension_cache.insert(ext);  // Add each extension to cache
-        }
+    // Extension including the dot, empty for dotfiles and names without one
+    std::string_view extension_of(std::string_view filename) {
+        size_t dot = filename.rfind('.');
+        if (dot == std::string_view::npos || dot == 0 || filename == "..") return {};
+        return filename.substr(dot);
     }
-    
-    // Checks if a given file path points to a source code file
-    bool is_source_file(const fs::path& path) {
-        // Initialize cache exactly once (thread-safe)
-        std::call_once(cache_flag, init_cache);
-        
-        // Set of special filenames that should be treated as source files
-        static const std::unordered_set<std::string> special_files = {
-            "WORKSPACE", "BUILD.bazel", "meson.build", "CMakeLists.txt", 
-            "configure.ac", "Makefile", "LICENSE", "LICENSE.txt", "LICENSE.md",
-            "COPYING", "README.md", "README"
-        };
 
-        // Extract filename from path for special files check
-        std::string filename = path.filename().string();
-        // Check if this is one of our special files
-        if (special_files.find(filename) != special_files.end()) {
-            return true;  // Early return for special files
-        }
+    // Checks if a given file name belongs to a source code file (known extension or exact name)
+    bool is_source_file(std::string_view filename) {
+        return LanguageMap::find(filename) != nullptr;
+    }
+
+    // Resolves ".git" of a work tree: a directory, or a file with a "gitdir: <path>" line
+    fs::path git_dir_of(const fs::path& work_tree) {
+        std::error_code ec;
+        fs::path dot_git = work_tree / ".git";
+        if (fs::is_directory(dot_git, ec)) return dot_git;
+        if (!fs::is_regular_file(dot_git, ec)) return {};
 
-        // Get file extension and convert to lowercase for case-insensitive comparison
-        std::string ext = path.extension().string();
-        std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
-        
-        // Check if extension exists in our pre-loaded cache
-        return extension_cache.find(ext) != extension_cache.end();
+        std::ifstream file(dot_git);
+        std::string line;
+        if (!std::getline(file, line) || line.rfind("gitdir: ", 0) != 0) return {};
+        fs::path git_dir = line.substr(8);
+        return git_dir.is_absolute() ? git_dir : work_tree / git_dir;  // Worktrees and submodules
     }
 
-    // Recursively traverses directory and adds source files to queue
+    // Reads a small config-style file relative to a directory fd (AT_FDCWD for plain paths)
+    bool read_file_at(int dir_fd, const char* name, std::string& content) {
+        int fd = openat(dir_fd, name, O_RDONLY | O_CLOEXEC);
+        if (fd == -1) return false;
+
+        char buffer[16 * 1024];
+        ssize_t n;
+        while ((n = read(fd, buffer, sizeof(buffer))) > 0) content.append(buffer, n);
+        close(fd);
+        return true;
+    }
+
+    // Traverses directory tree with a work-stealing walker, files reach the queue as they are found
     void traverse_directory(const fs::path& dir_path, ThreadSafeQueue& file_queue, 
-        std::atomic<size_t>& total_files, int max_depth) {
-        
-        // Use error_code to avoid exception handling for filesystem operations
-        std::error_code ec;
-        
-        // Define recursive lambda for directory traversal
-        std::function<void(const fs::path&, int)> traverse = [&](const fs::path& path, int depth) {
-            // Stop recursion if we've reached maximum depth
-            if (depth > max_depth) return;
-
-            // Iterate through directory entries
-            for (const auto& entry : fs::directory_iterator(path, ec)) {
-                if (ec) continue;  // Skip entries that caused errors
-                
-                const auto& current_path = entry.path();
-
-                // Check if entry is a directory (using faster entry methods)
-                if (entry.is_directory(ec) && !ec) {
-                    traverse(current_path, depth + 1);  // Recurse into subdirectory
-                } 
-                // Check if entry is a regular file and a source file
-                else if (entry.is_regular_file(ec) && !ec && is_source_file(current_path)) {
-                    file_queue.push(current_path);  // Add file to processing queue
-                    total_files.fetch_add(1, std::memory_order_relaxed);  // Increment counter
+        std::atomic<size_t>& total_files, const TraversalOptions& options) {
+        unsigned int num_threads = std::thread::hardware_concurrency();  // One walker per core
+        if (num_threads == 0) num_threads = 4;  // Fallback to 4 threads if detection fails
+
+        DirectoryWalker walker(file_queue, total_files, options, num_threads);
+        walker.walk(dir_path);
+    }
+
+    // Streams a path list in 1 MB blocks, slicing entries in place instead of reading them line by line
+    bool read_file_list(const std::string& source, ThreadSafeQueue& file_queue,
+        std::atomic<size_t>& total_files, const TraversalOptions& options) {
+        int fd = source == "-" ? STDIN_FILENO : open(source.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) return false;
+
+        constexpr size_t BLOCK_SIZE = 1024 * 1024;
+        std::vector<char> buffer(BLOCK_SIZE);
+        size_t filled = 0;  // Bytes in buffer, including a partial entry carried over
+        char separator = 0; // Decided at the first NUL or newline seen, then kept for the whole stream
+        StringViewMap<const DirHandle*> dirs;  // Directory nodes shared by entries
+
+        auto dispatch = [&](std::string_view path) {
+            if (separator == '\n' && !path.empty() && path.back() == '\r') path.remove_suffix(1);
+            if (path.empty()) return;
+            size_t slash = path.rfind('/');
+            std::string_view name = slash == std::string_view::npos ? path : path.substr(slash + 1);
+            LanguageDetector::Verdict verdict = LanguageDetector::classify(name);
+            if (!verdict.accepted) return;
+            if (options.filter) {
+                std::string_view rel = path.substr(0, 2) == "./" ? path.substr(2) : path;
+                if (!options.filter->accepts_path(rel)) return;
+            }
+
+            std::string_view dir = slash == std::string_view::npos ? std::string_view(".")
+                : slash == 0 ? std::string_view("/") : path.substr(0, slash);
+            auto it = dirs.find(dir);
+            if (it == dirs.end()) {
+                it = dirs.emplace(std::string(dir), DirHandle::create(nullptr, PathArena::store(dir), -1)).first;
+            }
+            SourceFile file{it->second, PathArena::store(name)};
+            file.language = verdict.language;
+            file.detect = verdict.needs_content;
+            file_queue.push(file);
+            total_files.fetch_add(1, std::memory_order_relaxed);
+        };
+
+        bool ok = true;
+        while (true) {
+            ssize_t n = read(fd, buffer.data() + filled, buffer.size() - filled);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                ok = false;
+                break;
+            }
+            if (n == 0) {  // Last entry may lack a terminator
+                if (filled > 0) dispatch(std::string_view(buffer.data(), filled));
+                break;
+            }
+            filled += n;
+            if (separator == 0) {  // A pipe may deliver the first entry across several reads
+                const char* first = std::find_if(buffer.data(), buffer.data() + filled,
+                    [](char c) { return c == '\0' || c == '\n'; });
+                if (first == buffer.data() + filled) {
+                    if (filled == buffer.size()) buffer.resize(buffer.size() * 2);
+                    continue;
                 }
+                separator = *first;
             }
+
+            // Slice complete entries directly out of the block
+            const char* begin = buffer.data();
+            const char* end = buffer.data() + filled;
+            while (const char* stop = static_cast<const char*>(std::memchr(begin, separator, end - begin))) {
+                dispatch(std::string_view(begin, stop - begin));
+                begin = stop + 1;
+            }
+
+            filled = end - begin;  // Carry the unterminated tail to the front
+            std::memmove(buffer.data(), begin, filled);
+            if (filled == buffer.size()) buffer.resize(buffer.size() * 2);  // Entry longer than a block
+        }
+
+        if (fd != STDIN_FILENO) close(fd);
+        return ok;
+    }
+
+    // Enumerates tracked files straight from .git/index: no directory listing, untracked output skipped
+    bool traverse_git_index(const fs::path& dir_path, ThreadSafeQueue& file_queue,
+        std::atomic<size_t>& total_files, const TraversalOptions& options) {
+        fs::path git_dir = git_dir_of(dir_path);
+        if (git_dir.empty()) return false;  // Not a work tree root
+
+        std::vector<GitIndex::Entry> entries;
+        if (!GitIndex::read(git_dir / "index", GitIndex::hash_size_of(git_dir), entries)) return false;
+
+        StringViewSet tracked;  // Paths the untracked walk must not report again
+        if (options.include_untracked) tracked.reserve(entries.size());
+
+        // Largest files first so long-running files start early and the tail stays short
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const auto& a, const auto& b) { return a.size > b.size; });
+
+        // The index lists every tracked .gitattributes, so only those directories are ever read
+        StringViewSet attribute_dirs;
+        for (const auto& entry : entries) {
+            std::string_view path = entry.path;
+            if (path == ".gitattributes") attribute_dirs.emplace();
+            else if (path.size() > 15 && path.substr(path.size() - 15) == "/.gitattributes") {
+                attribute_dirs.emplace(path.substr(0, path.size() - 15));
+            }
+        }
+
+        std::shared_ptr<const AttributeScope> global_attributes;  // .git/info/attributes, overrides every .gitattributes
+        if (options.respect_git_attributes) global_attributes = AttributeScope::load_global(dir_path);
+        StringViewMap<std::shared_ptr<const AttributeScope>> attribute_scopes;  // Cached per directory
+        std::function<std::shared_ptr<const AttributeScope>(std::string_view)> scope_of = [&](std::string_view dir) {
+            auto it = attribute_scopes.find(dir);
+            if (it != attribute_scopes.end()) return it->second;
+            size_t slash = dir.rfind('/');
+            auto scope = dir.empty() ? global_attributes
+                : scope_of(slash == std::string_view::npos ? std::string_view() : dir.substr(0, slash));
+            if (attribute_dirs.contains(dir)) scope = AttributeScope::load(scope, dir.empty() ? dir_path : dir_path / dir, dir);
+            attribute_scopes.emplace(std::string(dir), scope);
+            return scope;
         };
 
-        // Start recursive traversal from root directory at depth 0
-        traverse(dir_path, 0);
+        // One node per directory below the root node, path-based opens
+        const DirHandle* root = DirHandle::create(nullptr, PathArena::store(dir_path.native()), -1);
+        StringViewMap<const DirHandle*> dirs;
+        for (auto& entry : entries) {
+            if (options.include_untracked) tracked.insert(entry.path);
+
+            size_t slash = entry.path.rfind('/');
+            std::string_view name = slash == std::string::npos
+                ? std::string_view(entry.path) : std::string_view(entry.path).substr(slash + 1);
+            std::string_view dir = slash == std::string::npos ? std::string_view() : std::string_view(entry.path).substr(0, slash);
+
+            LanguageDetector::Verdict verdict = LanguageDetector::classify(name);
+            LinguistAttributes attrs;
+            if (options.respect_git_attributes && (verdict.accepted || !attribute_dirs.empty())) {
+                if (auto scope = scope_of(dir)) attrs = scope->lookup(entry.path, name);
+            }
+            if (attrs.vendored || attrs.generated || (!verdict.accepted && attrs.language == LanguageMap::OTHER)) continue;
+            if (attrs.language != LanguageMap::OTHER) verdict = {true, false, attrs.language};
+            if (options.filter && !options.filter->accepts_path(entry.path)) continue;
+
+            auto it = dirs.find(dir);
+            if (it == dirs.end()) {
+                const DirHandle* node = dir.empty() ? root : DirHandle::create(root, PathArena::store(dir), -1);
+                it = dirs.emplace(std::string(dir), node).first;
+            }
+
+            SourceFile file{it->second, PathArena::store(name)};
+            file.size = entry.size;
+            file.mtime = entry.mtime;
+            file.language = verdict.language;
+            file.detect = verdict.needs_content;
+            file.listed = true;  // Workers uncount it when it is gone from the work tree
+            file_queue.push(file);
+            total_files.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (options.include_untracked) {  // Walk for files git does not know about yet
+            TraversalOptions walk_options = options;
+            walk_options.respect_ignore_files = true;
+            walk_options.skip_files = &tracked;
+            traverse_directory(dir_path, file_queue, total_files, walk_options);
+        }
+        return true;
     }
 }
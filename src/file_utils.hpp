@@ -3,15 +3,41 @@
 #include <atomic>
 #include <filesystem>
 #include <mutex>
+#include <string>
+#include <string_view>
 
+#include "glob_set.hpp"
+#include "path_filter.hpp"
 #include "thread_safe_queue.hpp"
 
 namespace fs = std::filesystem;
 
+// Traversal policy shared by the directory walker and main()
+struct TraversalOptions {
+    bool respect_ignore_files = true;  // Honor .gitignore/.ignore/info/exclude/core.excludesFile
+    bool respect_git_attributes = true;// Honor linguist-vendored/-generated/-language in .gitattributes
+    bool include_untracked = false;    // Git index source: also walk for untracked, unignored files
+    bool follow_symlinks = false;      // Descend into directory symlinks and count file symlinks
+    bool one_file_system = false;      // Never cross into another mounted filesystem
+    const StringViewSet* skip_files = nullptr;  // Root-relative files already provided by another source
+    const PathFilter* filter = nullptr;         // Compiled --include/--exclude globs, null when none
+};
+
 namespace FileUtils {
-    bool is_source_file(const fs::path& path);  // Check if file is a supported source file
+    bool is_source_file(std::string_view filename);  // Check if file is a supported source file
+    std::string_view extension_of(std::string_view filename);  // Same rules as fs::path::extension
+    fs::path git_dir_of(const fs::path& work_tree);  // Repository dir of a work tree root, empty if none
+    bool read_file_at(int dir_fd, const char* name, std::string& content);  // Whole small file via openat
     
-    // Traverse directory and collect source files with depth limit
+    // Traverse directory in parallel and stream source files into the queue
     void traverse_directory(const fs::path& dir_path, ThreadSafeQueue& file_queue, 
-        std::atomic<size_t>& total_files, int max_depth = 10);
+        std::atomic<size_t>& total_files, const TraversalOptions& options);
+
+    // Feed files listed (NUL- or newline-separated) in a file or stdin ("-"); false if unreadable
+    bool read_file_list(const std::string& source, ThreadSafeQueue& file_queue,
+        std::atomic<size_t>& total_files, const TraversalOptions& options);
+
+    // Feed tracked files from the git index of a work tree root, largest first; false if no index
+    bool traverse_git_index(const fs::path& dir_path, ThreadSafeQueue& file_queue,
+        std::atomic<size_t>& total_files, const TraversalOptions& options);
 }
@@ -0,0 +1,85 @@
+#include <cerrno>        // For ENOENT
+#include <unistd.h>      // For close
+
+#include "file_view.hpp"
+#include "archive_source.hpp"
+#include "chunked_scan.hpp"
+#include "language_detector.hpp"
+#include "marker_set.hpp"
+
+FileView::FileView(SourceFile& file, FileAccess prefetch)
+    : file(file), measure(prefetch == FileAccess::Metrics) {
+    if (file.detect && !LanguageDetector::settled(file)) {
+        load(&file, prefetch >= FileAccess::Content);  // Metadata only: the head is all that is read
+    } else if (prefetch >= FileAccess::Content) {
+        bytes();  // Lines wait for first use: skipped files never get them
+    } else if (file.listed) {  // Nothing to read, but a listed file may no longer exist
+        if (int fd = file.open(); fd != -1) close(fd);
+        else gone = errno == ENOENT;
+    }
+}
+
+std::string_view FileView::bytes() const {
+    if (!loaded) load(nullptr, true);
+    return buffer.bytes();
+}
+
+void FileView::load(SourceFile* detect, bool whole) const {
+    loaded = true;
+    bool resolved = false;
+    HeadCheck check;
+    if (detect || !whole || ContentSniffer::enabled()) {
+        check = [&](std::string_view head, size_t size) {
+            if (detect) {  // Language first: extensionless files without one are dropped, not reported
+                resolved = true;
+                known = LanguageDetector::resolve(*detect, head);
+                if (!known) return false;
+            }
+            if (!whole) return false;
+            if (!ContentSniffer::enabled()) return true;
+            content = ContentSniffer::sniff(head, size);
+            if (content == ContentKind::Source) return true;
+            ContentSniffer::record(content, size);
+            return false;
+        };
+    }
+    if (file.entry) {
+        ArchiveSource::load(*file.entry, buffer, check);  // In the archive mapping, or inflated here
+    } else if (int fd = file.open(); fd != -1) {  // openat() relative to the directory, path fallback
+        buffer.load(fd, check);  // Mappings stay valid without the descriptor
+        close(fd);
+    } else {
+        gone = errno == ENOENT;
+    }
+    if (detect && !resolved) known = LanguageDetector::resolve(*detect, {});  // Empty or unreadable file
+}
+
+TextFormat FileView::format() const {
+    if (!detected) {
+        text_format = TextFormat::detect(bytes().substr(0, FileBuffer::HEAD));
+        detected = true;
+    }
+    return text_format;
+}
+
+const LineTally& FileView::lines() const {
+    if (!classified) {
+        const CommentSyntax* syntax = CommentSyntax::of(language());
+        LineClassifier::Options options;
+        if (strategy() == IoStrategy::Window) {  // Single pass, pages released behind it
+            options.window = FileIo::options().window;
+            options.release = FileIo::release;
+        }
+        options.measure = measure;
+        options.markers = MarkerSet::active();  // Debt markers are counted in the same pass
+        TextFormat text = format();
+        if (text.width() == 1 && ChunkedScan::applies(size())) {  // Chunks scanned by idle workers too
+            tally = ChunkedScan::classify(bytes().substr(text.bom), syntax, options);
+        } else {
+            tally = LineClassifier::classify(bytes(), text, syntax, options);
+        }
+        if (measure) tally.metrics.bytes = size();
+        classified = true;
+    }
+    return tally;
+}
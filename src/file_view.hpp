@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+#include "source_file.hpp"
+#include "file_io.hpp"
+#include "content_sniffer.hpp"
+#include "line_classifier.hpp"
+
+// What a module reads from each file, ordered: Lines implies Content, Metrics implies Lines
+enum class FileAccess { Metadata, Content, Lines, Metrics };
+
+// One file as every module sees it: opened and read at most once per pipeline pass, with the
+// code/comment/blank split computed at most once. Owned by one worker, so the lazy parts need no locks
+class FileView {
+public:
+    const SourceFile& file;
+
+    // Prefetch: widest access any module needs. Content is read up front, lines on first use.
+    // A file marked detect gets its language from the head of that same read
+    FileView(SourceFile& file, FileAccess prefetch);
+    FileView(const FileView&) = delete;
+    FileView& operator=(const FileView&) = delete;
+
+    std::string_view name() const { return file.name; }
+    LanguageId language() const { return file.language; }
+    bool recognized() const { return known; }  // False: content detection found no language, not counted
+    bool missing() const { return gone; }      // Open failed with ENOENT: deleted after it was listed, not counted
+    const char* c_path() const { return file.c_path(); }  // Per-thread buffer, see SourceFile
+
+    std::string_view bytes() const;   // Whole content, empty when unreadable or not Source
+    ContentKind kind() const { bytes(); return content; }  // Judged from the head as the file is read
+    TextFormat format() const;        // Encoding from the BOM or NUL pattern, detected once
+    size_t size() const { return bytes().size(); }
+    const LineTally& lines() const;   // Split by the comment syntax of language(); metrics too with Metrics prefetch, markers once a MarkerSet is active
+    IoStrategy strategy() const { bytes(); return buffer.strategy(); }
+
+private:
+    void load(SourceFile* detect, bool whole) const;  // Reads the file once; detect resolves from its head
+
+    const bool measure;         // Text metrics ride along with the line split
+    mutable bool known = true;
+    mutable bool gone = false;
+    mutable FileBuffer buffer;  // pread or mmap, chosen by size (FileIo)
+    mutable bool loaded = false;
+    mutable ContentKind content = ContentKind::Source;
+    mutable bool detected = false;
+    mutable TextFormat text_format;
+    mutable bool classified = false;
+    mutable LineTally tally;
+};
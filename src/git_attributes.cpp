@@ -0,0 +1,182 @@
+#include <fcntl.h>     // For AT_FDCWD
+
+#include "git_attributes.hpp"
+#include "file_utils.hpp"
+
+namespace {
+    // Split content into lines and feed them to rules
+    void add_lines(AttributeRules& rules, std::string_view content) {
+        while (!content.empty()) {
+            size_t end = content.find('\n');
+            rules.add_line(content.substr(0, end));
+            if (end == std::string_view::npos) break;
+            content.remove_prefix(end + 1);
+        }
+    }
+
+    // Parse "attr", "-attr", "!attr", "attr=true|false" for a boolean attribute
+    bool parse_bool(std::string_view token, std::string_view name, bool& value) {
+        if (token == name) { value = true; return true; }
+        if (!token.empty() && (token[0] == '-' || token[0] == '!') && token.substr(1) == name) {
+            value = false;
+            return true;
+        }
+        if (token.size() > name.size() && token.substr(0, name.size()) == name && token[name.size()] == '=') {
+            std::string_view rest = token.substr(name.size() + 1);
+            value = rest != "false" && rest != "0";
+            return true;
+        }
+        return false;
+    }
+
+    bool ends_with_subtree(std::string_view glob) {  // "dir/**" applies to every path below dir
+        return glob.size() >= 3 && glob.substr(glob.size() - 3) == "/**";
+    }
+}
+
+void AttributeRules::add_line(std::string_view line) {
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+    auto next_token = [&line]() {  // Whitespace-separated fields
+        size_t begin = line.find_first_not_of(" \t");
+        if (begin == std::string_view::npos) { line = {}; return std::string_view(); }
+        size_t end = line.find_first_of(" \t", begin);
+        std::string_view token = line.substr(begin, end - begin);
+        line = end == std::string_view::npos ? std::string_view() : line.substr(end);
+        return token;
+    };
+
+    std::string_view pattern = next_token();
+    // Comments, quoted patterns and negative patterns (invalid in gitattributes) are skipped,
+    // as are "dir/" patterns, which never apply to the files inside dir
+    if (pattern.empty() || pattern[0] == '#' || pattern[0] == '"' || pattern[0] == '!' || pattern.back() == '/') return;
+
+    bool anchored = pattern.find('/') != std::string_view::npos;
+    if (pattern[0] == '/') pattern.remove_prefix(1);
+    if (pattern.substr(0, 3) == "**/" && pattern.find('/', 3) == std::string_view::npos) {
+        pattern.remove_prefix(3);
+        anchored = false;
+    }
+    if (pattern.empty()) return;
+    auto target = anchored ? GlobSet::Target::Path : GlobSet::Target::Basename;
+    bool subtree = ends_with_subtree(pattern);
+
+    for (std::string_view token = next_token(); !token.empty(); token = next_token()) {
+        bool value;
+        if (parse_bool(token, "linguist-vendored", value)) {
+            vendored.add(pattern, target);
+            vendored_values.push_back(value);
+            vendored_subtree.push_back(subtree);
+        } else if (parse_bool(token, "linguist-generated", value)) {
+            generated.add(pattern, target);
+            generated_values.push_back(value);
+            generated_subtree.push_back(subtree);
+        } else if (token.substr(0, 18) == "linguist-language=") {
+            language.add(pattern, target);
+            languages.push_back(LanguageMap::intern(token.substr(18)));
+        }
+    }
+}
+
+bool AttributeRules::add_file(int dir_fd, const char* name) {
+    std::string content;
+    if (!FileUtils::read_file_at(dir_fd, name, content)) return false;
+    add_lines(*this, content);
+    return true;
+}
+
+bool AttributeRules::add_file(const fs::path& path) {
+    return add_file(AT_FDCWD, path.c_str());
+}
+
+void AttributeRules::compile() {
+    vendored.compile();
+    generated.compile();
+    language.compile();
+}
+
+AttributeScope::AttributeScope(std::shared_ptr<const AttributeScope> parent, std::string base, AttributeRules rules,
+    bool overrides)
+    : parent(std::move(parent)), base(std::move(base)), rules(std::move(rules)),
+      info(overrides ? this : this->parent ? this->parent->info : nullptr) {}
+
+const AttributeScope* AttributeScope::after(const AttributeScope* scope) const {
+    const AttributeScope* next = scope == info ? this : scope->parent.get();
+    return next && next == info ? next->parent.get() : next;  // Already consulted first
+}
+
+LinguistAttributes AttributeScope::lookup(std::string_view rel_path, std::string_view basename) const {
+    LinguistAttributes result;
+    bool vendored_set = false, generated_set = false, language_set = false;
+
+    for (const AttributeScope* scope = first(); scope; scope = after(scope)) {
+        std::string_view local = scope->base.empty() ? rel_path : rel_path.substr(scope->base.size() + 1);
+        const AttributeRules& r = scope->rules;
+        int32_t index;
+        if (!vendored_set && (index = r.vendored.last_match(local, basename)) >= 0) {
+            result.vendored = r.vendored_values[index];
+            vendored_set = true;
+        }
+        if (!generated_set && (index = r.generated.last_match(local, basename)) >= 0) {
+            result.generated = r.generated_values[index];
+            generated_set = true;
+        }
+        if (!language_set && (index = r.language.last_match(local, basename)) >= 0) {
+            result.language = r.languages[index];
+            language_set = true;
+        }
+    }
+    return result;
+}
+
+bool AttributeScope::excludes_dir(std::string_view rel_dir) const {
+    thread_local std::string probe;  // "dir/" matches "dir/**" but not "dir/*.c"
+    bool vendored_set = false, generated_set = false;
+
+    for (const AttributeScope* scope = first(); scope; scope = after(scope)) {
+        probe.assign(scope->base.empty() ? rel_dir : rel_dir.substr(scope->base.size() + 1));
+        probe += '/';
+        const AttributeRules& r = scope->rules;
+        int32_t index;
+        if (!vendored_set && (index = r.vendored.last_match(probe, {})) >= 0) {
+            if (r.vendored_values[index] && r.vendored_subtree[index]) return true;
+            vendored_set = true;
+        }
+        if (!generated_set && (index = r.generated.last_match(probe, {})) >= 0) {
+            if (r.generated_values[index] && r.generated_subtree[index]) return true;
+            generated_set = true;
+        }
+    }
+    return false;
+}
+
+std::shared_ptr<const AttributeScope> AttributeScope::load_global(const fs::path& root) {
+    fs::path git_dir = FileUtils::git_dir_of(root);
+    if (git_dir.empty()) return nullptr;
+
+    AttributeRules rules;
+    rules.add_file(git_dir / "info" / "attributes");
+    if (rules.empty()) return nullptr;
+    rules.compile();
+    return std::make_shared<const AttributeScope>(nullptr, std::string(), std::move(rules), true);
+}
+
+std::shared_ptr<const AttributeScope> AttributeScope::load(const std::shared_ptr<const AttributeScope>& parent,
+    int dir_fd, std::string_view rel_dir) {
+    AttributeRules rules;
+    rules.add_file(dir_fd, ".gitattributes");
+    if (rules.empty()) return parent;  // Nothing new: share the ancestor scope
+
+    rules.compile();
+    return std::make_shared<const AttributeScope>(parent, std::string(rel_dir), std::move(rules));
+}
+
+std::shared_ptr<const AttributeScope> AttributeScope::load(const std::shared_ptr<const AttributeScope>& parent,
+    const fs::path& dir, std::string_view rel_dir) {
+    AttributeRules rules;
+    rules.add_file(dir / ".gitattributes");
+    if (rules.empty()) return parent;
+
+    rules.compile();
+    return std::make_shared<const AttributeScope>(parent, std::string(rel_dir), std::move(rules));
+}
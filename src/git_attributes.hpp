@@ -0,0 +1,74 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "glob_set.hpp"
+#include "../modules/file_extension_to_language_map.hpp"
+
+namespace fs = std::filesystem;
+
+// Linguist attributes that change how a file is counted
+struct LinguistAttributes {
+    bool vendored = false;       // linguist-vendored: third-party code
+    bool generated = false;      // linguist-generated: produced by a tool
+    LanguageId language = LanguageMap::OTHER;  // linguist-language override, OTHER when unset
+};
+
+// linguist-* rules of one .gitattributes file, each attribute resolved by its own GlobSet (last match wins)
+class AttributeRules {
+private:
+    GlobSet vendored;                     // Patterns setting or unsetting linguist-vendored
+    GlobSet generated;                    // Patterns setting or unsetting linguist-generated
+    GlobSet language;                     // Patterns with linguist-language=<name>
+    std::vector<bool> vendored_values;    // Value per vendored pattern index
+    std::vector<bool> vendored_subtree;   // Pattern ends in "/**" and covers a whole directory
+    std::vector<bool> generated_values;
+    std::vector<bool> generated_subtree;
+    std::vector<LanguageId> languages;
+
+    friend class AttributeScope;
+
+public:
+    void add_line(std::string_view line);          // Parse one gitattributes line
+    bool add_file(int dir_fd, const char* name);   // Parse file relative to dir fd
+    bool add_file(const fs::path& path);           // Parse file by path
+    void compile();
+    bool empty() const { return vendored.empty() && generated.empty() && language.empty(); }
+};
+
+// Attributes in effect for one directory, chained to the nearest ancestor with a .gitattributes.
+// .git/info/attributes sits at the root of every chain but, as in git, is consulted before all others
+class AttributeScope {
+private:
+    std::shared_ptr<const AttributeScope> parent;  // Lower-precedence ancestor rules
+    std::string base;                              // Directory of these rules relative to the root
+    AttributeRules rules;
+    const AttributeScope* info;                    // .git/info/attributes of this chain, null when absent
+
+    const AttributeScope* first() const { return info ? info : this; }
+    const AttributeScope* after(const AttributeScope* scope) const;  // Precedence order: info, then innermost out
+
+public:
+    // overrides: the .git/info/attributes scope, above every in-tree file despite being the root
+    AttributeScope(std::shared_ptr<const AttributeScope> parent, std::string base, AttributeRules rules,
+                   bool overrides = false);
+
+    // Attributes of a root-relative file path, innermost scope decides each attribute
+    LinguistAttributes lookup(std::string_view rel_path, std::string_view basename) const;
+
+    // True when "dir/**" marks the whole directory vendored or generated, so it is never opened
+    bool excludes_dir(std::string_view rel_dir) const;
+
+    // .git/info/attributes of a traversal root, null when absent
+    static std::shared_ptr<const AttributeScope> load_global(const fs::path& root);
+
+    // Scope for a directory: its .gitattributes on top of parent, or parent itself when it has none
+    static std::shared_ptr<const AttributeScope> load(const std::shared_ptr<const AttributeScope>& parent,
+        int dir_fd, std::string_view rel_dir);
+    static std::shared_ptr<const AttributeScope> load(const std::shared_ptr<const AttributeScope>& parent,
+        const fs::path& dir, std::string_view rel_dir);
+};
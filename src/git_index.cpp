@@ -0,0 +1,137 @@
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>     // For open
+#include <sys/mman.h>  // For mmap
+#include <sys/stat.h>  // For fstat
+#include <unistd.h>    // For close
+
+#include "git_index.hpp"
+
+namespace {
+    constexpr size_t ENTRY_FIXED_SIZE = 40;    // ctime, mtime, dev, ino, mode, uid, gid, size
+    constexpr uint16_t FLAG_EXTENDED = 0x4000; // Entry carries a second flags word (v3+)
+    constexpr uint16_t FLAG_STAGE = 0x3000;    // Merge stage bits
+    constexpr uint16_t FLAG_NAME_MASK = 0x0fff;
+    constexpr uint16_t EXT_SKIP_WORKTREE = 0x4000; // Sparse checkout: file absent from work tree
+
+    uint32_t be32(const unsigned char* p) {  // Index integers are big-endian
+        return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+    }
+
+    uint16_t be16(const unsigned char* p) {
+        return static_cast<uint16_t>((p[0] << 8) | p[1]);
+    }
+
+    // Git's offset varint used by v4 path compression, returns false on truncated input
+    bool read_varint(const unsigned char*& p, const unsigned char* end, size_t& value) {
+        if (p >= end) return false;
+        unsigned char c = *p++;
+        value = c & 0x7f;
+        while (c & 0x80) {
+            if (p >= end) return false;
+            c = *p++;
+            value = ((value + 1) << 7) | (c & 0x7f);
+        }
+        return true;
+    }
+}
+
+size_t GitIndex::hash_size_of(const fs::path& git_dir) {
+    std::ifstream config(git_dir / "config");
+    std::string line;
+    while (std::getline(config, line)) {  // "objectformat = sha256" under [extensions]
+        if (line.find("objectformat") != std::string::npos && line.find("sha256") != std::string::npos) {
+            return 32;
+        }
+    }
+    return 20;
+}
+
+bool GitIndex::read(const fs::path& index_path, size_t hash_size, std::vector<Entry>& entries) {
+    int fd = open(index_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) == -1 || size_t(st.st_size) < 12 + hash_size) {  // Header plus trailing checksum
+        close(fd);
+        return false;
+    }
+    size_t file_size = st.st_size;
+    void* mapped = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // Mapping stays valid after close
+    if (mapped == MAP_FAILED) return false;
+    madvise(mapped, file_size, MADV_SEQUENTIAL);
+
+    const auto* data = static_cast<const unsigned char*>(mapped);
+    const unsigned char* end = data + file_size - hash_size;  // Trailing checksum
+    uint32_t version = be32(data + 4);
+    uint32_t count = be32(data + 8);
+    if (std::memcmp(data, "DIRC", 4) != 0 || version < 2 || version > 4) {
+        munmap(mapped, file_size);
+        return false;
+    }
+
+    entries.reserve(entries.size() + count);
+    const unsigned char* p = data + 12;
+    std::string path;  // Previous path, v4 entries are stored relative to it
+    bool ok = true;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const unsigned char* entry_start = p;
+        size_t header = ENTRY_FIXED_SIZE + hash_size + 2;
+        if (p + header > end) { ok = false; break; }
+
+        int64_t mtime = be32(p + 8);
+        uint32_t mode = be32(p + 24);
+        uint64_t size = be32(p + 36);
+        uint16_t flags = be16(p + ENTRY_FIXED_SIZE + hash_size);
+        p += header;
+
+        uint16_t extended = 0;
+        if (flags & FLAG_EXTENDED) {
+            if (version < 3 || p + 2 > end) { ok = false; break; }
+            extended = be16(p);
+            p += 2;
+        }
+
+        if (version == 4) {  // Strip N bytes from previous path, append NUL-terminated suffix
+            size_t strip;
+            if (!read_varint(p, end, strip) || strip > path.size()) { ok = false; break; }
+            const auto* nul = static_cast<const unsigned char*>(std::memchr(p, 0, end - p));
+            if (!nul) { ok = false; break; }
+            path.resize(path.size() - strip);
+            path.append(reinterpret_cast<const char*>(p), nul - p);
+            p = nul + 1;
+        } else {  // Full NUL-terminated path, entry padded to a multiple of 8 bytes
+            size_t name_length = flags & FLAG_NAME_MASK;
+            const unsigned char* scan = p + (name_length == FLAG_NAME_MASK ? 0 : name_length);
+            if (scan > end) { ok = false; break; }
+            const auto* nul = static_cast<const unsigned char*>(std::memchr(scan, 0, end - scan));
+            if (!nul) { ok = false; break; }
+            path.assign(reinterpret_cast<const char*>(p), nul - p);
+            size_t length = nul - entry_start;
+            p = entry_start + ((length + 8) & ~size_t(7));
+        }
+
+        bool regular = (mode >> 12) == 010;  // 0100644 / 0100755, not symlinks, gitlinks or sparse dirs
+        bool duplicate = (flags & FLAG_STAGE) != 0 && !entries.empty() && entries.back().path == path;
+        if (regular && !duplicate && !(extended & EXT_SKIP_WORKTREE)) {  // Conflicts: first stage only
+            entries.push_back({path, size, mtime});
+        }
+    }
+
+    // Extensions follow the entries. Optional ones start with 'A'..'Z' and are skipped; a split
+    // index ("link") or any other required one means the entries above are not the whole tree
+    while (ok && p + 8 <= end) {
+        const unsigned char* signature = p;
+        size_t length = be32(p + 4);
+        p += 8;
+        if (length > size_t(end - p)) { ok = false; break; }
+        bool optional = signature[0] >= 'A' && signature[0] <= 'Z';
+        if (!optional || std::memcmp(signature, "link", 4) == 0) { ok = false; break; }
+        p += length;
+    }
+
+    munmap(mapped, file_size);
+    return ok;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Reader for the git index file (DIRC versions 2, 3 and 4)
+class GitIndex {
+public:
+    struct Entry {
+        std::string path;    // Path relative to the work tree root
+        uint64_t size;       // File size recorded at the last `git add`
+        int64_t mtime;       // Modification time (seconds) recorded in the index
+    };
+
+    // Memory-map and parse index_path, keeping regular files not excluded by a sparse checkout
+    // (skip-worktree). Files deleted from the work tree since are still listed: the caller checks
+    static bool read(const fs::path& index_path, size_t hash_size, std::vector<Entry>& entries);
+
+    // Object hash length of a repository: 32 for sha256 repositories, 20 otherwise
+    static size_t hash_size_of(const fs::path& git_dir);
+};
@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <map>
+
+#include "glob_set.hpp"
+
+namespace {
+    std::bitset<256> single(unsigned char c) {  // Set containing one byte
+        std::bitset<256> set;
+        set.set(c);
+        return set;
+    }
+
+    std::bitset<256> not_slash() {  // Any byte except the path separator
+        std::bitset<256> set;
+        set.set();
+        set.reset('/');
+        return set;
+    }
+
+    // Parse "[...]" starting at glob[i] == '[', returns false when the class is not closed
+    bool parse_class(std::string_view glob, size_t& i, std::bitset<256>& set) {
+        size_t j = i + 1;
+        bool negate = j < glob.size() && (glob[j] == '!' || glob[j] == '^');
+        if (negate) ++j;
+
+        std::bitset<256> members;
+        bool first = true;
+        while (j < glob.size() && (glob[j] != ']' || first)) {
+            first = false;
+            unsigned char lo = glob[j];
+            if (lo == '\\' && j + 1 < glob.size()) lo = glob[++j];
+            unsigned char hi = lo;
+            if (j + 2 < glob.size() && glob[j + 1] == '-' && glob[j + 2] != ']') {  // Range a-z
+                hi = glob[j + 2];
+                if (hi == '\\' && j + 3 < glob.size()) hi = glob[++j + 2];
+                j += 2;
+            }
+            for (unsigned c = lo; c <= hi; ++c) members.set(c);
+            ++j;
+        }
+        if (j >= glob.size()) return false;  // No closing bracket: '[' is a literal
+
+        set = negate ? ~members : members;
+        set.reset('/');  // Classes never match the separator
+        i = j + 1;
+        return true;
+    }
+}
+
+uint32_t GlobAutomaton::new_state() {
+    nfa.emplace_back();
+    return static_cast<uint32_t>(nfa.size() - 1);
+}
+
+void GlobAutomaton::add(std::string_view glob, int32_t index) {
+    uint32_t cur = new_state();
+    starts.push_back(cur);
+
+    size_t i = 0;
+    while (i < glob.size()) {
+        bool segment_start = i == 0 || glob[i - 1] == '/';
+        if (segment_start && glob.substr(i, 2) == "**" && (i + 2 == glob.size() || glob[i + 2] == '/')) {
+            std::bitset<256> any;
+            any.set();
+            if (i + 2 == glob.size()) {  // Trailing "**": everything below
+                nfa[cur].edges.emplace_back(any, cur);
+                i += 2;
+                continue;
+            }
+            // "**/": zero or more whole directories
+            uint32_t loop = new_state();
+            uint32_t after = new_state();
+            nfa[cur].epsilon.push_back(after);
+            nfa[cur].epsilon.push_back(loop);
+            nfa[loop].edges.emplace_back(any, loop);
+            nfa[loop].edges.emplace_back(single('/'), after);
+            cur = after;
+            i += 3;
+            continue;
+        }
+
+        char c = glob[i];
+        if (c == '*') {  // Any run inside one path segment
+            while (i < glob.size() && glob[i] == '*') ++i;
+            uint32_t loop = new_state();
+            nfa[cur].epsilon.push_back(loop);
+            nfa[loop].edges.emplace_back(not_slash(), loop);
+            cur = loop;
+            continue;
+        }
+
+        std::bitset<256> set;
+        if (c == '?') {
+            set = not_slash();
+            ++i;
+        } else if (c == '[' && parse_class(glob, i, set)) {
+            // i already advanced past the class
+        } else {
+            if (c == '\\' && i + 1 < glob.size()) ++i;  // Escaped literal
+            set = single(static_cast<unsigned char>(glob[i]));
+            ++i;
+        }
+        uint32_t next = new_state();
+        nfa[cur].edges.emplace_back(set, next);
+        cur = next;
+    }
+    nfa[cur].accept = std::max(nfa[cur].accept, index);
+}
+
+void GlobAutomaton::closure(std::vector<uint32_t>& states) const {
+    std::vector<uint32_t> stack(states);
+    std::vector<bool> seen(nfa.size());
+    for (uint32_t s : states) seen[s] = true;
+    while (!stack.empty()) {
+        uint32_t s = stack.back();
+        stack.pop_back();
+        for (uint32_t t : nfa[s].epsilon) {
+            if (!seen[t]) {
+                seen[t] = true;
+                states.push_back(t);
+                stack.push_back(t);
+            }
+        }
+    }
+    std::sort(states.begin(), states.end());
+    states.erase(std::unique(states.begin(), states.end()), states.end());
+}
+
+void GlobAutomaton::step(const std::vector<uint32_t>& from, uint8_t byte, std::vector<uint32_t>& to) const {
+    to.clear();
+    for (uint32_t s : from) {
+        for (const auto& [set, target] : nfa[s].edges) {
+            if (set.test(byte)) to.push_back(target);
+        }
+    }
+    closure(to);
+}
+
+int32_t GlobAutomaton::accept_of(const std::vector<uint32_t>& states) const {
+    int32_t accept = -1;
+    for (uint32_t s : states) accept = std::max(accept, nfa[s].accept);
+    return accept;
+}
+
+void GlobAutomaton::compile() {
+    if (starts.empty()) return;
+
+    // Byte equivalence classes: bytes with identical membership in every edge set behave alike
+    std::vector<std::bitset<256>> sets;
+    for (const auto& state : nfa) {
+        for (const auto& [set, _] : state.edges) sets.push_back(set);
+    }
+    std::map<std::vector<bool>, uint8_t> signatures;
+    std::array<uint8_t, 256> representative{};
+    for (unsigned b = 0; b < 256; ++b) {
+        std::vector<bool> signature(sets.size());
+        for (size_t k = 0; k < sets.size(); ++k) signature[k] = sets[k].test(b);
+        auto [it, inserted] = signatures.emplace(std::move(signature), static_cast<uint8_t>(signatures.size()));
+        byte_class[b] = it->second;
+        if (inserted) representative[it->second] = static_cast<uint8_t>(b);
+    }
+    class_count = signatures.size();
+
+    // Subset construction, state 0 is the dead state
+    std::map<std::vector<uint32_t>, uint32_t> ids;
+    std::vector<std::vector<uint32_t>> subsets;
+    auto intern = [&](std::vector<uint32_t>&& subset) {
+        auto [it, inserted] = ids.emplace(subset, static_cast<uint32_t>(subsets.size()));
+        if (inserted) subsets.push_back(std::move(subset));
+        return it->second;
+    };
+    intern({});
+    std::vector<uint32_t> start(starts);
+    closure(start);
+    intern(std::move(start));
+
+    std::vector<uint32_t> next;
+    dfa_next.clear();
+    for (size_t d = 0; d < subsets.size(); ++d) {
+        if (subsets.size() > MAX_DFA_STATES) {  // Pathological pattern set, simulate the NFA instead
+            dfa_next.clear();
+            dfa_accept.clear();
+            use_dfa = false;
+            return;
+        }
+        dfa_next.resize((d + 1) * class_count);
+        for (size_t c = 0; c < class_count; ++c) {
+            step(subsets[d], representative[c], next);
+            dfa_next[d * class_count + c] = intern(std::vector<uint32_t>(next));
+        }
+    }
+
+    dfa_accept.resize(subsets.size());
+    for (size_t d = 0; d < subsets.size(); ++d) dfa_accept[d] = accept_of(subsets[d]);
+    use_dfa = true;
+}
+
+int32_t GlobAutomaton::match(std::string_view text) const {
+    if (starts.empty()) return -1;
+
+    if (use_dfa) {
+        uint32_t state = 1;  // Start state
+        for (unsigned char c : text) {
+            state = dfa_next[state * class_count + byte_class[c]];
+            if (state == 0) return -1;  // Dead state: no pattern can match any more
+        }
+        return dfa_accept[state];
+    }
+
+    thread_local std::vector<uint32_t> current, next;  // Scratch sets for NFA simulation
+    current.assign(starts.begin(), starts.end());
+    closure(current);
+    for (unsigned char c : text) {
+        step(current, c, next);
+        current.swap(next);
+        if (current.empty()) return -1;
+    }
+    return accept_of(current);
+}
+
+bool GlobSet::has_wildcards(std::string_view glob) {
+    return glob.find_first_of("*?[\\") != std::string_view::npos;
+}
+
+size_t GlobSet::add(std::string_view glob, Target target) {
+    int32_t index = static_cast<int32_t>(count++);
+    auto keep_max = [index](StringViewMap<int32_t>& map, std::string_view key) {
+        auto [it, inserted] = map.emplace(std::string(key), index);
+        if (!inserted) it->second = std::max(it->second, index);
+    };
+
+    if (!has_wildcards(glob)) {  // Plain literal
+        keep_max(target == Target::Basename ? basename_exact : path_exact, glob);
+    } else if (target == Target::Basename && glob[0] == '*' && !has_wildcards(glob.substr(1))) {
+        keep_max(suffix, glob.substr(1));  // "*.ext" style literal suffix
+        suffix_lengths.push_back(glob.size() - 1);
+    } else {
+        (target == Target::Basename ? basename_automaton : path_automaton).add(glob, index);
+    }
+    return index;
+}
+
+void GlobSet::compile() {
+    std::sort(suffix_lengths.begin(), suffix_lengths.end());
+    suffix_lengths.erase(std::unique(suffix_lengths.begin(), suffix_lengths.end()), suffix_lengths.end());
+    basename_automaton.compile();
+    path_automaton.compile();
+}
+
+int32_t GlobSet::last_match(std::string_view path, std::string_view basename) const {
+    int32_t best = -1;
+    auto probe = [&best](const StringViewMap<int32_t>& map, std::string_view key) {
+        if (map.empty()) return;
+        auto it = map.find(key);
+        if (it != map.end()) best = std::max(best, it->second);
+    };
+
+    probe(basename_exact, basename);
+    probe(path_exact, path);
+    for (size_t len : suffix_lengths) {
+        if (len > basename.size()) break;
+        probe(suffix, basename.substr(basename.size() - len));
+    }
+    best = std::max(best, basename_automaton.match(basename));
+    best = std::max(best, path_automaton.match(path));
+    return best;
+}
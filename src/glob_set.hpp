@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Transparent string hash so maps keyed by std::string can be probed with string_view
+struct StringViewHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view str) const { return std::hash<std::string_view>{}(str); }
+};
+
+template <typename T>
+using StringViewMap = std::unordered_map<std::string, T, StringViewHash, std::equal_to<>>;
+using StringViewSet = std::unordered_set<std::string, StringViewHash, std::equal_to<>>;
+
+// Glob automaton: all patterns share one NFA, determinized at compile time into a byte-class DFA
+class GlobAutomaton {
+private:
+    struct NfaState {
+        std::vector<std::pair<std::bitset<256>, uint32_t>> edges; // Consume a byte from the set
+        std::vector<uint32_t> epsilon;                            // Free transitions
+        int32_t accept = -1;                                      // Pattern index accepted here
+    };
+
+    static constexpr size_t MAX_DFA_STATES = 8192;  // Past this the NFA is simulated instead
+
+    std::vector<NfaState> nfa;          // Thompson-style NFA of every pattern
+    std::vector<uint32_t> starts;       // Start state of each pattern
+    std::array<uint8_t, 256> byte_class{}; // Byte to equivalence class
+    size_t class_count = 1;             // Number of byte classes
+    std::vector<uint32_t> dfa_next;     // Transition table [state * class_count + class]
+    std::vector<int32_t> dfa_accept;    // Highest accepted pattern index per DFA state
+    bool use_dfa = false;               // False when the DFA would exceed MAX_DFA_STATES
+
+    uint32_t new_state();
+    void closure(std::vector<uint32_t>& states) const;   // Epsilon closure, sorted and unique
+    void step(const std::vector<uint32_t>& from, uint8_t byte, std::vector<uint32_t>& to) const;
+    int32_t accept_of(const std::vector<uint32_t>& states) const;
+
+public:
+    void add(std::string_view glob, int32_t index);  // Compile glob into the shared NFA
+    void compile();                                  // Build byte classes and the DFA
+    int32_t match(std::string_view text) const;      // Highest matching pattern index, -1 if none
+    bool empty() const { return starts.empty(); }
+};
+
+// Set of globs matched at once: trivial patterns go to hash tables, the rest to one automaton
+class GlobSet {
+public:
+    enum class Target : uint8_t {
+        Basename,  // Pattern has no slash and matches the entry name at any depth
+        Path       // Pattern is matched against the whole relative path
+    };
+
+private:
+    StringViewMap<int32_t> basename_exact; // "node_modules"
+    StringViewMap<int32_t> suffix;         // "*.o" stored as ".o"
+    StringViewMap<int32_t> path_exact;     // "docs/build"
+    std::vector<size_t> suffix_lengths;    // Distinct suffix lengths to probe
+    GlobAutomaton basename_automaton;      // Remaining basename patterns
+    GlobAutomaton path_automaton;          // Remaining path patterns
+    size_t count = 0;                      // Patterns added so far
+
+public:
+    static bool has_wildcards(std::string_view glob);  // True when glob needs the automaton
+
+    size_t add(std::string_view glob, Target target);  // Add pattern, returns its index
+    void compile();                                    // Finalize, call once after all add()
+    int32_t last_match(std::string_view path, std::string_view basename) const; // Highest index or -1
+    bool empty() const { return count == 0; }
+    size_t size() const { return count; }
+};
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <fcntl.h>     // For AT_FDCWD
+
+#include "ignore_rules.hpp"
+#include "file_utils.hpp"
+
+namespace {
+    // Split content into lines and feed them to rules
+    void add_lines(IgnoreRules& rules, std::string_view content) {
+        while (!content.empty()) {
+            size_t end = content.find('\n');
+            rules.add_line(content.substr(0, end));
+            if (end == std::string_view::npos) break;
+            content.remove_prefix(end + 1);
+        }
+    }
+
+    std::string trim(std::string_view str) {  // Strip surrounding whitespace
+        size_t begin = str.find_first_not_of(" \t\r");
+        if (begin == std::string_view::npos) return {};
+        size_t end = str.find_last_not_of(" \t\r");
+        return std::string(str.substr(begin, end - begin + 1));
+    }
+
+    std::string expand_home(const std::string& path) {  // "~/x" -> "$HOME/x"
+        const char* home = std::getenv("HOME");
+        if (home && path.size() >= 2 && path[0] == '~' && path[1] == '/') return home + path.substr(1);
+        return path;
+    }
+
+    // Read core.excludesFile from one git config file, keeps previous value when unset
+    void read_excludes_file(const fs::path& config, std::string& value) {
+        std::ifstream file(config);
+        std::string line;
+        bool in_core = false;
+        while (std::getline(file, line)) {
+            std::string text = trim(line);
+            if (text.empty() || text[0] == '#' || text[0] == ';') continue;
+            if (text[0] == '[') {  // Section header, only plain [core] matters
+                std::string section = trim(std::string_view(text).substr(1, text.find(']') - 1));
+                std::transform(section.begin(), section.end(), section.begin(), ::tolower);
+                in_core = section == "core";
+                continue;
+            }
+            size_t eq = text.find('=');
+            if (!in_core || eq == std::string::npos) continue;
+            std::string key = trim(std::string_view(text).substr(0, eq));
+            std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+            if (key != "excludesfile") continue;
+            std::string val = trim(std::string_view(text).substr(eq + 1));
+            if (val.size() >= 2 && val.front() == '"' && val.back() == '"') val = val.substr(1, val.size() - 2);
+            value = expand_home(val);
+        }
+    }
+
+    // Location of the user's global excludes file, as git resolves it
+    fs::path global_excludes_file(const fs::path& git_dir) {
+        const char* home = std::getenv("HOME");
+        const char* xdg = std::getenv("XDG_CONFIG_HOME");
+        fs::path xdg_git = xdg && *xdg ? fs::path(xdg) / "git" : home ? fs::path(home) / ".config" / "git" : fs::path();
+
+        std::string value;
+        read_excludes_file("/etc/gitconfig", value);
+        if (!xdg_git.empty()) read_excludes_file(xdg_git / "config", value);
+        if (home) read_excludes_file(fs::path(home) / ".gitconfig", value);
+        if (!git_dir.empty()) read_excludes_file(git_dir / "config", value);
+
+        if (!value.empty()) return value;
+        return xdg_git.empty() ? fs::path() : xdg_git / "ignore";
+    }
+}
+
+void IgnoreRules::add_line(std::string_view line) {
+    if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+    if (line.empty() || line[0] == '#') return;  // Blank line or comment
+
+    // Trailing spaces are dropped unless escaped with a backslash
+    while (!line.empty() && line.back() == ' ' && !(line.size() >= 2 && line[line.size() - 2] == '\\')) {
+        line.remove_suffix(1);
+    }
+
+    bool negated = line[0] == '!';
+    if (negated) line.remove_prefix(1);
+    else if (line.size() >= 2 && line[0] == '\\' && (line[1] == '!' || line[1] == '#')) line.remove_prefix(1);
+
+    bool dir_only = !line.empty() && line.back() == '/';
+    if (dir_only) line.remove_suffix(1);
+    if (line.empty()) return;
+
+    // A slash anywhere but the end anchors the pattern to this directory
+    bool anchored = line.find('/') != std::string_view::npos;
+    if (line[0] == '/') line.remove_prefix(1);
+    if (line.substr(0, 3) == "**/" && line.find('/', 3) == std::string_view::npos) {
+        line.remove_prefix(3);  // "**/name" is the same as an unanchored "name"
+        anchored = false;
+    }
+    if (line.empty()) return;
+
+    auto target = anchored ? GlobSet::Target::Path : GlobSet::Target::Basename;
+    dir_patterns.add(line, target);
+    dir_negated.push_back(negated);
+    if (!dir_only) {
+        file_patterns.add(line, target);
+        file_negated.push_back(negated);
+    }
+}
+
+bool IgnoreRules::add_file(int dir_fd, const char* name) {
+    std::string content;
+    if (!FileUtils::read_file_at(dir_fd, name, content)) return false;  // Most directories have none
+    add_lines(*this, content);
+    return true;
+}
+
+bool IgnoreRules::add_file(const fs::path& path) {
+    return add_file(AT_FDCWD, path.c_str());
+}
+
+void IgnoreRules::compile() {
+    dir_patterns.compile();
+    file_patterns.compile();
+}
+
+int IgnoreRules::match(std::string_view rel_path, std::string_view basename, bool is_dir) const {
+    const GlobSet& patterns = is_dir ? dir_patterns : file_patterns;
+    int32_t index = patterns.last_match(rel_path, basename);
+    if (index < 0) return 0;
+    return (is_dir ? dir_negated : file_negated)[index] ? -1 : 1;
+}
+
+IgnoreScope::IgnoreScope(std::shared_ptr<const IgnoreScope> parent, std::string base, IgnoreRules rules)
+    : parent(std::move(parent)), base(std::move(base)), rules(std::move(rules)) {}
+
+bool IgnoreScope::is_ignored(std::string_view rel_path, std::string_view basename, bool is_dir) const {
+    for (const IgnoreScope* scope = this; scope; scope = scope->parent.get()) {
+        std::string_view local = scope->base.empty() ? rel_path : rel_path.substr(scope->base.size() + 1);
+        int result = scope->rules.match(local, basename, is_dir);
+        if (result != 0) return result > 0;  // Deeper files override their ancestors
+    }
+    return false;
+}
+
+std::shared_ptr<const IgnoreScope> IgnoreScope::load_global(const fs::path& root) {
+    fs::path git_dir = FileUtils::git_dir_of(root);
+
+    IgnoreRules rules;
+    rules.add_file(global_excludes_file(git_dir));              // Lowest precedence
+    if (!git_dir.empty()) rules.add_file(git_dir / "info" / "exclude");
+    if (rules.empty()) return nullptr;
+
+    rules.compile();
+    return std::make_shared<const IgnoreScope>(nullptr, std::string(), std::move(rules));
+}
+
+std::shared_ptr<const IgnoreScope> IgnoreScope::load(const std::shared_ptr<const IgnoreScope>& parent,
+    int dir_fd, std::string_view rel_dir) {
+    IgnoreRules rules;
+    rules.add_file(dir_fd, ".gitignore");
+    rules.add_file(dir_fd, ".ignore");  // ripgrep-style overrides, take precedence over .gitignore
+    if (rules.empty()) return parent;   // Nothing new: share the ancestor scope
+
+    rules.compile();
+    return std::make_shared<const IgnoreScope>(parent, std::string(rel_dir), std::move(rules));
+}
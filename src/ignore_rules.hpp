@@ -0,0 +1,51 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "glob_set.hpp"
+
+namespace fs = std::filesystem;
+
+// Compiled patterns of the ignore files found in one directory (gitignore semantics, last match wins)
+class IgnoreRules {
+private:
+    GlobSet dir_patterns;                 // Every pattern, consulted for directories
+    GlobSet file_patterns;                // Patterns without trailing slash, consulted for files
+    std::vector<bool> dir_negated;        // '!' flag per dir_patterns index
+    std::vector<bool> file_negated;       // '!' flag per file_patterns index
+
+public:
+    void add_line(std::string_view line);               // Parse one gitignore line
+    bool add_file(int dir_fd, const char* name);        // Parse file relative to dir fd
+    bool add_file(const fs::path& path);                // Parse file by path
+    void compile();                                     // Finalize patterns
+    bool empty() const { return dir_patterns.empty(); }
+
+    // 1 = ignored, -1 = re-included by a negated pattern, 0 = no pattern matched
+    int match(std::string_view rel_path, std::string_view basename, bool is_dir) const;
+};
+
+// Rules in effect for one directory, chained to the scope of the nearest ancestor with rules
+class IgnoreScope {
+private:
+    std::shared_ptr<const IgnoreScope> parent;  // Lower-precedence rules of ancestors
+    std::string base;                           // Directory of these rules relative to the root
+    IgnoreRules rules;                          // .gitignore then .ignore (later lines win)
+
+public:
+    IgnoreScope(std::shared_ptr<const IgnoreScope> parent, std::string base, IgnoreRules rules);
+
+    // Check path relative to the traversal root, innermost scope decides
+    bool is_ignored(std::string_view rel_path, std::string_view basename, bool is_dir) const;
+
+    // Global excludes (core.excludesFile, .git/info/exclude) for a traversal root, null when none
+    static std::shared_ptr<const IgnoreScope> load_global(const fs::path& root);
+
+    // Scope for a directory: its own ignore files on top of parent, or parent itself when it has none
+    static std::shared_ptr<const IgnoreScope> load(const std::shared_ptr<const IgnoreScope>& parent,
+        int dir_fd, std::string_view rel_dir);
+};
@@ -0,0 +1,9 @@
+#include "inode_set.hpp"
+
+bool InodeSet::insert(uint64_t dev, uint64_t ino) {
+    Key key{dev, ino};
+    size_t hash = KeyHash{}(key);
+    Shard& shard = shards[(hash >> 7) % SHARD_COUNT];  // High bits pick the shard, low bits the bucket
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.keys.insert(key).second;
+}
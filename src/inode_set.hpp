@@ -0,0 +1,35 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <unordered_set>
+
+// Concurrent set of (device, inode) pairs, sharded so walker threads rarely share a lock
+class InodeSet {
+private:
+    struct Key {
+        uint64_t dev;  // st_dev of the filesystem
+        uint64_t ino;  // Inode number within it
+        bool operator==(const Key& other) const { return dev == other.dev && ino == other.ino; }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {  // Mix both halves, inode numbers are dense
+            uint64_t h = key.ino * 0x9e3779b97f4a7c15ULL ^ (key.dev + 0x632be59bd9b4e019ULL);
+            return static_cast<size_t>(h ^ (h >> 29));
+        }
+    };
+
+    static constexpr size_t SHARD_COUNT = 64;
+
+    struct alignas(64) Shard {             // Padded against false sharing between shards
+        std::mutex mutex;
+        std::unordered_set<Key, KeyHash> keys;
+    };
+
+    std::array<Shard, SHARD_COUNT> shards;
+
+public:
+    bool insert(uint64_t dev, uint64_t ino);  // True when the pair was not seen before
+};
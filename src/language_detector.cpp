@@ -0,0 +1,240 @@
+#include <algorithm>
+#include <cctype>
+#include <initializer_list>
+#include <string>
+#include <utility>
+
+#include "language_detector.hpp"
+#include "file_utils.hpp"
+
+namespace {
+    // Interpreter and editor-mode names mapped to an extension key of the language table
+    constexpr std::pair<std::string_view, std::string_view> aliases[] = {
+        {"sh", ".sh"}, {"dash", ".sh"}, {"ash", ".sh"}, {"bash", ".bash"}, {"zsh", ".zsh"},
+        {"ksh", ".ksh"}, {"mksh", ".ksh"}, {"fish", ".fish"}, {"python", ".py"}, {"pypy", ".py"},
+        {"perl", ".pl"}, {"ruby", ".rb"}, {"node", ".js"}, {"nodejs", ".js"}, {"javascript", ".js"},
+        {"js", ".js"}, {"php", ".php"}, {"lua", ".lua"}, {"luajit", ".lua"}, {"tclsh", ".tcl"},
+        {"wish", ".tcl"}, {"rscript", ".r"}, {"awk", ".awk"}, {"gawk", ".awk"}, {"mawk", ".awk"},
+        {"nawk", ".awk"}, {"make", ".mk"}, {"makefile", ".mk"}, {"cpp", ".cpp"}, {"c++", ".cpp"},
+        {"groovy", ".groovy"}, {"elisp", ".el"}, {"emacs-lisp", ".el"}, {"dosini", ".ini"},
+    };
+
+    // Names of the form "Dockerfile.dev" that belong to the exact name before the dot
+    constexpr std::string_view name_prefixes[] = {"Dockerfile.", "Containerfile.", "Jenkinsfile."};
+
+    enum Ambiguity { NONE = -1, HEADER = 0, M_FILE = 1, PL_FILE = 2 };  // Also the cache slot
+
+    Ambiguity ambiguity_of(const LanguageInfo* info) {
+        static const LanguageInfo* h = LanguageMap::find_extension(".h");
+        static const LanguageInfo* m = LanguageMap::find_extension(".m");
+        static const LanguageInfo* pl = LanguageMap::find_extension(".pl");
+        return info == h ? HEADER : info == m ? M_FILE : info == pl ? PL_FILE : NONE;
+    }
+
+    // Language of an interpreter or mode name ("python3.11", "sh", "go"), OTHER when unknown
+    LanguageId language_for(std::string_view name) {
+        std::string key(name);
+        std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+        while (!key.empty() && (std::isdigit(static_cast<unsigned char>(key.back())) || key.back() == '.')) {
+            key.pop_back();  // Versioned interpreters: python3.11 -> python
+        }
+        if (key.empty()) return LanguageMap::OTHER;
+
+        for (const auto& [alias, ext] : aliases) {
+            if (alias == key) return LanguageMap::find_extension(ext)->language;
+        }
+        const LanguageInfo* info = LanguageMap::find_extension("." + key);  // "lua", "go", "yaml"...
+        return info ? info->language : LanguageMap::OTHER;
+    }
+
+    std::string_view first_line(std::string_view text) {
+        return text.substr(0, text.find('\n'));
+    }
+
+    bool is_space(char c) { return c == ' ' || c == '\t'; }
+
+    // "#!/usr/bin/env -S python3 -u" -> python, "#!/bin/sh -e" -> sh
+    LanguageId from_shebang(std::string_view line) {
+        auto next_token = [&line]() {
+            while (!line.empty() && is_space(line.front())) line.remove_prefix(1);
+            size_t end = 0;
+            while (end < line.size() && !is_space(line[end]) && line[end] != '\r') ++end;
+            std::string_view token = line.substr(0, end);
+            line.remove_prefix(end);
+            return token;
+        };
+        auto basename = [](std::string_view path) {
+            size_t slash = path.rfind('/');
+            return slash == std::string_view::npos ? path : path.substr(slash + 1);
+        };
+
+        std::string_view interpreter = basename(next_token());
+        if (interpreter == "env") {  // Skip env options and VAR=value assignments
+            std::string_view token = next_token();
+            while (!token.empty() && (token[0] == '-' || token.find('=') != std::string_view::npos)) token = next_token();
+            interpreter = basename(token);
+        }
+        return language_for(interpreter);
+    }
+
+    // Value of "key" in "mode: python;" or "ft=python:", running until a separator
+    std::string_view value_after(std::string_view text, size_t pos) {
+        while (pos < text.size() && is_space(text[pos])) ++pos;
+        size_t end = pos;
+        while (end < text.size() && (std::isalnum(static_cast<unsigned char>(text[end]))
+            || text[end] == '+' || text[end] == '-' || text[end] == '_')) ++end;
+        return text.substr(pos, end - pos);
+    }
+
+    // Emacs "-*- mode: python -*-" / "-*- python -*-" on the first two lines
+    LanguageId from_emacs_modeline(std::string_view text) {
+        std::string_view lines = text.substr(0, text.find('\n', text.find('\n') + 1));
+        size_t begin = lines.find("-*-");
+        if (begin == std::string_view::npos) return LanguageMap::OTHER;
+        size_t end = lines.find("-*-", begin + 3);
+        if (end == std::string_view::npos) return LanguageMap::OTHER;
+
+        std::string_view inner = lines.substr(begin + 3, end - begin - 3);
+        size_t mode = inner.find("mode:");
+        if (mode != std::string_view::npos) return language_for(value_after(inner, mode + 5));
+        if (inner.find(':') != std::string_view::npos) return LanguageMap::OTHER;  // Only other variables
+        return language_for(value_after(inner, 0));
+    }
+
+    // Vim "vim: set ft=python:" / "vi: filetype=sh" anywhere in the prefix
+    LanguageId from_vim_modeline(std::string_view text) {
+        for (std::string_view marker : {"vim:", "vi:", "ex:"}) {
+            for (size_t pos = text.find(marker); pos != std::string_view::npos; pos = text.find(marker, pos + 1)) {
+                if (pos > 0 && !is_space(text[pos - 1])) continue;  // "navi:" is not a modeline
+                std::string_view line = first_line(text.substr(pos));
+                for (std::string_view key : {"filetype=", "ft=", "syntax="}) {
+                    size_t at = line.find(key);
+                    if (at == std::string_view::npos || (at > 0 && std::isalnum(static_cast<unsigned char>(line[at - 1])))) {
+                        continue;
+                    }
+                    LanguageId language = language_for(value_after(line, at + key.size()));
+                    if (language != LanguageMap::OTHER) return language;
+                }
+            }
+        }
+        return LanguageMap::OTHER;
+    }
+
+    bool contains_any(std::string_view text, std::initializer_list<std::string_view> words) {
+        for (std::string_view word : words) {
+            if (text.find(word) != std::string_view::npos) return true;
+        }
+        return false;
+    }
+
+    bool starts_line(std::string_view text, std::initializer_list<std::string_view> words) {
+        for (std::string_view word : words) {
+            if (text.substr(0, word.size()) == word) return true;
+            for (size_t pos = text.find(word, 1); pos != std::string_view::npos; pos = text.find(word, pos + 1)) {
+                if (text[pos - 1] == '\n') return true;
+            }
+        }
+        return false;
+    }
+
+    bool objective_c_markers(std::string_view text) {
+        return starts_line(text, {"@interface", "@implementation", "@protocol", "@end", "#import "});
+    }
+
+    // Keyword vote for ambiguous extensions, OTHER keeps the table's language
+    LanguageId from_keywords(Ambiguity kind, std::string_view text) {
+        static const LanguageId objective_c = LanguageMap::intern("Objective-C");
+        static const LanguageId prolog = LanguageMap::intern("Prolog");
+        static const LanguageId cpp_header = LanguageMap::find_extension(".hpp")->language;
+
+        switch (kind) {
+        case HEADER:
+            if (objective_c_markers(text)) return objective_c;
+            if (contains_any(text, {"namespace ", "template<", "template <", "std::", "public:", "private:",
+                "protected:", "virtual ", "constexpr ", "nullptr", "#include <iostream>", "#include <string>",
+                "#include <vector>", "#include <memory>"})) return cpp_header;
+            return LanguageMap::OTHER;
+        case M_FILE:
+            return objective_c_markers(text) ? objective_c : LanguageMap::OTHER;
+        case PL_FILE:
+            if (contains_any(text, {"use strict", "use warnings", "my $", "my @", "my %", "package ", "sub "})) {
+                return LanguageMap::OTHER;
+            }
+            return starts_line(text, {":-", "?-"}) ? prolog : LanguageMap::OTHER;
+        default:
+            return LanguageMap::OTHER;
+        }
+    }
+
+    // Per-directory verdicts, one 16-bit slot per Ambiguity: agreement count (3 bits) and LanguageId (13 bits)
+    constexpr uint32_t SETTLED = 3;  // Agreeing files after which the rest of the directory is not read
+    constexpr uint16_t ID_MASK = 0x1fff;
+
+    bool cached_verdict(const DirHandle& dir, Ambiguity kind, LanguageId& language) {
+        uint16_t slot = static_cast<uint16_t>(dir.detected.load(std::memory_order_relaxed) >> (kind * 16));
+        if ((slot >> 13) < SETTLED) return false;
+        language = slot & ID_MASK;
+        return true;
+    }
+
+    void record_verdict(const DirHandle& dir, Ambiguity kind, LanguageId language) {
+        uint64_t old_value = dir.detected.load(std::memory_order_relaxed);
+        uint64_t new_value;
+        do {
+            uint16_t slot = static_cast<uint16_t>(old_value >> (kind * 16));
+            uint32_t count = (slot & ID_MASK) == language ? std::min<uint32_t>((slot >> 13) + 1, 7) : 1;
+            uint64_t updated = (static_cast<uint64_t>(count) << 13) | (language & ID_MASK);
+            new_value = (old_value & ~(0xffffull << (kind * 16))) | (updated << (kind * 16));
+        } while (!dir.detected.compare_exchange_weak(old_value, new_value, std::memory_order_relaxed));
+    }
+}
+
+namespace LanguageDetector {
+    Verdict classify(std::string_view name) {
+        if (const LanguageInfo* info = LanguageMap::find(name)) {  // Common case: one table probe
+            return {true, ambiguity_of(info) != NONE, info->language};
+        }
+        for (std::string_view prefix : name_prefixes) {
+            if (name.size() > prefix.size() && name.substr(0, prefix.size()) == prefix) {
+                return {true, false, LanguageMap::find(prefix.substr(0, prefix.size() - 1))->language};
+            }
+        }
+        if (FileUtils::extension_of(name).empty()) return {true, true, LanguageMap::OTHER};  // Maybe a script
+        return {};
+    }
+
+    LanguageId from_prefix(std::string_view prefix) {
+        if (prefix.substr(0, 2) == "#!") {
+            LanguageId language = from_shebang(first_line(prefix.substr(2)));
+            if (language != LanguageMap::OTHER) return language;
+        }
+        LanguageId language = from_emacs_modeline(prefix);
+        return language != LanguageMap::OTHER ? language : from_vim_modeline(prefix);
+    }
+
+    bool settled(SourceFile& file) {
+        Ambiguity kind = ambiguity_of(LanguageMap::find_extension(file.extension()));
+        LanguageId language;
+        if (kind == NONE || !cached_verdict(*file.dir, kind, language)) return false;
+        file.language = language;
+        return true;
+    }
+
+    bool resolve(SourceFile& file, std::string_view head) {
+        Ambiguity kind = ambiguity_of(LanguageMap::find_extension(file.extension()));
+        std::string_view prefix = head.substr(0, PREFIX_SIZE);
+        bool binary = prefix.find('\0') != std::string_view::npos;
+
+        if (kind == NONE) {  // Extensionless: counted only when the content names a language
+            if (binary) return false;
+            file.language = from_prefix(prefix);
+            return file.language != LanguageMap::OTHER;
+        }
+
+        LanguageId language = binary ? LanguageMap::OTHER : from_keywords(kind, prefix);
+        if (language == LanguageMap::OTHER) language = file.language;  // Table default stands
+        record_verdict(*file.dir, kind, language);
+        file.language = language;
+        return true;
+    }
+}
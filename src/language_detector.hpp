@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string_view>
+
+#include "source_file.hpp"
+#include "../modules/file_extension_to_language_map.hpp"
+
+// Language decisions the extension table cannot make alone: "Dockerfile.*"-style names,
+// extensionless scripts and ambiguous extensions (.h, .m, .pl). Content decisions look at
+// no more than the first PREFIX_SIZE bytes and are cached per directory once files agree
+namespace LanguageDetector {
+    constexpr size_t PREFIX_SIZE = 4096;
+
+    struct Verdict {
+        bool accepted = false;              // Counted now, or kept as a candidate for the content stage
+        bool needs_content = false;         // Content decides the language (or whether it is source)
+        LanguageId language = LanguageMap::OTHER;  // Language from the name alone
+    };
+
+    Verdict classify(std::string_view name);  // Name-only stage, run during traversal
+
+    // True when a file marked detect needs no content: its directory already agreed (language set)
+    bool settled(SourceFile& file);
+
+    // Content stage for files marked detect, from the head the FileView read: sets file.language,
+    // false when the file is not source
+    bool resolve(SourceFile& file, std::string_view head);
+
+    // Language from the first bytes of a file: shebang, then modeline; OTHER when neither is present
+    LanguageId from_prefix(std::string_view prefix);
+}
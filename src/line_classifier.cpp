@@ -0,0 +1,341 @@
+#include <algorithm>  // For std::min
+
+#include <type_traits>
+
+#include "line_classifier.hpp"
+#include "byte_count.hpp"
+#include "marker_set.hpp"
+
+namespace {
+    constexpr CommentSyntax NO_COMMENTS{};
+
+    // Bytes the scanner stops at: first bytes of every marker and quote, plus escapes inside strings
+    ByteCount::ByteSet interesting_bytes(const CommentSyntax& syntax) {
+        ByteCount::ByteSet set;
+        for (std::string_view marker : {syntax.line[0], syntax.line[1], syntax.block_open, syntax.block_close}) {
+            if (!marker.empty()) set.add(marker.front());
+        }
+        for (char quote : syntax.quotes) set.add(quote);
+        if (!syntax.quotes.empty()) set.add('\\');
+        return set;  // At most seven distinct bytes across the table
+    }
+
+    // UTF-8 or any other byte-wide text: positions are bytes
+    struct ByteText {
+        std::string_view bytes;
+
+        size_t size() const { return bytes.size(); }
+        char operator[](size_t pos) const { return bytes[pos]; }
+        bool matches(size_t pos, std::string_view marker) const { return bytes.substr(pos, marker.size()) == marker; }
+        const char* address(size_t pos) const { return bytes.data() + pos; }
+        ByteCount::BlockMasks masks(size_t base, const ByteCount::ByteSet& set) const {
+            return ByteCount::scan_block(bytes.data() + base, bytes.size() - base, set);
+        }
+    };
+
+    // UTF-16/32 read in place, no transcoding copy: positions are code units, and units beyond
+    // ASCII read as 0x80, which no marker or quote uses. A trailing partial unit is ignored
+    class WideText {
+    private:
+        const char* data;
+        size_t units;
+        size_t width;
+        bool big_endian;
+
+    public:
+        WideText(std::string_view bytes, size_t width, bool big_endian)
+            : data(bytes.data()), units(bytes.size() / width), width(width), big_endian(big_endian) {}
+
+        size_t size() const { return units; }
+        char operator[](size_t pos) const {
+            const unsigned char* u = reinterpret_cast<const unsigned char*>(data + pos * width);
+            uint32_t unit = 0;
+            for (size_t i = 0; i < width; ++i) unit = unit << 8 | u[big_endian ? i : width - 1 - i];
+            return unit < 0x80 ? static_cast<char>(unit) : '\x80';
+        }
+        bool matches(size_t pos, std::string_view marker) const {
+            if (pos + marker.size() > units) return false;
+            for (size_t i = 0; i < marker.size(); ++i) {
+                if ((*this)[pos + i] != marker[i]) return false;
+            }
+            return true;
+        }
+        const char* address(size_t pos) const { return data + pos * width; }
+        ByteCount::BlockMasks masks(size_t base, const ByteCount::ByteSet& set) const {
+            return ByteCount::scan_block_wide(data + base * width, units - base, width, big_endian, set);
+        }
+    };
+
+    template <typename Text>
+    class Scanner {
+    private:
+        using State = LineClassifier::Mode;
+
+        Text text;
+        const CommentSyntax& syntax;
+        LineClassifier::ScanState scan;  // Carried across lines, and across chunks of a split file
+        bool has_code = false;    // Current line so far
+        bool has_comment = false;
+        LineTally tally;
+
+        bool measure;               // Metrics carried from one block to the next:
+        bool carry_start = true;    // The next unit starts a line
+        bool carry_space = false;   // The last unit was a space or tab
+        bool carry_crlf = false;    // The last unit was the CR of a CRLF
+        size_t points = 0;          // Code points before the current block
+        size_t line_start = 0;      // Code points before the current line
+
+        // Comment text is searched in spans: consecutive comments separated by whitespace only
+        // (a run of // lines, a block comment and the next) make one span, code ends it
+        static constexpr size_t NONE = ~size_t{0};
+        static constexpr size_t SPAN_LIMIT = 64 * 1024;  // Longer spans end at a line end: far behind a window is released
+        const MarkerSet* markers;   // Tags counted in comment text, null when not asked for
+        bool plain;                 // Syntax without comments: all text is searched
+        size_t comment_from = NONE; // Open span starts here
+        size_t comment_to = NONE;   // The last comment of the span ended here, NONE while inside one
+
+        bool at(size_t pos, std::string_view marker) const {
+            return !marker.empty() && text.matches(pos, marker);
+        }
+
+        void end_line() {
+            if (has_code) ++tally.code;
+            else if (has_comment) ++tally.comments;
+            else ++tally.blanks;
+            has_code = has_comment = false;
+        }
+
+        // A backslash right before the line end (and its CR) continues the line
+        bool continued(size_t pos) const {
+            if (text[pos] == '\n' && pos > 0 && text[pos - 1] == '\r') --pos;
+            return pos > 0 && text[pos - 1] == '\\';
+        }
+
+        void note_length(size_t length) {
+            tally.metrics.longest_line = std::max(tally.metrics.longest_line, length);
+            tally.metrics.line_length += length;
+        }
+
+        // Metrics of one block, from its masks alone: ends holds the last unit of each terminator
+        void measure_block(size_t base, const ByteCount::BlockMasks& masks, uint64_t crlf, uint64_t ends) {
+            size_t left = text.size() - base;
+            uint64_t valid = left >= ByteCount::BLOCK ? ~0ull : (1ull << left) - 1;
+            uint64_t firsts = ~masks.continuations & valid;  // Units that start a code point
+            uint64_t space = ~masks.visible & ~masks.newlines & ~masks.returns & valid;
+            uint64_t eol = masks.returns | (masks.newlines & ~((crlf << 1) | carry_crlf));  // First unit of each terminator
+            uint64_t starts = ((ends << 1) | carry_start) & valid;
+
+            TextMetrics& metrics = tally.metrics;
+            metrics.trailing_whitespace += __builtin_popcountll(eol & ((space << 1) | carry_space));
+            metrics.tab_indented += __builtin_popcountll(starts & masks.tabs);
+            metrics.space_indented += __builtin_popcountll(starts & space & ~masks.tabs);
+            for (uint64_t rest = eol; rest; rest &= rest - 1) {  // Once per line, terminators are ASCII
+                size_t at = static_cast<size_t>(__builtin_ctzll(rest));
+                size_t before = points + __builtin_popcountll(firsts & ((1ull << at) - 1));
+                note_length(before - line_start);
+                line_start = before + ((crlf >> at) & 1 ? 2 : 1);
+            }
+            points += __builtin_popcountll(firsts);
+            carry_start = ends >> 63;
+            carry_space = space >> 63;
+            carry_crlf = crlf >> 63;
+        }
+
+        bool in_comment() const {
+            return plain || scan.mode == State::LineComment || scan.mode == State::BlockComment
+                || (scan.mode == State::String && scan.doc);
+        }
+
+        void open_comment(size_t pos) {
+            if (comment_from == NONE) comment_from = pos;
+            comment_to = NONE;
+        }
+
+        // Hand the span, up to the end of its last comment, to the marker search; UTF-16/32 is not searched
+        void close_comment(size_t end) {
+            if constexpr (std::is_same_v<Text, ByteText>) {
+                if (markers && comment_from != NONE) {
+                    if (comment_to != NONE) end = comment_to;
+                    markers->count(text.bytes.substr(comment_from, end - comment_from), tally.markers);
+                }
+            }
+            comment_from = comment_to = NONE;
+        }
+
+        void note_code() {
+            has_code = true;
+            if (comment_to != NONE) close_comment(comment_to);
+        }
+
+        // Non-whitespace bytes between two stops belong to whatever mode the scan is in
+        void note_visible() {
+            if (scan.mode == State::LineComment || scan.mode == State::BlockComment || (scan.mode == State::String && scan.doc)) {
+                has_comment = true;
+            } else {
+                note_code();
+            }
+        }
+
+        // Handle the interesting byte at pos, return the first position not consumed
+        size_t step(size_t pos) {
+            char c = text[pos];
+            if (c == '\n' || c == '\r') {  // Only lone CRs stop the scan, a CRLF ends at its LF
+                bool continued = this->continued(pos);
+                end_line();
+                if (scan.mode == State::LineComment) {
+                    scan.mode = State::Code;
+                    comment_to = pos;
+                }
+                if (scan.mode == State::String && !scan.triple && !continued
+                    && syntax.multiline_quotes.find(scan.quote) == std::string_view::npos) {
+                    scan.mode = State::Code;  // Unterminated single-line string
+                }
+                if (comment_from != NONE && pos - comment_from >= SPAN_LIMIT) {
+                    close_comment(pos);
+                    if (in_comment()) comment_from = pos + 1;
+                }
+                return pos + 1;
+            }
+
+            switch (scan.mode) {
+            case State::Code:
+                if (at(pos, syntax.block_open)) {  // Before line markers: "--[[" also starts with "--"
+                    scan.mode = State::BlockComment;
+                    scan.depth = 1;
+                    has_comment = true;
+                    open_comment(pos);
+                    return pos + syntax.block_open.size();
+                }
+                for (std::string_view marker : syntax.line) {
+                    if (at(pos, marker)) {
+                        scan.mode = State::LineComment;
+                        has_comment = true;
+                        open_comment(pos);
+                        return pos + marker.size();
+                    }
+                }
+                if (syntax.quotes.find(c) != std::string_view::npos) {
+                    scan.quote = c;
+                    scan.triple = syntax.doc_strings && pos + 2 < text.size() && text[pos + 1] == c && text[pos + 2] == c;
+                    scan.doc = scan.triple && !has_code;
+                    scan.mode = State::String;
+                    if (scan.doc) open_comment(pos);
+                    note_visible();
+                    return pos + (scan.triple ? 3 : 1);
+                }
+                note_code();  // '/' as division, '#' inside an expression...
+                return pos + 1;
+
+            case State::BlockComment:
+                has_comment = true;
+                if (syntax.nested && at(pos, syntax.block_open)) {
+                    ++scan.depth;
+                    return pos + syntax.block_open.size();
+                }
+                if (at(pos, syntax.block_close)) {
+                    if (--scan.depth == 0) {
+                        scan.mode = State::Code;
+                        comment_to = pos + syntax.block_close.size();
+                    }
+                    return pos + syntax.block_close.size();
+                }
+                return pos + 1;
+
+            case State::String:
+                note_visible();
+                if (c == '\\') return pos + (pos + 1 < text.size() && text[pos + 1] != '\n' && text[pos + 1] != '\r' ? 2 : 1);
+                if (c != scan.quote) return pos + 1;
+                if (!scan.triple) {
+                    scan.mode = State::Code;
+                    return pos + 1;
+                }
+                if (pos + 2 < text.size() && text[pos + 1] == c && text[pos + 2] == c) {
+                    if (scan.doc) comment_to = pos + 3;
+                    scan.mode = State::Code;
+                    return pos + 3;
+                }
+                return pos + 1;
+
+            default:
+                return pos + 1;  // Line comments only stop at newlines
+            }
+        }
+
+    public:
+        Scanner(Text text, const CommentSyntax& syntax, const LineClassifier::Options& options,
+                const LineClassifier::ScanState& start = {})
+            : text(text), syntax(syntax), scan(start), measure(options.measure), markers(options.markers),
+              plain(syntax.line[0].empty() && syntax.line[1].empty() && syntax.block_open.empty()) {
+            if (in_comment()) comment_from = 0;  // Piece of a split text that starts inside a comment
+        }
+
+        const LineClassifier::ScanState& state() const { return scan; }
+
+        LineTally run(size_t window, LineClassifier::Release release) {
+            const ByteCount::ByteSet set = interesting_bytes(syntax);
+            size_t resume = 0;    // First unit not consumed yet; markers may run into the next block
+            size_t released = 0;  // Text before this unit was handed to release
+
+            for (size_t base = 0; base < text.size(); base += ByteCount::BLOCK) {
+                if (release && window && base - released >= 2 * window) {  // Keep one window behind (step looks back a unit)
+                    release(text.address(released), text.address(base - window) - text.address(released));
+                    released = base - window;
+                }
+                ByteCount::BlockMasks masks = text.masks(base, set);
+
+                // A CR followed by LF (maybe across the block edge) is one terminator, a lone CR one of its own
+                uint64_t next_lf = base + ByteCount::BLOCK < text.size() && text[base + ByteCount::BLOCK] == '\n';
+                uint64_t crlf = masks.returns & ((masks.newlines >> 1) | (next_lf << 63));
+                uint64_t lone_cr = masks.returns & ~crlf;
+                uint64_t ends = masks.newlines | lone_cr;
+                tally.endings.crlf += __builtin_popcountll(crlf);
+                tally.endings.cr += __builtin_popcountll(lone_cr);
+                tally.endings.lf += __builtin_popcountll(masks.newlines) - __builtin_popcountll(crlf);
+                if (measure) measure_block(base, masks, crlf, ends);
+
+                if (resume >= base + ByteCount::BLOCK) continue;  // Inside a marker that crossed the block
+                size_t i = resume > base ? resume - base : 0;
+
+                while (i < ByteCount::BLOCK) {
+                    uint64_t stops = ends | (scan.mode == State::LineComment ? 0 : masks.hits);
+                    stops &= ~0ull << i;
+                    size_t stop = stops ? static_cast<size_t>(__builtin_ctzll(stops)) : ByteCount::BLOCK;
+
+                    uint64_t span = (stop == ByteCount::BLOCK ? ~0ull : (1ull << stop) - 1) & (~0ull << i);
+                    if (masks.visible & span) note_visible();
+                    if (stop == ByteCount::BLOCK) break;
+
+                    resume = step(base + stop);
+                    i = resume - base;
+                }
+            }
+
+            if (text.size() && text[text.size() - 1] != '\n' && text[text.size() - 1] != '\r') {  // Unterminated last line
+                end_line();
+                if (measure) note_length(points - line_start);
+            }
+            close_comment(text.size());
+            tally.metrics.code_points = points;
+            return tally;
+        }
+    };
+}
+
+namespace LineClassifier {
+    LineTally classify(std::string_view bytes, const TextFormat& format, const CommentSyntax* syntax,
+                       const Options& options) {
+        const CommentSyntax& rules = syntax ? *syntax : NO_COMMENTS;
+        std::string_view text = bytes.substr(std::min(format.bom, bytes.size()));
+        size_t width = format.width();
+        if (width == 1) return Scanner<ByteText>({text}, rules, options).run(options.window, options.release);
+        return Scanner<WideText>(WideText(text, width, format.big_endian()), rules, options)
+            .run(options.window / width, options.release);
+    }
+
+    LineTally classify(std::string_view text, const CommentSyntax* syntax, ScanState& state, const Options& options) {
+        Scanner<ByteText> scanner({text}, syntax ? *syntax : NO_COMMENTS, options, state);
+        LineTally tally = scanner.run(0, nullptr);
+        state = scanner.state();
+        return tally;
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "comment_syntax.hpp"
+#include "text_format.hpp"
+
+class MarkerSet;
+
+constexpr size_t MAX_MARKERS = 8;  // Tags one MarkerSet can hold
+using MarkerCounts = std::array<size_t, MAX_MARKERS>;  // Hits per tag, in MarkerSet order
+
+// Size and layout of text, gathered in the same pass as the line split when asked for. Lengths
+// are in code points without the terminator; indentation looks at the first unit of each line
+struct TextMetrics {
+    size_t bytes = 0;
+    size_t code_points = 0;
+    size_t longest_line = 0;
+    size_t line_length = 0;          // Sum over all lines, for the mean
+    size_t tab_indented = 0;         // Lines starting with a tab
+    size_t space_indented = 0;       // Lines starting with a space
+    size_t trailing_whitespace = 0;  // Lines ending in spaces or tabs
+
+    TextMetrics& operator+=(const TextMetrics& other) {
+        bytes += other.bytes;
+        code_points += other.code_points;
+        longest_line = std::max(longest_line, other.longest_line);
+        line_length += other.line_length;
+        tab_indented += other.tab_indented;
+        space_indented += other.space_indented;
+        trailing_whitespace += other.trailing_whitespace;
+        return *this;
+    }
+};
+
+// Lines of one file or of many, split like cloc: a line holding any code outside comments is
+// code, one holding only comment text is a comment, one holding only whitespace is blank
+struct LineTally {
+    size_t code = 0;
+    size_t comments = 0;
+    size_t blanks = 0;
+    LineEndings endings;  // How those lines were terminated
+    TextMetrics metrics;  // Zero unless the scan measured
+    MarkerCounts markers{};  // Zero unless the scan looked for markers
+
+    size_t lines() const { return code + comments + blanks; }
+    LineTally& operator+=(const LineTally& other) {
+        code += other.code;
+        comments += other.comments;
+        blanks += other.blanks;
+        endings += other.endings;
+        metrics += other.metrics;
+        for (size_t i = 0; i < MAX_MARKERS; ++i) markers[i] += other.markers[i];
+        return *this;
+    }
+};
+
+// Single pass over a file: SIMD block masks locate line ends, comment and quote characters and
+// non-whitespace, and only those positions are visited. LF, CRLF and a lone CR each end a line;
+// a missing final terminator still ends one
+namespace LineClassifier {
+    enum class Mode : uint8_t { Code, LineComment, BlockComment, String };
+
+    // Lexical state carried from line to line. Text split right after a newline can be scanned
+    // piecewise: each piece starts in the state the previous one ended in
+    struct ScanState {
+        Mode mode = Mode::Code;
+        char quote = 0;         // Delimiter of the open string
+        bool triple = false;    // Open string is a triple-quoted one (Python)
+        bool doc = false;       // Open string is a docstring, counted as comment
+        uint32_t depth = 0;     // Open block comments (nested syntaxes only go past 1)
+
+        bool operator==(const ScanState&) const = default;
+    };
+
+    using Release = void (*)(const char* begin, size_t length);  // Text the scan no longer needs
+
+    struct Options {
+        size_t window = 0;           // With release: bytes kept behind the scan position, the rest is handed back
+        Release release = nullptr;
+        bool measure = false;        // Also fill LineTally::metrics (all but bytes)
+        const MarkerSet* markers = nullptr;  // Count these tags in comment text (anywhere without a comment syntax)
+    };
+
+    // Whole file in the given format: its BOM is skipped, UTF-16/32 is scanned in place unit by
+    // unit. Null syntax: code or blank only
+    LineTally classify(std::string_view bytes, const TextFormat& format, const CommentSyntax* syntax,
+                       const Options& options = {});
+
+    // One UTF-8 piece of a split text: starts in state, leaves the state at its end there.
+    // Window and release of options are not used
+    LineTally classify(std::string_view text, const CommentSyntax* syntax, ScanState& state, const Options& options);
+}
@@ -1,21 +1,23 @@
 #pragma once
 
-#include <atomic>
 #include <filesystem>
 
-namespace fs = std::filesystem;
+#include "file_view.hpp"
+#include "sharded.hpp"
 
-struct LineCount {
-    std::atomic<size_t> code{0};     // Atomic counter for code lines with in-class initializer
-    std::atomic<size_t> comments{0}; // Atomic counter for comment lines with in-class initializer
-};
+namespace fs = std::filesystem;
 
 class LineCounter {
 private:
-    LineCount total_count; // Total line counts using atomic counters
+    Sharded<LineTally> shards; // Per-worker counts, plain adds in the hot loop
+    Sharded<FormatCounts> format_shards;  // Files per encoding and line ending style
+    LineTally total_count;     // Sum of the shards, valid after merge()
+    FormatCounts formats;      // Likewise
 
 public:
-    void count_lines(const fs::path& file_path); // Method for counting lines in file
-    static size_t count_lines_in_file(const fs::path& file_path); // Static method for total line count
-    const LineCount& get_total_count() const { return total_count; } // Getter for total counts
+    void prepare(size_t workers) { shards.resize(workers); format_shards.resize(workers); }  // One shard per worker, before they start
+    void count_lines(const FileView& file, size_t worker); // Add the code/comment/blank split of one file
+    void merge();                                          // Fold the shards, after the workers joined
+    const LineTally& get_total_count() const { return total_count; } // Getter for total counts
+    const FormatCounts& get_formats() const { return formats; }      // Getter for encoding/line ending counts
 };
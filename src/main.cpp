@@ -1,3 +1,4 @@
+#include <algorithm>  // For std::max
 #include <iostream>  
 #include <memory>     
 #include <thread>     
@@ -5,9 +6,18 @@
 #include <atomic>
 #include <filesystem> 
 #include <chrono>     
+#include <cctype>
+#include <functional>
 
 #include "file_utils.hpp"                 // File traversal utilities
 #include "args_parser.hpp"                // Command line argument parsing
+#include "file_io.hpp"                    // Per-file read strategy
+#include "chunked_scan.hpp"               // Intra-file parallelism for large files
+#include "archive_source.hpp"             // tar/tar.gz/tar.zst/zip scanned in place
+#include "content_sniffer.hpp"            // Binary/minified/generated files
+#include "duplicate_filter.hpp"           // Byte-identical copies
+#include "byte_count.hpp"                 // SIMD kernel name for --profile
+#include "output_formatter.hpp"           // Profile section
 #include "license_detect.hpp"             // License detection
 #include "codefetch_module_interface.hpp" // Module interface
 #include "thread_safe_queue.hpp"          // Thread-safe queue implementation
@@ -15,11 +25,30 @@
 #include "total_lines.hpp"                // Line counting functionality
 #include "language_stats.hpp"             // Language statistics
 #include "metabuild_system.hpp"           // Build system detection
+#include "text_metrics.hpp"               // Size, line length and whitespace metrics
+#include "debt_markers.hpp"               // TODO/FIXME/HACK markers
 
 namespace fs = std::filesystem;  // Filesystem namespace alias for brevity
 
 
 
+// Parses "4096", "128K", "64M" or "1G" for size options
+size_t parse_size(const std::string& option, const std::string& value) {
+    size_t digits = value.find_first_not_of("0123456789");
+    std::string suffix = digits == std::string::npos ? "" : value.substr(digits);
+    if (digits == 0 || value.empty() || suffix.size() > 1 || (suffix.size() == 1 && std::string("KkMmGg").find(suffix) == std::string::npos)) {
+        throw std::invalid_argument("invalid value for --" + option + ": " + value);
+    }
+    size_t size = std::stoull(value.substr(0, digits));
+    switch (suffix.empty() ? ' ' : std::tolower(static_cast<unsigned char>(suffix[0]))) {
+    case 'g': size *= 1024;  [[fallthrough]];
+    case 'm': size *= 1024;  [[fallthrough]];
+    case 'k': size *= 1024;  break;
+    default: break;
+    }
+    return size;
+}
+
 // Converts milliseconds to human-readable format (h m s ms)
 std::string formatDuration(std::chrono::milliseconds ms) {
     using namespace std::chrono;
@@ -40,20 +69,43 @@ std::string formatDuration(std::chrono::milliseconds ms) {
 
 // Global thread-safe queue for file paths
 ThreadSafeQueue file_queue;
-// Atomic counters for progress tracking
-std::atomic<size_t> files_processed{0};  // Tracks processed files
+// Atomic counter for files handed to the workers
 std::atomic<size_t> total_files{0};      // Tracks total files found
+// Byte-identical copies, only consulted with --duplicates
+DuplicateFilter duplicate_filter;
+bool find_duplicates = false;
+
+// Worker function for parallel file processing; worker selects each module's accumulator shard
+void process_files(std::vector<std::unique_ptr<CodeFetchModule>> &modules, size_t worker) {  
+    FileAccess prefetch = FileAccess::Metadata;  // Widest access any module declared
+    for (const auto &module : modules) prefetch = std::max(prefetch, module->access());
+    if (find_duplicates) prefetch = std::max(prefetch, FileAccess::Content);  // Copies are told apart by content
 
-// Worker function for parallel file processing
-void process_files(std::vector<std::unique_ptr<CodeFetchModule>> &modules) {  
-    fs::path file_path;  // Stores current file path
-    // Process files until queue is empty
-    while (file_queue.pop(file_path)) {
-        // Pass file through all active modules
-        for (auto &module : modules) {
-            module->process_file(file_path);  // Module-specific processing
+    SourceFile file;  // Stores current file
+    std::function<void()> task;  // Chunk of a large file another worker split
+    // Process files and tasks until all work is done
+    while (file_queue.pop(file, task)) {
+        if (task) {
+            task();
+            continue;
+        }
+        {
+            FileView view(file, prefetch);  // Opened and read once, shared by language detection and every module
+            // Extensionless candidate without a recognizable language, or a listed file deleted since
+            bool counted = view.recognized() && !view.missing();
+            if (!counted) total_files.fetch_sub(1, std::memory_order_relaxed);
+            // Binary, minified and generated files were reported apart and never read past their head
+            bool skipped = !counted || (prefetch != FileAccess::Metadata && view.kind() != ContentKind::Source);
+            // Copies of a file seen earlier are reported by the filter instead of counted again
+            skipped = skipped || (find_duplicates && duplicate_filter.is_duplicate(view, worker));
+            // Pass file through all active modules
+            for (auto &module : modules) {
+                if (skipped) break;
+                module->process_file(view, worker);  // Module-specific processing
+            }
         }
-        files_processed++;  // Increment processed files counter
+        file.release();  // Lets the directory close its fd once all its files are done
+        file_queue.done();
     }
 }
 
@@ -70,6 +122,27 @@ int main(int argc, char *argv[]) {
     bool show_git = false;                // -g/--git-statistics
     bool show_metabuild_system = false;   // -m/--metabuild_system
     bool show_license = false;            // -i/--license
+    bool show_metrics = false;            // -x/--metrics
+    bool show_markers = false;            // -d/--debt-markers
+    bool no_ignore = false;               // --no-ignore
+    bool no_git_index = false;            // --no-git-index
+    bool include_untracked = false;       // --untracked
+    bool follow_symlinks = false;         // --follow-symlinks
+    bool one_file_system = false;         // --one-file-system
+    bool no_gitattributes = false;        // --no-gitattributes
+    bool profile = false;                 // --profile
+    bool keep_generated = false;          // --keep-generated
+    std::string queue_capacity = "65536"; // --queue-capacity (files buffered ahead of workers)
+    std::string files_from;               // --files-from (file list path or "-" for stdin)
+    std::vector<std::string> includes;    // --include globs
+    std::vector<std::string> excludes;    // --exclude globs
+    std::vector<std::string> marker_tags; // --marker tags, on top of the defaults
+    MarkerSet markers;                    // Debt marker tags, searched while lines are classified
+    IoOptions io_options;                 // Read strategy thresholds
+    std::string pread_limit = std::to_string(io_options.pread_limit);    // --pread-limit
+    std::string window_limit = std::to_string(io_options.window_limit);  // --window-limit
+    std::string window = std::to_string(io_options.window);              // --window
+    std::string split_limit = std::to_string(io_options.split_limit);    // --split-limit
 
     // Register command line flags (short and long versions)
     parser.add_flag("total_lines", &show_total_lines);
@@ -82,29 +155,74 @@ int main(int argc, char *argv[]) {
     parser.add_flag("m", &show_metabuild_system);
     parser.add_flag("license", &show_license);
     parser.add_flag("i", &show_license);
+    parser.add_flag("metrics", &show_metrics);
+    parser.add_flag("x", &show_metrics);
+    parser.add_flag("debt-markers", &show_markers);
+    parser.add_flag("d", &show_markers);
+    parser.add_flag("no-ignore", &no_ignore);
+    parser.add_flag("no-git-index", &no_git_index);
+    parser.add_flag("untracked", &include_untracked);
+    parser.add_flag("follow-symlinks", &follow_symlinks);
+    parser.add_flag("one-file-system", &one_file_system);
+    parser.add_flag("no-gitattributes", &no_gitattributes);
+    parser.add_flag("profile", &profile);
+    parser.add_flag("keep-generated", &keep_generated);
+    parser.add_flag("duplicates", &find_duplicates);
+    parser.add_option("queue-capacity", &queue_capacity);
+    parser.add_option("files-from", &files_from);
+    parser.add_option("pread-limit", &pread_limit);
+    parser.add_option("window-limit", &window_limit);
+    parser.add_option("window", &window);
+    parser.add_option("split-limit", &split_limit);
+    parser.add_list_option("include", &includes);
+    parser.add_list_option("exclude", &excludes);
+    parser.add_list_option("marker", &marker_tags);
 
     try {
         parser.parse(argc, argv);           // Parse command line arguments
         dir_path = parser.get_directory();  // Get target directory path
+        if (queue_capacity.find_first_not_of("0123456789") != std::string::npos || queue_capacity.empty()) {
+            throw std::invalid_argument("invalid value for --queue-capacity: " + queue_capacity);
+        }
+        file_queue.set_capacity(std::stoul(queue_capacity));  // Bounded queue gives backpressure
+        io_options.pread_limit = parse_size("pread-limit", pread_limit);
+        io_options.window_limit = std::max(parse_size("window-limit", window_limit), io_options.pread_limit + 1);
+        io_options.window = std::max<size_t>(parse_size("window", window), 1024 * 1024);
+        io_options.split_limit = std::max(parse_size("split-limit", split_limit), io_options.chunk);
+        FileIo::configure(io_options);  // Before any worker reads a file
+        ContentSniffer::configure(!keep_generated);
+        for (const auto& tag : marker_tags) {
+            if (!markers.add(tag)) throw std::invalid_argument("invalid or too many --marker tags: " + tag);
+        }
+        show_markers = show_markers || !marker_tags.empty();
+        if (show_markers) MarkerSet::activate(&markers);  // Before any worker classifies a file
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;  // Print parsing errors
         return 1;                           // Exit on error
     }
 
-    // Validate directory path exists and is accessible
-    if (!fs::exists(dir_path) || !fs::is_directory(dir_path)) {
+    // Validate directory path exists and is accessible; an archive stands in for a directory
+    bool archive = fs::is_regular_file(dir_path) && ArchiveSource::recognizes(dir_path);
+    if (!archive && (!fs::exists(dir_path) || !fs::is_directory(dir_path))) {
         std::cerr << "Error: Invalid directory path." << std::endl;
         return 1;
     }
 
+    // Validate file list is readable before any thread starts
+    if (!files_from.empty() && files_from != "-" && !fs::is_regular_file(files_from)) {
+        std::cerr << "Error: Cannot read file list " << files_from << std::endl;
+        return 1;
+    }
+
     // Collection of active modules
     std::vector<std::unique_ptr<CodeFetchModule>> modules;
     
     // If no flags specified, enable all modules with default settings
-    if (!show_languages && !show_license && !show_metabuild_system && !show_git && !show_total_lines) {
+    if (!show_languages && !show_license && !show_metabuild_system && !show_git && !show_total_lines && !show_metrics
+        && !show_markers) {
         modules.push_back(std::make_unique<LineCounterModule>());     // Line counter
         modules.push_back(std::make_unique<LanguageStatsModule>(5));  // Top 5 languages
-        modules.push_back(std::make_unique<GitModule>(5));            // Top 5 git contributors
+        if (!archive) modules.push_back(std::make_unique<GitModule>(5));  // Top 5 git contributors
         modules.push_back(std::make_unique<MetabuildSystemModule>()); // Build system detection
         modules.push_back(std::make_unique<LicenseModule>());         // License detection
     } else {
@@ -114,45 +232,109 @@ int main(int argc, char *argv[]) {
         if (show_metabuild_system) modules.push_back(std::make_unique<MetabuildSystemModule>());
         if (show_license) modules.push_back(std::make_unique<LicenseModule>());
         if (show_git) modules.push_back(std::make_unique<GitModule>(20));  // Top 20 contributors
+        if (show_metrics) modules.push_back(std::make_unique<TextMetricsModule>(10));  // Top 10 languages by size
+        if (show_markers) modules.push_back(std::make_unique<DebtMarkersModule>(markers, 10, 10));  // Top 10 languages and directories
     }
 
-    // Traverse directory and populate file queue (single filesystem pass)
-    FileUtils::traverse_directory(dir_path, file_queue, total_files);
-
-    // Check if any files were found
-    if (total_files == 0) {
-        std::cerr << "Error: No source files found in the specified directory." << std::endl;
-        return 1;
-    }
-
-    file_queue.finish();  // Signal that no more files will be added
-
     // Determine optimal thread count (use all available cores)
     unsigned int num_threads = std::thread::hardware_concurrency();
     if (num_threads == 0) num_threads = 4;  // Fallback to 4 threads if detection fails
     
+    for (auto &module : modules) {
+        module->prepare(num_threads);  // One accumulator shard per worker
+    }
+    if (find_duplicates) duplicate_filter.prepare(num_threads);
+    ChunkedScan::attach(file_queue);   // Large files are split into tasks for the same workers
+
     std::vector<std::thread> threads;  // Worker thread container
     threads.reserve(num_threads);      // Pre-allocate memory
     
-    // Create worker threads
+    // Create worker threads first so they consume files while the walk is still running
     for (unsigned int i = 0; i < num_threads; ++i) {
-        threads.emplace_back(process_files, std::ref(modules));  // Pass modules by reference
+        threads.emplace_back(process_files, std::ref(modules), i);  // Pass modules by reference
+    }
+
+    // Traverse directory and stream files into the queue, walkers block while workers catch up
+    TraversalOptions options;  // Traversal policy from command line
+    options.respect_ignore_files = !no_ignore;
+    options.include_untracked = include_untracked;
+    options.follow_symlinks = follow_symlinks;
+    options.one_file_system = one_file_system;
+    options.respect_git_attributes = !no_gitattributes;
+
+    PathFilter filter;  // All globs compiled once into a single matcher
+    for (const auto& glob : includes) filter.add_include(glob);
+    for (const auto& glob : excludes) filter.add_exclude(glob);
+    filter.compile();
+    if (!filter.empty()) options.filter = &filter;
+
+    std::string archive_error;  // Reported once the workers are done
+    bool list_ok = true;        // Same for a file list that failed mid-stream
+    if (!files_from.empty()) {  // Explicit file list bypasses traversal entirely
+        list_ok = FileUtils::read_file_list(files_from, file_queue, total_files, options);
+    } else if (archive) {  // Members streamed straight from the archive, nothing is extracted
+        ArchiveSource::read(dir_path, file_queue, total_files, options, archive_error);
+    } else {
+        // Work tree roots are enumerated from .git/index, everything else (or --no-ignore) is walked
+        bool from_index = !no_git_index && !no_ignore
+            && FileUtils::traverse_git_index(dir_path, file_queue, total_files, options);
+        if (!from_index) {
+            FileUtils::traverse_directory(dir_path, file_queue, total_files, options);
+        }
     }
+    file_queue.finish();  // Signal that no more files will be added
 
     // Wait for all threads to complete
     for (auto &thread : threads) {
         thread.join();
     }
 
+    // Fold the per-worker shards, always in worker order
+    for (auto &module : modules) {
+        module->merge();
+    }
+    if (find_duplicates) duplicate_filter.merge();
+
+    if (size_t unsupported = ArchiveSource::unsupported()) {  // After the join: workers count members too
+        std::cerr << "Warning: " << unsupported << " archive members skipped (encrypted, unsupported compression or too large)"
+                  << std::endl;
+    }
+    if (!archive_error.empty()) {
+        std::cerr << "Error: " << archive_error << std::endl;
+        return 1;
+    }
+    if (!list_ok) {
+        std::cerr << "Error: Cannot read file list " << files_from << std::endl;
+        return 1;
+    }
+
+    // Check if any files were found
+    if (total_files == 0) {
+        std::cerr << "Error: No source files found in the specified directory." << std::endl;
+        return 1;
+    }
+
     // Print statistics from all modules
     for (const auto &module : modules) {
         module->print_stats();
     }
 
+    auto skipped = ContentSniffer::report();  // Files left out of every count
+    if (!skipped.empty()) OutputFormatter::print_section("Skipped", "⊘", skipped);
+    auto duplicates = duplicate_filter.report(10);  // Top 10 directories by wasted bytes
+    if (!duplicates.empty()) OutputFormatter::print_section("Duplicates", "⧉", duplicates);
+
     // Calculate and print execution time
     auto end = std::chrono::high_resolution_clock::now();
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
     std::cout << "⏲ " << ms / 1000 << "s " << ms % 1000 << "ms\n";
 
+    if (profile) {  // Which kernels and read strategies the run actually used
+        auto items = FileIo::profile();
+        items.insert(items.begin(), {"kernel", ByteCount::kernel_name()});
+        std::cout << std::endl;
+        OutputFormatter::print_section("Profile", "⚙", items);
+    }
+
     return 0;  
 }
@@ -0,0 +1,153 @@
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MARKER_SET_X86 1
+#endif
+
+#include "marker_set.hpp"
+
+namespace {
+    const MarkerSet* active_set = nullptr;
+
+    bool identifier(char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+    }
+
+    // Buckets whose tags may start at a byte followed by next
+    inline unsigned candidates(const MarkerSet::Nibbles& nibbles, unsigned char byte, unsigned char next) {
+        return nibbles.low[0][byte & 15] & nibbles.high[0][byte >> 4] & nibbles.low[1][next & 15] & nibbles.high[1][next >> 4];
+    }
+
+    // Bit i set when a tag may start at data[i]; needs one byte past the vector for the second byte
+    using Kernel = uint32_t (*)(const char* data, const MarkerSet::Nibbles& nibbles);
+
+#ifdef MARKER_SET_X86
+    __attribute__((target("ssse3")))
+    inline __m128i buckets_ssse3(__m128i chunk, const uint8_t* low, const uint8_t* high) {
+        __m128i nibble = _mm_set1_epi8(0x0f);
+        __m128i lows = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(low)), _mm_and_si128(chunk, nibble));
+        __m128i highs = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(high)),
+                                         _mm_and_si128(_mm_srli_epi16(chunk, 4), nibble));
+        return _mm_and_si128(lows, highs);
+    }
+
+    __attribute__((target("ssse3")))
+    uint32_t starts_ssse3(const char* data, const MarkerSet::Nibbles& nibbles) {
+        __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 1));
+        __m128i both = _mm_and_si128(buckets_ssse3(first, nibbles.low[0], nibbles.high[0]),
+                                     buckets_ssse3(second, nibbles.low[1], nibbles.high[1]));
+        return ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(both, _mm_setzero_si128()))) & 0xffff;
+    }
+
+    __attribute__((target("avx2")))
+    inline __m256i buckets_avx2(__m256i chunk, const uint8_t* low, const uint8_t* high) {
+        __m256i nibble = _mm256_set1_epi8(0x0f);
+        __m256i lows = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(low))),
+                                           _mm256_and_si256(chunk, nibble));
+        __m256i highs = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(high))),
+                                            _mm256_and_si256(_mm256_srli_epi16(chunk, 4), nibble));
+        return _mm256_and_si256(lows, highs);
+    }
+
+    __attribute__((target("avx2")))
+    uint32_t starts_avx2(const char* data, const MarkerSet::Nibbles& nibbles) {
+        __m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+        __m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + 1));
+        __m256i both = _mm256_and_si256(buckets_avx2(first, nibbles.low[0], nibbles.high[0]),
+                                        buckets_avx2(second, nibbles.low[1], nibbles.high[1]));
+        return ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(both, _mm256_setzero_si256())));
+    }
+#endif
+
+    struct Selected {
+        Kernel kernel;  // Null: scalar only
+        size_t width;   // Positions per kernel call
+    };
+
+    Selected select_kernel() {
+#ifdef MARKER_SET_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return {starts_avx2, 32};
+        if (__builtin_cpu_supports("ssse3")) return {starts_ssse3, 16};
+#endif
+        return {nullptr, 0};
+    }
+
+    const Selected& selected() {
+        static const Selected choice = select_kernel();  // CPUID is queried once
+        return choice;
+    }
+}
+
+MarkerSet::MarkerSet() {
+    for (std::string_view tag : DEFAULTS) add(tag);
+}
+
+bool MarkerSet::add(std::string_view tag) {
+    if (tag.empty()) return false;
+    for (char c : tag) {
+        if (!identifier(c)) return false;
+    }
+    for (size_t i = 0; i < count_; ++i) {
+        if (tags[i] == tag) return true;
+    }
+    if (count_ == MAX_MARKERS) return false;
+    uint8_t bucket = static_cast<uint8_t>(1u << count_);
+    for (size_t k = 0; k < 2; ++k) {
+        if (k < tag.size()) {
+            unsigned char byte = static_cast<unsigned char>(tag[k]);
+            nibbles.low[k][byte & 15] |= bucket;
+            nibbles.high[k][byte >> 4] |= bucket;
+        } else {  // One-letter tag: any second byte will do
+            for (size_t n = 0; n < 16; ++n) {
+                nibbles.low[k][n] |= bucket;
+                nibbles.high[k][n] |= bucket;
+            }
+        }
+    }
+    shortest = count_ == 0 ? tag.size() : std::min(shortest, tag.size());
+    tags[count_++] = std::string(tag);
+    return true;
+}
+
+// Tags of the candidate buckets that match at pos as a whole identifier
+void MarkerSet::match(std::string_view text, size_t pos, unsigned buckets, MarkerCounts& counts) const {
+    if (pos > 0 && identifier(text[pos - 1])) return;
+    for (size_t i = 0; buckets; ++i, buckets >>= 1) {
+        if (!(buckets & 1)) continue;
+        const std::string& tag = tags[i];
+        size_t end = pos + tag.size();
+        if (text.compare(pos, tag.size(), tag) != 0) continue;
+        if (end < text.size() && identifier(text[end])) continue;
+        ++counts[i];
+    }
+}
+
+void MarkerSet::count(std::string_view text, MarkerCounts& counts) const {
+    if (count_ == 0 || text.size() < shortest) return;
+    const Selected& kernel = selected();
+    const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+    size_t pos = 0;
+    if (kernel.kernel) {
+        for (; pos + kernel.width < text.size(); pos += kernel.width) {  // The second byte of the last position is in bounds
+            for (uint32_t starts = kernel.kernel(text.data() + pos, nibbles); starts; starts &= starts - 1) {
+                size_t at = pos + static_cast<size_t>(__builtin_ctz(starts));
+                match(text, at, candidates(nibbles, bytes[at], bytes[at + 1]), counts);
+            }
+        }
+    }
+    for (; pos < text.size(); ++pos) {  // Tail, or everything without SSSE3; past the end reads as NUL
+        unsigned buckets = candidates(nibbles, bytes[pos], pos + 1 < text.size() ? bytes[pos + 1] : 0);
+        if (buckets) match(text, pos, buckets, counts);
+    }
+}
+
+void MarkerSet::activate(const MarkerSet* set) {
+    active_set = set;
+}
+
+const MarkerSet* MarkerSet::active() {
+    return active_set;
+}
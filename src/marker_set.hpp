@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "line_classifier.hpp"
+
+// Debt marker tags (TODO, FIXME...) searched for all at once, Teddy style: every tag is a bucket
+// of its own, and two nibble tables per leading byte give each byte the buckets whose tags could
+// start there (first byte) or continue there (second byte). One pass of shuffles over the text
+// leaves few candidates, only those are compared with their tags. A hit is a whole identifier,
+// so "TODOs" or "MY_TODO" do not count
+class MarkerSet {
+public:
+    static constexpr std::string_view DEFAULTS[] = {"TODO", "FIXME", "HACK", "XXX"};
+
+    MarkerSet();  // The default tags
+
+    bool add(std::string_view tag);  // False when full or not an identifier; adding a tag again is a no-op
+    size_t size() const { return count_; }
+    std::string_view tag(size_t index) const { return tags[index]; }
+
+    void count(std::string_view text, MarkerCounts& counts) const;  // Add the hits in text to counts
+
+    static void activate(const MarkerSet* set);  // Before any worker starts; null searches nothing
+    static const MarkerSet* active();
+
+    // Buckets by low and high nibble of the first and the second byte of a candidate
+    struct Nibbles {
+        alignas(16) uint8_t low[2][16];
+        alignas(16) uint8_t high[2][16];
+    };
+
+private:
+    std::string tags[MAX_MARKERS];
+    size_t count_ = 0;
+    size_t shortest = 0;
+    Nibbles nibbles = {};
+
+    void match(std::string_view text, size_t pos, unsigned buckets, MarkerCounts& counts) const;
+};
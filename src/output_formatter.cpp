@@ -14,17 +14,18 @@ void OutputFormatter::print_section(const std::string& title, const std::string&
 }
 
 // Print language statistics with distribution percentages
-void OutputFormatter::print_language_stats(const std::vector<std::pair<std::string, double>>& stats, 
+void OutputFormatter::print_language_stats(const std::vector<std::pair<std::string, LineTally>>& stats, 
     size_t total_lines) {
     std::cout << "⚐ Lines by Language  [incl: Code, Comments, Blanks]" << std::endl;
-    for (const auto& [language, percentage] : stats) {  // Structured binding for stats pairs
-        // Calculate absolute lines count
-        size_t lines = static_cast<size_t>(percentage * total_lines / 100); 
+    for (const auto& [language, lines] : stats) {  // Structured binding for stats pairs
+        // Calculate share of all lines
+        double percentage = total_lines ? static_cast<double>(lines.lines()) * 100.0 / total_lines : 0.0;
         // Format output with proper alignment and number formatting
         std::cout << "  ╰─ " << std::left << std::setw(16) << truncate(language, 15)   
                   << ": " << std::right << std::setw(5) << format_percentage(percentage) 
-                  << "  (" << format_large_number(lines) << " lines)" << std::endl;
-
+                  << "  (" << format_large_number(lines.lines()) << " lines: "
+                  << format_large_number(lines.code) << " code, " << format_large_number(lines.comments)
+                  << " comments, " << format_large_number(lines.blanks) << " blanks)" << std::endl;
 
     }
     std::cout << std::endl;
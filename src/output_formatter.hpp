@@ -4,14 +4,16 @@
 #include <vector>
 #include <iomanip>
 
+#include "line_classifier.hpp"
+
 class OutputFormatter {
 public:
     // Static method for printing sections with title and icon
     static void print_section(const std::string& title, const std::string& icon, 
         const std::vector<std::pair<std::string, std::string>>& items);
 
-    // Static method for printing language statistics with percentages
-    static void print_language_stats(const std::vector<std::pair<std::string, double>>& stats, size_t total_lines);
+    // Static method for printing language statistics with percentages and code/comment/blank splits
+    static void print_language_stats(const std::vector<std::pair<std::string, LineTally>>& stats, size_t total_lines);
 
     // Static method for printing contributor statistics
     static void print_contributor_stats(const std::vector<std::pair<std::string, double>>& stats);
@@ -0,0 +1,51 @@
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>  // For uintptr_t
+#include <cstring>  // For memcpy
+
+#include "path_arena.hpp"
+
+namespace {
+    constexpr size_t BLOCK_SIZE = 1024 * 1024;
+
+    std::mutex blocks_mutex;                      // Guards blocks
+    std::vector<std::unique_ptr<char[]>> blocks;  // Every block handed out, released at exit
+
+    char* new_block(size_t size) {
+        std::lock_guard<std::mutex> lock(blocks_mutex);
+        blocks.push_back(std::make_unique<char[]>(size));
+        return blocks.back().get();
+    }
+
+    struct Cursor {          // Free space in the calling thread's current block
+        char* next = nullptr;
+        char* end = nullptr;
+    };
+    thread_local Cursor cursor;
+}
+
+namespace PathArena {
+    void* allocate(size_t size, size_t align) {
+        if (size > BLOCK_SIZE / 4) return new_block(size);  // Oversized: own block, keep the current one
+
+        auto aligned = [align](char* p) {
+            return reinterpret_cast<char*>((reinterpret_cast<uintptr_t>(p) + align - 1) & ~(align - 1));
+        };
+        char* p = cursor.next ? aligned(cursor.next) : nullptr;
+        if (!p || p + size > cursor.end) {  // Current block exhausted, the tail is abandoned
+            cursor.next = new_block(BLOCK_SIZE);
+            cursor.end = cursor.next + BLOCK_SIZE;
+            p = aligned(cursor.next);
+        }
+        cursor.next = p + size;
+        return p;
+    }
+
+    std::string_view store(std::string_view text) {
+        char* p = static_cast<char*>(allocate(text.size() + 1, 1));
+        std::memcpy(p, text.data(), text.size());
+        p[text.size()] = '\0';  // data() can go straight to syscalls
+        return std::string_view(p, text.size());
+    }
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+// Append-only storage for names and directory nodes found during a run. Each thread bumps
+// through its own 1 MB block, nothing is freed before exit, so returned views stay valid.
+namespace PathArena {
+    void* allocate(size_t size, size_t align);      // Raw arena memory, never freed
+    std::string_view store(std::string_view text);  // NUL-terminated copy that lives for the whole run
+}
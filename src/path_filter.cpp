@@ -0,0 +1,60 @@
+#include "path_filter.hpp"
+
+void PathFilter::add(GlobSet& set, std::string_view glob, bool anchored) {
+    if (glob.substr(0, 3) == "**/" && glob.find('/', 3) == std::string_view::npos) {
+        glob.remove_prefix(3);  // "**/*.pb.cc" matches the same files as "*.pb.cc"
+    }
+    anchored = anchored || glob.find('/') != std::string_view::npos;
+    if (!glob.empty() && glob[0] == '/') glob.remove_prefix(1);
+    set.add(glob, anchored ? GlobSet::Target::Path : GlobSet::Target::Basename);
+}
+
+void PathFilter::add_include(std::string_view glob) {
+    if (glob.empty()) return;
+    if (glob.back() == '/') {  // "src/" means everything below src
+        add(include_files, std::string(glob) + "**");
+        return;
+    }
+    add(include_files, glob);
+}
+
+void PathFilter::add_exclude(std::string_view glob) {
+    if (glob.empty()) return;
+    bool dir_only = glob.back() == '/';
+    if (dir_only) glob.remove_suffix(1);
+    if (glob.empty()) return;
+
+    add(exclude_dirs, glob);
+    if (glob.size() > 3 && glob.substr(glob.size() - 3) == "/**") {
+        // "third_party/**" prunes third_party itself, still anchored like the glob it came from
+        add(exclude_dirs, glob.substr(0, glob.size() - 3), true);
+    }
+    if (!dir_only) add(exclude_files, glob);
+}
+
+void PathFilter::compile() {
+    include_files.compile();
+    exclude_files.compile();
+    exclude_dirs.compile();
+}
+
+bool PathFilter::accepts_dir(std::string_view rel_path, std::string_view name) const {
+    return exclude_dirs.empty() || exclude_dirs.last_match(rel_path, name) < 0;
+}
+
+bool PathFilter::accepts_file(std::string_view rel_path, std::string_view name) const {
+    if (!exclude_files.empty() && exclude_files.last_match(rel_path, name) >= 0) return false;
+    return include_files.empty() || include_files.last_match(rel_path, name) >= 0;
+}
+
+bool PathFilter::accepts_path(std::string_view rel_path) const {
+    if (!exclude_dirs.empty()) {  // No traversal pruned the ancestors, check each of them here
+        for (size_t slash = rel_path.find('/'); slash != std::string_view::npos; slash = rel_path.find('/', slash + 1)) {
+            std::string_view dir = rel_path.substr(0, slash);
+            size_t start = dir.rfind('/');
+            if (!accepts_dir(dir, start == std::string_view::npos ? dir : dir.substr(start + 1))) return false;
+        }
+    }
+    size_t slash = rel_path.rfind('/');
+    return accepts_file(rel_path, slash == std::string_view::npos ? rel_path : rel_path.substr(slash + 1));
+}
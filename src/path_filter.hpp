@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string_view>
+
+#include "glob_set.hpp"
+
+// --include/--exclude globs compiled once into GlobSets (hash fast paths plus one shared DFA)
+class PathFilter {
+private:
+    GlobSet include_files;  // A file must match one of these when any were given
+    GlobSet exclude_files;  // Files matching any of these are dropped
+    GlobSet exclude_dirs;   // Directories matching any of these are pruned unopened
+
+    // Pick basename or path target; anchored forces path even without a slash left in glob
+    static void add(GlobSet& set, std::string_view glob, bool anchored = false);
+
+public:
+    void add_include(std::string_view glob);
+    void add_exclude(std::string_view glob);
+    void compile();                      // Finalize, call once after all patterns
+    bool empty() const { return include_files.empty() && exclude_files.empty() && exclude_dirs.empty(); }
+
+    bool accepts_dir(std::string_view rel_path, std::string_view name) const;   // False prunes subtree
+    bool accepts_file(std::string_view rel_path, std::string_view name) const;  // Single file check
+    bool accepts_path(std::string_view rel_path) const;  // File check plus every ancestor directory
+};
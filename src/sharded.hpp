@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// One accumulator per worker thread, each padded to its own cache lines so workers never
+// share a line. Worker i only touches shard i; shards are read after the workers joined
+template <typename T>
+class Sharded {
+private:
+    struct alignas(64) Shard {  // std::hardware_destructive_interference_size is not reliably available
+        T value{};
+    };
+    std::vector<Shard> shards;
+
+public:
+    void resize(size_t workers) { shards = std::vector<Shard>(workers == 0 ? 1 : workers); }
+    size_t size() const { return shards.size(); }
+
+    T& operator[](size_t worker) { return shards[worker].value; }
+    const T& operator[](size_t worker) const { return shards[worker].value; }
+};
@@ -0,0 +1,98 @@
+#include <atomic>
+#include <mutex>
+#include <new>             // For placement new
+#include <fcntl.h>         // For openat and O_* flags
+#include <unistd.h>        // For close
+#include <sys/resource.h>  // For getrlimit/setrlimit
+
+#include "source_file.hpp"
+#include "archive_source.hpp"
+#include "file_utils.hpp"
+#include "path_arena.hpp"
+
+namespace {
+    std::atomic<size_t> open_dirs{0};  // Directory fds currently held by handles
+    size_t fd_budget = 0;              // Max directory fds handles may keep open
+    std::once_flag budget_flag;        // One-time limit setup
+
+    // Raise the soft fd limit to the hard limit and keep half of it for directory handles
+    void init_budget() {
+        rlimit limit{};
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0) {
+            if (limit.rlim_cur < limit.rlim_max) {
+                limit.rlim_cur = limit.rlim_max;
+                if (setrlimit(RLIMIT_NOFILE, &limit) != 0) getrlimit(RLIMIT_NOFILE, &limit);
+            }
+            fd_budget = limit.rlim_cur == RLIM_INFINITY ? 1 << 20 : limit.rlim_cur / 2;
+        } else {
+            fd_budget = 512;  // Conservative default when the limit is unknown
+        }
+    }
+}
+
+const DirHandle* DirHandle::create(const DirHandle* parent, std::string_view name, int fd) {
+    return new (PathArena::allocate(sizeof(DirHandle), alignof(DirHandle))) DirHandle(parent, name, fd);
+}
+
+void DirHandle::release(uint32_t count) const {
+    if (fd == -1) return;  // Nothing to close: path-based handles skip the atomic entirely
+    if (holds.fetch_sub(count, std::memory_order_acq_rel) == count) {
+        close(fd);
+        release_fd();
+    }
+}
+
+void DirHandle::append_path(std::string& out) const {
+    if (parent) {
+        parent->append_path(out);
+        if (!out.empty() && out.back() != '/') out += '/';
+    }
+    out += name;
+}
+
+fs::path DirHandle::path() const {
+    std::string out;
+    append_path(out);
+    return out;
+}
+
+bool DirHandle::reserve_fd() {
+    std::call_once(budget_flag, init_budget);
+    if (open_dirs.fetch_add(1, std::memory_order_relaxed) < fd_budget) return true;
+    open_dirs.fetch_sub(1, std::memory_order_relaxed);  // Over budget, caller falls back to paths
+    return false;
+}
+
+void DirHandle::release_fd() {
+    open_dirs.fetch_sub(1, std::memory_order_relaxed);
+}
+
+std::string_view SourceFile::extension() const {
+    return FileUtils::extension_of(name);
+}
+
+const char* SourceFile::c_path() const {
+    thread_local std::string buffer;  // Reused, so materializing a path rarely allocates
+    buffer.clear();
+    dir->append_path(buffer);
+    if (!buffer.empty() && buffer.back() != '/') buffer += '/';
+    buffer += name;
+    return buffer.c_str();
+}
+
+fs::path SourceFile::path() const {
+    return c_path();
+}
+
+int SourceFile::open() const {
+    if (entry) return -1;  // Read through ArchiveSource
+    if (dir->fd != -1) {
+        return openat(dir->fd, name.data(), O_RDONLY | O_CLOEXEC);  // Arena names are NUL-terminated
+    }
+    return ::open(c_path(), O_RDONLY | O_CLOEXEC);
+}
+
+void SourceFile::release() const {
+    if (entry) ArchiveSource::release(*entry);
+    dir->release();
+}
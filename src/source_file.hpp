@@ -0,0 +1,55 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace fs = std::filesystem;
+
+struct ArchiveEntry;
+
+// Directory node in the path arena: a parent link plus a name slice, never freed.
+// Files are opened relative to its fd, which closes once the last holder releases it
+class DirHandle {
+public:
+    static constexpr uint32_t HOLD_BIAS = 1u << 30;  // Holds owned by the creator until it is done
+
+    const DirHandle* const parent;  // Containing directory, null for roots
+    const std::string_view name;    // Name inside parent, whole path for roots (NUL-terminated)
+    const int fd;                   // Directory fd, -1 when the open-handle budget was exhausted
+    mutable std::atomic<uint64_t> detected{0};  // Content verdicts shared by files here (LanguageDetector)
+
+    // New node holding HOLD_BIAS holds; every entry handed out takes one of them over
+    static const DirHandle* create(const DirHandle* parent, std::string_view name, int fd);
+    void release(uint32_t count = 1) const;    // Drop holds, the last one closes fd
+    void append_path(std::string& out) const;  // Append full path by following parent links
+    fs::path path() const;                     // Full path, built only when needed
+
+    static bool reserve_fd();  // Claim a slot in the open-handle budget
+    static void release_fd();  // Give a slot back
+
+private:
+    mutable std::atomic<uint32_t> holds{HOLD_BIAS};  // Only counted when fd != -1
+
+    DirHandle(const DirHandle* parent, std::string_view name, int fd) : parent(parent), name(name), fd(fd) {}
+};
+
+// File handed from traversal to the worker pipeline: a fixed-size, trivially copyable handle
+struct SourceFile {
+    const DirHandle* dir = nullptr;  // Parent directory (arena-owned)
+    std::string_view name;           // Entry name inside dir (arena-owned, NUL-terminated)
+    uint64_t size = 0;               // Size hint from the git index, 0 when unknown
+    int64_t mtime = 0;               // Modification time from the git index, 0 when unknown
+    uint16_t language = 0;           // LanguageId from the name or linguist-language, 0 when unknown
+    bool detect = false;             // Content decides the language, or whether it is source at all
+    bool listed = false;             // From the git index, not seen on disk: may have been deleted since
+    const ArchiveEntry* entry = nullptr;  // Member of an archive instead of a file on disk (ArchiveSource)
+
+    std::string_view extension() const;  // Same rules as fs::path::extension, no allocation
+    const char* c_path() const;          // Full path in a per-thread buffer, valid until the next call
+    fs::path path() const;               // Full path as an owned fs::path
+    int open() const;                    // openat() relative to dir, path fallback; -1 for archive members
+    void release() const;                // Processing done, lets dir close its fd (and frees member bytes)
+};
@@ -0,0 +1,69 @@
+#include <algorithm>
+
+#include "text_format.hpp"
+
+namespace {
+    constexpr size_t SAMPLE_UNITS = 512;  // UTF-16 units a BOM-less guess looks at
+
+    bool starts_with(std::string_view head, std::string_view prefix) {
+        return head.substr(0, prefix.size()) == prefix;
+    }
+
+    // ASCII-heavy UTF-16 has a NUL in every other byte and none in between; binary data does not
+    bool looks_utf16(std::string_view head, size_t zero_at) {
+        size_t units = std::min(head.size() / 2, SAMPLE_UNITS);
+        if (units < 8) return false;
+        size_t zeros = 0;
+        for (size_t i = 0; i < units; ++i) {
+            if (head[2 * i + (1 - zero_at)] == '\0') return false;
+            zeros += head[2 * i + zero_at] == '\0';
+        }
+        return zeros * 4 >= units * 3;
+    }
+}
+
+LineEnding LineEndings::style() const {
+    int kinds = (lf != 0) + (crlf != 0) + (cr != 0);
+    if (kinds == 0) return LineEnding::None;
+    if (kinds > 1) return LineEnding::Mixed;
+    return lf ? LineEnding::LF : crlf ? LineEnding::CRLF : LineEnding::CR;
+}
+
+size_t TextFormat::width() const {
+    switch (encoding) {
+    case Encoding::Utf16LE: case Encoding::Utf16BE: return 2;
+    case Encoding::Utf32LE: case Encoding::Utf32BE: return 4;
+    default: return 1;
+    }
+}
+
+TextFormat TextFormat::detect(std::string_view head) {
+    using namespace std::literals;
+    // UTF-32LE first: its mark starts with the UTF-16LE one
+    if (starts_with(head, "\xff\xfe\0\0"sv)) return {Encoding::Utf32LE, 4};
+    if (starts_with(head, "\0\0\xfe\xff"sv)) return {Encoding::Utf32BE, 4};
+    if (starts_with(head, "\xef\xbb\xbf"sv)) return {Encoding::Utf8Bom, 3};
+    if (starts_with(head, "\xff\xfe"sv)) return {Encoding::Utf16LE, 2};
+    if (starts_with(head, "\xfe\xff"sv)) return {Encoding::Utf16BE, 2};
+    if (looks_utf16(head, 1)) return {Encoding::Utf16LE, 0};
+    if (looks_utf16(head, 0)) return {Encoding::Utf16BE, 0};
+    return {};
+}
+
+const char* name_of(Encoding encoding) {
+    constexpr const char* names[] = {"UTF-8", "UTF-8 BOM", "UTF-16LE", "UTF-16BE", "UTF-32LE", "UTF-32BE"};
+    return names[static_cast<size_t>(encoding)];
+}
+
+const char* name_of(LineEnding ending) {
+    constexpr const char* names[] = {"none", "LF", "CRLF", "CR", "mixed"};
+    return names[static_cast<size_t>(ending)];
+}
+
+bool FormatCounts::unusual() const {
+    for (size_t i = 1; i < encodings.size(); ++i) {
+        if (encodings[i]) return true;
+    }
+    return endings[static_cast<size_t>(LineEnding::CRLF)] || endings[static_cast<size_t>(LineEnding::CR)]
+        || endings[static_cast<size_t>(LineEnding::Mixed)];
+}
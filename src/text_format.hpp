@@ -0,0 +1,57 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Character encoding of a file, from its byte order mark or, for BOM-less UTF-16, its NUL pattern
+enum class Encoding : uint8_t { Utf8, Utf8Bom, Utf16LE, Utf16BE, Utf32LE, Utf32BE };
+
+// Line terminators a file uses; Mixed when more than one kind occurs
+enum class LineEnding : uint8_t { None, LF, CRLF, CR, Mixed };
+
+// Terminators seen by the line classifier: CRLF counts as one line end, a lone CR as one too
+struct LineEndings {
+    size_t lf = 0;
+    size_t crlf = 0;
+    size_t cr = 0;
+
+    LineEnding style() const;
+    LineEndings& operator+=(const LineEndings& other) {
+        lf += other.lf;
+        crlf += other.crlf;
+        cr += other.cr;
+        return *this;
+    }
+};
+
+struct TextFormat {
+    Encoding encoding = Encoding::Utf8;
+    size_t bom = 0;  // Bytes of byte order mark before the text
+
+    size_t width() const;  // Bytes per code unit: 1, 2 or 4
+    bool big_endian() const { return encoding == Encoding::Utf16BE || encoding == Encoding::Utf32BE; }
+
+    static TextFormat detect(std::string_view head);  // From the first bytes of a file
+};
+
+const char* name_of(Encoding encoding);
+const char* name_of(LineEnding ending);
+
+// Files per encoding and per line ending style, for reports
+struct FormatCounts {
+    std::array<size_t, 6> encodings{};
+    std::array<size_t, 5> endings{};
+
+    void add(Encoding encoding, LineEnding ending) {
+        ++encodings[static_cast<size_t>(encoding)];
+        ++endings[static_cast<size_t>(ending)];
+    }
+    FormatCounts& operator+=(const FormatCounts& other) {
+        for (size_t i = 0; i < encodings.size(); ++i) encodings[i] += other.encodings[i];
+        for (size_t i = 0; i < endings.size(); ++i) endings[i] += other.endings[i];
+        return *this;
+    }
+    bool unusual() const;  // Anything besides BOM-less UTF-8 with LF (or no) line ends
+};
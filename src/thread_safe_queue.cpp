@@ -1,22 +1,50 @@
 #include "thread_safe_queue.hpp"
 
-void ThreadSafeQueue::push(const std::filesystem::path& item) {  // Thread-safe method to add item to queue
+void ThreadSafeQueue::set_capacity(size_t max_items) {  // Configure backpressure limit
     std::lock_guard<std::mutex> lock(mutex);  // RAII lock for thread safety
-    queue.push(item);                             // Add item to underlying queue
+    capacity = max_items;
+}
+
+void ThreadSafeQueue::push(SourceFile item) {  // Thread-safe method to add item to queue
+    std::unique_lock<std::mutex> lock(mutex); // RAII lock with ability to unlock
+    while (capacity != 0 && queue.size() >= capacity) {  // Backpressure: wait for consumers
+        not_full.wait(lock);
+    }
+    queue.push(item);                             // Add item to underlying queue (trivially copyable)
     cond.notify_one();                            // Notify one waiting thread about new data
 }
 
-bool ThreadSafeQueue::pop(std::filesystem::path& item) {  // Thread-safe method to remove item from queue
+void ThreadSafeQueue::push_task(std::function<void()> task) {  // Tasks bypass the capacity bound
+    std::lock_guard<std::mutex> lock(mutex);  // RAII lock for thread safety
+    tasks.push_back(std::move(task));
+    cond.notify_one();                            // Idle workers pick tasks up at once
+}
+
+bool ThreadSafeQueue::pop(SourceFile& item, std::function<void()>& task) {  // Thread-safe method to remove work
     std::unique_lock<std::mutex> lock(mutex); // RAII lock with ability to unlock
-    while (queue.empty() && !finished) {          // Wait while queue is empty and not finished
+    // Wait while there is nothing to do and the run is not over (busy workers may still post tasks)
+    while (tasks.empty() && queue.empty() && !(finished && busy == 0)) {
         cond.wait(lock);                      // Release lock and wait for notification
     }
+    if (!tasks.empty()) {                         // Tasks finish files already in progress: first
+        task = std::move(tasks.front());
+        tasks.pop_front();
+        return true;
+    }
+    task = nullptr;
     if (!queue.empty()) {                         // Check if queue has data
         item = queue.front();                     // Get first item
         queue.pop();                              // Remove first item
+        ++busy;
+        if (capacity != 0) not_full.notify_one(); // Let one blocked producer continue
         return true;
     }
-    return false;                                 // Return false if queue is empty and finished
+    return false;                                 // Return false if queue is empty, finished and idle
+}
+
+void ThreadSafeQueue::done() {                    // A popped file is fully processed
+    std::lock_guard<std::mutex> lock(mutex);  // RAII lock for thread safety
+    if (--busy == 0 && finished) cond.notify_all();  // Last busy worker: the others may leave
 }
 
 void ThreadSafeQueue::finish() {                  // Signal that no more items will be added
@@ -1,20 +1,34 @@
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <queue>
 #include <mutex>
 #include <condition_variable>
-#include <filesystem>
 
+#include "source_file.hpp"
+
+// Work for the worker pool: discovered files, plus tasks that workers post while processing one
+// (chunks of a split file). Tasks are served first, and no worker leaves while another one is
+// still busy with a file, since that file may yet post tasks
 class ThreadSafeQueue {
 private:
-    std::queue<std::filesystem::path> queue;  // Queue storing filesystem paths
+    std::queue<SourceFile> queue;             // Queue storing discovered files
+    std::deque<std::function<void()>> tasks;  // Posted by busy workers, unbounded
     mutable std::mutex mutex;                 //  Mutex for thread-safe access
     std::condition_variable cond;             // Condition variable for thread signaling
+    std::condition_variable not_full;         // Wakes producers blocked on a full queue
+    size_t capacity = 0;                      // Max queued items, 0 means unbounded
     bool finished = false;                    // Flag for queue completion with in-class initializer
+    size_t busy = 0;                          // Files popped but not yet done()
 
 public:
-    void push(const std::filesystem::path& item);  // Add path to queue
-    bool pop(std::filesystem::path& item);         // Remove and return path from queue
+    void set_capacity(size_t max_items);           // Bound queue size (call before producers start)
+    void push(SourceFile item);                    // Add file to queue, blocks while full
+    void push_task(std::function<void()> task);    // Add task, never blocks
+    // Next task (task set) or file (task empty, call done() after it); false once all work is over
+    bool pop(SourceFile& item, std::function<void()>& task);
+    void done();                                   // File from pop() fully processed
     void finish();                                 // Mark queue as complete
     bool empty() const;                            // Check if queue is empty
 };
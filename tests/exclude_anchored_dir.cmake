@@ -0,0 +1,19 @@
+# "--exclude third_party/**" prunes the top-level third_party only, not src/third_party below it
+file(REMOVE_RECURSE ${WORK_DIR})
+file(WRITE ${WORK_DIR}/third_party/vendored.c "int a;\nint b;\n")
+file(WRITE ${WORK_DIR}/src/third_party/nested.c "int c;\nint d;\n")
+file(WRITE ${WORK_DIR}/src/main.c "int e;\nint f;\n")
+
+foreach(glob "third_party/**" "/third_party/")
+    execute_process(COMMAND ${CODEFETCH} -t --no-git-index --exclude ${glob} ${WORK_DIR}
+                    OUTPUT_VARIABLE output RESULT_VARIABLE result)
+    if(NOT result EQUAL 0 OR NOT output MATCHES "─ 4  \\(4 code")
+        message(FATAL_ERROR "--exclude ${glob}: expected 4 lines, got:\n${output}")
+    endif()
+endforeach()
+
+execute_process(COMMAND ${CODEFETCH} -t --no-git-index --exclude third_party ${WORK_DIR}
+                OUTPUT_VARIABLE output RESULT_VARIABLE result)
+if(NOT result EQUAL 0 OR NOT output MATCHES "─ 2  \\(2 code")
+    message(FATAL_ERROR "--exclude third_party: expected 2 lines, got:\n${output}")
+endif()